@@ -0,0 +1,231 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Test signals and WAV files for the benchmarks
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "audio.h"
+
+
+#define AUDIO_PI    3.14159265358979
+
+
+static bench_audio *audio_new(const char *name, int samplerate, int channels, int samples,
+                              int use_float)
+{
+    bench_audio *audio = (bench_audio *) calloc(1, sizeof(bench_audio));
+
+    if (audio == NULL)
+        return NULL;
+    snprintf(audio->name, sizeof(audio->name), "%s", name);
+    audio->samplerate = samplerate;
+    audio->channels = channels;
+    audio->samples = samples;
+
+    if (use_float)
+        audio->fpcm = (float *) calloc((size_t) samples * channels, sizeof(float));
+    else
+        audio->pcm = (short int *) calloc((size_t) samples * channels, sizeof(short int));
+    if (audio->pcm == NULL && audio->fpcm == NULL) {
+        free(audio);
+        return NULL;
+    }
+
+    return audio;
+}
+
+void audio_free(bench_audio * audio)
+{
+    if (audio == NULL)
+        return;
+    free(audio->pcm);
+    free(audio->fpcm);
+    free(audio);
+}
+
+/* Linear congruential generator, so the noise is the same on every platform */
+static int noise_sample(unsigned long *seed)
+{
+    *seed = (*seed * 1103515245UL + 12345UL) & 0xffffffffUL;
+    return (int) ((*seed >> 16) & 0xffff) - 32768;
+}
+
+/* Something like a piano playing an arpeggio over a drum, with a little hiss */
+static double music_sample(int i, int ch, int samplerate, unsigned long *seed)
+{
+    static const double notes[8] = { 261.63, 329.63, 392.00, 523.25,
+        392.00, 329.63, 293.66, 246.94
+    };
+    double t = (double) i / samplerate;
+    int beat = (int) (t * 4.0);
+    double since = t - beat / 4.0;
+    double freq = notes[beat % 8];
+    double s = 0.0;
+    int k;
+
+    // six decaying harmonics, panned a little differently in each channel
+    for (k = 1; k <= 6; k++)
+        s += sin(2.0 * AUDIO_PI * freq * k * t + ch * k) / k;
+    s *= 6000.0 * exp(-since * 6.0) * (1.0 + 0.3 * ch * (beat & 1));
+
+    // a kick on every other beat, and a noise floor 50 dB down
+    if (!(beat & 1))
+        s += 12000.0 * sin(2.0 * AUDIO_PI * 60.0 * since) * exp(-since * 20.0);
+    s += noise_sample(seed) * 0.003;
+
+    return s;
+}
+
+bench_audio *audio_synthetic(const char *signal, int samplerate, int channels, int samples)
+{
+    bench_audio *audio;
+    unsigned long seed = 1;
+    int i, ch;
+
+    if (strcmp(signal, "silence") && strcmp(signal, "sine") && strcmp(signal, "noise")
+        && strcmp(signal, "transients") && strcmp(signal, "music")) {
+        fprintf(stderr, "Unknown test signal: %s\n", signal);
+        return NULL;
+    }
+
+    audio = audio_new(signal, samplerate, channels, samples, 0);
+    if (audio == NULL)
+        return NULL;
+
+    for (i = 0; i < samples; i++) {
+        for (ch = 0; ch < channels; ch++) {
+            double s = 0.0;
+
+            if (!strcmp(signal, "sine")) {
+                // 1 kHz on the left, 1.5 kHz on the right, at -6 dBFS
+                s = 16384.0 * sin(2.0 * AUDIO_PI * (1000.0 + 500.0 * ch) * i / samplerate);
+            } else if (!strcmp(signal, "noise")) {
+                s = noise_sample(&seed) / 2;
+            } else if (!strcmp(signal, "transients")) {
+                // a decaying burst of noise every quarter of a second
+                int t = i % (samplerate / 4);
+                s = noise_sample(&seed) * exp(-t * 220.5 / samplerate);
+            } else if (!strcmp(signal, "music")) {
+                s = music_sample(i, ch, samplerate, &seed);
+            }
+
+            if (s > 32767.0)
+                s = 32767.0;
+            if (s < -32768.0)
+                s = -32768.0;
+            audio->pcm[i * channels + ch] = (short int) s;
+        }
+    }
+
+    return audio;
+}
+
+
+static unsigned int read_le(const unsigned char *p, int bytes)
+{
+    unsigned int v = 0;
+
+    while (bytes--)
+        v = (v << 8) | p[bytes];
+    return v;
+}
+
+bench_audio *audio_read_wav(const char *filename, int max_samples)
+{
+    FILE *file = fopen(filename, "rb");
+    unsigned char header[12], chunk[8], fmt[16];
+    int format = 0, channels = 0, samplerate = 0, bits = 0;
+    bench_audio *audio = NULL;
+    const char *base;
+
+    if (file == NULL) {
+        fprintf(stderr, "%s: cannot open input file\n", filename);
+        return NULL;
+    }
+
+    if (fread(header, 1, 12, file) != 12 || memcmp(header, "RIFF", 4)
+        || memcmp(header + 8, "WAVE", 4)) {
+        fprintf(stderr, "%s: not a WAV file\n", filename);
+        fclose(file);
+        return NULL;
+    }
+
+    base = strrchr(filename, '/');
+    base = base != NULL ? base + 1 : filename;
+
+    while (fread(chunk, 1, 8, file) == 8) {
+        long size = read_le(chunk + 4, 4);
+
+        if (!memcmp(chunk, "fmt ", 4) && size >= 16) {
+            if (fread(fmt, 1, 16, file) != 16)
+                break;
+            format = read_le(fmt, 2);
+            channels = read_le(fmt + 2, 2);
+            samplerate = read_le(fmt + 4, 4);
+            bits = read_le(fmt + 14, 2);
+            size -= 16;
+        } else if (!memcmp(chunk, "data", 4)) {
+            int bytes = bits / 8;
+            int samples;
+
+            if (!((format == 1 && bits == 16) || (format == 3 && bits == 32))
+                || channels < 1 || channels > 2) {
+                fprintf(stderr, "%s: only 16-bit or float mono/stereo WAV files are supported\n",
+                        filename);
+                break;
+            }
+
+            samples = size / (bytes * channels);
+            if (max_samples > 0 && samples > max_samples)
+                samples = max_samples;
+
+            // the samples are read as they are, so this assumes a little-endian machine
+            audio = audio_new(base, samplerate, channels, samples, bits == 32);
+            if (audio == NULL)
+                break;
+            if (fread(audio->pcm != NULL ? (void *) audio->pcm : (void *) audio->fpcm,
+                      bytes * channels, samples, file) != (size_t) samples) {
+                fprintf(stderr, "%s: failed to read the samples\n", filename);
+                audio_free(audio);
+                audio = NULL;
+            }
+            break;
+        }
+
+        // chunks are padded to an even length
+        if (fseek(file, size + (size & 1), SEEK_CUR) != 0)
+            break;
+    }
+
+    if (audio == NULL && format == 0)
+        fprintf(stderr, "%s: no audio found\n", filename);
+    fclose(file);
+    return audio;
+}
+
+
+// vim:ts=4:sw=4:nowrap:
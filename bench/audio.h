@@ -0,0 +1,48 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef TWOLAME_BENCH_AUDIO_H
+#define TWOLAME_BENCH_AUDIO_H
+
+/* Audio held in memory, interleaved; either pcm or fpcm is set */
+typedef struct bench_audio_struc {
+    char name[64];
+    int samplerate;
+    int channels;
+    int samples;                // per channel
+    short int *pcm;
+    float *fpcm;                // full scale is 1.0
+} bench_audio;
+
+/* Generated signals: "silence", "sine", "noise", "transients" or "music" */
+bench_audio *audio_synthetic(const char *signal, int samplerate, int channels, int samples);
+
+/* Load a 16-bit or 32-bit float WAV file with one or two channels,
+   keeping at most max_samples (if > 0) */
+bench_audio *audio_read_wav(const char *filename, int max_samples);
+
+void audio_free(bench_audio * audio);
+
+#endif
+
+
+// vim:ts=4:sw=4:nowrap:
@@ -0,0 +1,673 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Microbenchmarks of the stages of the encoder
+
+   Each stage of encode_frame() is timed on its own, frame by frame, over
+   synthetic signals and any WAV files given on the command line. Every
+   repetition encodes the whole input again with fresh encoders, so that
+   the psychoacoustic models and the filterbank start from the same state.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+
+#include "twolame.h"
+#include "common.h"
+#include "bitbuffer.h"
+#include "bitbuffer_inline.h"
+#include "availbits.h"
+#include "encode.h"
+#include "subband.h"
+#include "crc.h"
+#include "psycho_n1.h"
+#include "psycho_0.h"
+#include "psycho_1.h"
+#include "psycho_2.h"
+#include "psycho_3.h"
+#include "psycho_4.h"
+#include "audio.h"
+
+
+#define BENCH_FRAMES        (200)   // Length of the synthetic signals
+#define BENCH_WARMUP        (2)
+#define BENCH_REPS          (10)
+#define BENCH_FRAME_BYTES   (4096)
+#define BENCH_MODELS        (6)     // Psychoacoustic models -1 to 4
+#define BENCH_THRESHOLD     (10.0)  // Percent slower that counts as a regression
+#define BENCH_NOISE_FLOOR   (100.0) // ns/frame slower that is never a regression
+
+
+enum bench_stage {
+    STAGE_FILTER,
+    STAGE_SCALEFACTOR,
+    STAGE_PSYCHO_N1,
+    STAGE_PSYCHO_0,
+    STAGE_PSYCHO_1,
+    STAGE_PSYCHO_2,
+    STAGE_PSYCHO_3,
+    STAGE_PSYCHO_4,
+    STAGE_BIT_ALLOCATION,
+    STAGE_QUANTIZATION,
+    STAGE_WRITE_SAMPLES,
+    STAGE_CRC,
+    NUM_STAGES
+};
+
+static const char *stage_names[NUM_STAGES] = {
+    "window_filter_subband",
+    "scalefactor_calc",
+    "psycho_n1",
+    "psycho_0",
+    "psycho_1",
+    "psycho_2",
+    "psycho_3",
+    "psycho_4",
+    "main_bit_allocation",
+    "subband_quantization",
+    "write_samples",
+    "crc"
+};
+
+
+/* The time taken by each stage in one repetition */
+typedef struct bench_pass_struc {
+    double ns[NUM_STAGES];
+    double cycles[NUM_STAGES];
+} bench_pass;
+
+/* The median time of each stage on one input */
+typedef struct bench_result_struc {
+    char input[64];
+    double ns[NUM_STAGES];
+} bench_result;
+
+typedef struct bench_clock_struc {
+    struct timespec ts;
+    unsigned long long cycles;
+} bench_clock;
+
+
+static double timer_overhead_ns = 0.0;
+static double timer_overhead_cycles = 0.0;
+
+
+
+/*
+  Timing
+*/
+
+/* The cycle counter is only read on x86, elsewhere cycles aren't reported */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define BENCH_HAVE_CYCLES 1
+static unsigned long long read_cycles(void)
+{
+    return __builtin_ia32_rdtsc();
+}
+#else
+#define BENCH_HAVE_CYCLES 0
+static unsigned long long read_cycles(void)
+{
+    return 0;
+}
+#endif
+
+static void clock_start(bench_clock * clk)
+{
+    clock_gettime(CLOCK_MONOTONIC, &clk->ts);
+    clk->cycles = read_cycles();
+}
+
+/* Add the time since clock_start() to stage of pass */
+static void clock_stop(bench_clock * clk, bench_pass * pass, int stage)
+{
+    struct timespec now;
+    unsigned long long cycles = read_cycles();
+    double ns, cy;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    ns = (now.tv_sec - clk->ts.tv_sec) * 1e9 + (now.tv_nsec - clk->ts.tv_nsec);
+    cy = (double) (cycles - clk->cycles);
+
+    // take away the cost of reading the clocks
+    ns -= timer_overhead_ns;
+    cy -= timer_overhead_cycles;
+    pass->ns[stage] += ns > 0.0 ? ns : 0.0;
+    pass->cycles[stage] += cy > 0.0 ? cy : 0.0;
+}
+
+/* Find the smallest time an empty clock_start()/clock_stop() pair takes */
+static void calibrate_timer(void)
+{
+    bench_pass pass;
+    bench_clock clk;
+    double best_ns = 1e30, best_cycles = 1e30;
+    int i;
+
+    for (i = 0; i < 1000; i++) {
+        memset(&pass, 0, sizeof(pass));
+        clock_start(&clk);
+        clock_stop(&clk, &pass, 0);
+        if (pass.ns[0] < best_ns)
+            best_ns = pass.ns[0];
+        if (pass.cycles[0] < best_cycles)
+            best_cycles = pass.cycles[0];
+    }
+
+    timer_overhead_ns = best_ns;
+    timer_overhead_cycles = best_cycles;
+}
+
+
+
+/*
+  Inputs
+*/
+
+/* The number of whole frames in the input */
+static int input_frames(const bench_audio * in)
+{
+    return in->samples / TWOLAME_SAMPLES_PER_FRAME;
+}
+
+/* Point view at frame of the input */
+static void input_view(const bench_audio * in, int frame, pcm_view * view)
+{
+    int offset = frame * TWOLAME_SAMPLES_PER_FRAME * in->channels;
+    int ch;
+
+    memset(view, 0, sizeof(pcm_view));
+    for (ch = 0; ch < 2; ch++) {
+        int c = ch < in->channels ? ch : 0;
+
+        if (in->fpcm != NULL)
+            view->fpcm[ch] = in->fpcm + offset + c;
+        else
+            view->pcm[ch] = in->pcm + offset + c;
+    }
+    view->stride = in->channels;
+}
+
+
+
+/*
+  Encoding
+*/
+
+/* An encoder for the input, with a CRC so that its cost is included */
+static twolame_options *encoder_new(const bench_audio * in, int psymodel)
+{
+    twolame_options *encopts = twolame_init();
+
+    if (encopts == NULL)
+        return NULL;
+
+    twolame_set_num_channels(encopts, in->channels);
+    twolame_set_in_samplerate(encopts, in->samplerate);
+    twolame_set_out_samplerate(encopts, in->samplerate);
+    twolame_set_psymodel(encopts, psymodel);
+    twolame_set_error_protection(encopts, TRUE);
+    twolame_set_verbosity(encopts, 0);
+
+    if (twolame_init_params(encopts) != 0) {
+        fprintf(stderr, "%s: configuring the encoder for psymodel %d failed\n", in->name,
+                psymodel);
+        twolame_close(&encopts);
+        return NULL;
+    }
+
+    return encopts;
+}
+
+/* Run one psychoacoustic model on a frame; the scalefactors come from the main encoder */
+static void run_psycho(twolame_options * model, twolame_options * enc, const pcm_view * view)
+{
+    static FLOAT sam[2][1056];
+    static unsigned int elapsed_time_psycho_3[50];
+
+    model->input = *view;
+    switch (model->psymodel) {
+    case -1:
+        twolame_psycho_n1(model, model->smr, model->num_channels_out);
+        break;
+    case 0:
+        twolame_psycho_0(model, model->smr, enc->scalar);
+        break;
+    case 1:
+        twolame_psycho_1(model, view, enc->max_sc, model->smr);
+        break;
+    case 2:
+        memset(sam, 0, sizeof(sam));
+        twolame_psycho_2(model, view, sam, model->smr);
+        break;
+    case 3:
+        twolame_psycho_3(model, view, enc->max_sc, model->smr, elapsed_time_psycho_3);
+        break;
+    case 4:
+        memset(sam, 0, sizeof(sam));
+        twolame_psycho_4(model, view, sam, model->smr);
+        break;
+    }
+}
+
+/*
+    Encode the whole input once, the way encode_frame() does, timing each stage
+    The main encoder uses psychoacoustic model 3, the default
+    Returns 0, or -1 if an encoder couldn't be set up
+*/
+static int run_pass(const bench_audio * in, bench_pass * pass)
+{
+    twolame_options *models[BENCH_MODELS];
+    twolame_options *enc;
+    unsigned char frame[BENCH_FRAME_BYTES];
+    bench_clock clk;
+    pcm_view view;
+    int f, m, result = 0;
+
+    memset(pass, 0, sizeof(bench_pass));
+    for (m = 0; m < BENCH_MODELS; m++)
+        models[m] = encoder_new(in, m - 1);
+    for (m = 0; m < BENCH_MODELS; m++) {
+        if (models[m] == NULL)
+            result = -1;
+    }
+    enc = models[3 + 1];
+
+    for (f = 0; f < input_frames(in) && result == 0; f++) {
+        int nch = enc->num_channels_out;
+        int gr, bl, ch, adb;
+        bit_stream bs;
+        bit_writer bw;
+
+        input_view(in, f, &view);
+        enc->input = view;
+        enc->num_crc_bits = 0;
+        adb = twolame_available_bits(enc);
+
+        clock_start(&clk);
+        memset(enc->sb_max, 0, sizeof(enc->sb_max));
+        for (gr = 0; gr < 3; gr++)
+            for (bl = 0; bl < 12; bl++)
+                for (ch = 0; ch < nch; ch++)
+                    twolame_window_filter_subband(&enc->smem, &enc->input,
+                                                  gr * 12 * 32 + 32 * bl, ch,
+                                                  &(*enc->sb_sample)[ch][gr][bl][0],
+                                                  enc->sb_max[ch][gr]);
+        clock_stop(&clk, pass, STAGE_FILTER);
+
+        clock_start(&clk);
+        twolame_scalefactor_calc_max(enc->sb_max, enc->scalar, nch, enc->sblimit);
+        twolame_find_sf_max(enc, enc->scalar, enc->max_sc);
+        if (enc->mode == TWOLAME_JOINT_STEREO)
+            twolame_combine_lr_scalefactor_calc(*enc->sb_sample, *enc->j_sample,
+                                                enc->j_scale, enc->sblimit);
+        twolame_sf_transmission_pattern(enc, enc->scalar, enc->scfsi);
+        clock_stop(&clk, pass, STAGE_SCALEFACTOR);
+
+        for (m = 0; m < BENCH_MODELS; m++) {
+            clock_start(&clk);
+            run_psycho(models[m], enc, &view);
+            clock_stop(&clk, pass, STAGE_PSYCHO_N1 + m);
+        }
+
+        clock_start(&clk);
+        twolame_main_bit_allocation(enc, enc->smr, enc->scfsi, enc->bit_alloc, &adb);
+        clock_stop(&clk, pass, STAGE_BIT_ALLOCATION);
+
+        // the side information isn't timed, it is only needed for the CRC
+        twolame_buffer_init(frame, sizeof(frame), &bs);
+        buffer_writer_begin(&bw, &bs);
+        twolame_write_header(enc, &bw);
+        buffer_writer_putbits(&bw, 0, 16);
+        twolame_write_bit_alloc(enc, enc->bit_alloc, &bw);
+        twolame_write_scalefactors(enc, enc->bit_alloc, enc->scfsi, enc->scalar, &bw);
+
+        clock_start(&clk);
+        twolame_subband_quantization(enc, enc->scalar, *enc->sb_sample, enc->j_scale,
+                                     *enc->j_sample, enc->bit_alloc, *enc->subband);
+        clock_stop(&clk, pass, STAGE_QUANTIZATION);
+
+        clock_start(&clk);
+        twolame_write_samples(enc, *enc->subband, enc->bit_alloc, &bw);
+        clock_stop(&clk, pass, STAGE_WRITE_SAMPLES);
+
+        buffer_writer_put_zero_bits(&bw, adb);
+        if (enc->header.padding)
+            buffer_writer_putbits(&bw, 0, 8);
+        buffer_writer_end(&bw, &bs);
+
+        clock_start(&clk);
+        twolame_crc_writeheader(frame, enc->num_crc_bits);
+        clock_stop(&clk, pass, STAGE_CRC);
+    }
+
+    for (m = 0; m < BENCH_MODELS; m++) {
+        if (models[m] != NULL)
+            twolame_close(&models[m]);
+    }
+
+    return result;
+}
+
+
+
+/*
+  Statistics
+*/
+
+static int compare_double(const void *a, const void *b)
+{
+    double x = *(const double *) a, y = *(const double *) b;
+
+    return (x > y) - (x < y);
+}
+
+/* Time each stage over warmup + reps passes of the input, print the results
+   and keep the medians in result */
+static int bench(const bench_audio * in, int warmup, int reps, bench_result * result)
+{
+    bench_pass *passes = (bench_pass *) calloc(reps, sizeof(bench_pass));
+    double *values = (double *) calloc(reps, sizeof(double));
+    int samples = TWOLAME_SAMPLES_PER_FRAME * in->channels;
+    int frames = input_frames(in);
+    int r, s;
+
+    if (frames < 1)
+        fprintf(stderr, "%s: shorter than one frame\n", in->name);
+    if (passes == NULL || values == NULL || frames < 1) {
+        free(passes);
+        free(values);
+        return -1;
+    }
+
+    for (r = 0; r < warmup + reps; r++) {
+        bench_pass pass;
+
+        if (run_pass(in, &pass) != 0) {
+            free(passes);
+            free(values);
+            return -1;
+        }
+        if (r >= warmup)
+            passes[r - warmup] = pass;
+    }
+
+    snprintf(result->input, sizeof(result->input), "%s", in->name);
+    printf("\n%s: %d Hz, %d channel%s, %d frames, %d warmup + %d repetitions\n",
+           in->name, in->samplerate, in->channels, in->channels > 1 ? "s" : "", frames,
+           warmup, reps);
+    printf("%-22s %12s %12s %12s %8s %12s %14s\n", "stage", "ns/frame", "min", "mean",
+           "stddev", "frames/s", "cycles/sample");
+
+    for (s = 0; s < NUM_STAGES; s++) {
+        double median, mean = 0.0, var = 0.0, cycles;
+
+        for (r = 0; r < reps; r++) {
+            values[r] = passes[r].ns[s] / frames;
+            mean += values[r];
+        }
+        mean /= reps;
+        for (r = 0; r < reps; r++)
+            var += (values[r] - mean) * (values[r] - mean);
+        var = reps > 1 ? var / (reps - 1) : 0.0;
+
+        qsort(values, reps, sizeof(double), compare_double);
+        median = reps % 2 ? values[reps / 2] : (values[reps / 2 - 1] + values[reps / 2]) / 2.0;
+        result->ns[s] = median;
+
+        printf("%-22s %12.0f %12.0f %12.0f %7.1f%% %12.0f", stage_names[s], median, values[0],
+               mean, mean > 0.0 ? 100.0 * sqrt(var) / mean : 0.0,
+               median > 0.0 ? 1e9 / median : 0.0);
+
+        if (BENCH_HAVE_CYCLES) {
+            for (r = 0; r < reps; r++)
+                values[r] = passes[r].cycles[s] / frames;
+            qsort(values, reps, sizeof(double), compare_double);
+            cycles = values[reps / 2];
+            printf(" %14.2f\n", cycles / samples);
+        } else {
+            printf(" %14s\n", "-");
+        }
+    }
+
+    free(passes);
+    free(values);
+    return 0;
+}
+
+
+
+
+/*
+  Baselines
+*/
+
+/* Inputs are known by their file name alone, so that a baseline still matches
+   when the files are found through another directory */
+static const char *input_key(const char *input)
+{
+    const char *key = input;
+
+    for (; *input != '\0'; input++)
+        if (*input == '/' || *input == '\\')
+            key = input + 1;
+    return key;
+}
+
+/* Split a baseline line into its input (which may have spaces in it), stage
+   and ns/frame, working back from the end. Returns 0, or -1 if it isn't one */
+static int parse_baseline_line(char *line, const char **input, const char **stage,
+                               double *ns)
+{
+    char *space, *end;
+
+    line[strcspn(line, "\r\n")] = '\0';
+    if ((space = strrchr(line, ' ')) == NULL)
+        return -1;
+    *ns = strtod(space + 1, &end);
+    if (end == space + 1 || *end != '\0')
+        return -1;
+    *space = '\0';
+
+    if ((space = strrchr(line, ' ')) == NULL || space == line)
+        return -1;
+    *stage = space + 1;
+    *space = '\0';
+    *input = input_key(line);
+    return 0;
+}
+
+/* Write the medians to a baseline file: one "input stage ns/frame" line per stage */
+static int write_baseline(const char *filename, const bench_result * results, int count)
+{
+    FILE *file = fopen(filename, "w");
+    int i, s;
+
+    if (file == NULL) {
+        fprintf(stderr, "Failed to open baseline file: %s\n", filename);
+        return -1;
+    }
+
+    fprintf(file, "# twolame_bench baseline (libtwolame %s): input stage ns/frame\n",
+            get_twolame_version());
+    for (i = 0; i < count; i++)
+        for (s = 0; s < NUM_STAGES; s++)
+            fprintf(file, "%s %s %.0f\n", input_key(results[i].input), stage_names[s],
+                    results[i].ns[s]);
+
+    fclose(file);
+    return 0;
+}
+
+/*
+    Compare the medians with a baseline file and print the differences
+    A stage has regressed when it is more than threshold percent, and
+    more than floor ns/frame, slower than in the baseline
+    Returns the number of stages that regressed, or -1 if none of the
+    baseline matched this run, so that nothing was compared
+*/
+static int compare_baseline(FILE * file, const bench_result * results, int count,
+                            double threshold, double floor)
+{
+    char line[256];
+    const char *input, *stage;
+    double before, now;
+    int regressed = 0, compared = 0, slower;
+
+    printf("\nChange from the baseline (fails over +%.1f%% and +%.0f ns/frame):\n", threshold,
+           floor);
+    printf("%-22s %-22s %12s %12s %9s\n", "input", "stage", "baseline", "now", "change");
+
+    while (fgets(line, sizeof(line), file) != NULL) {
+        int i, s;
+
+        if (line[0] == '#' || parse_baseline_line(line, &input, &stage, &before) != 0)
+            continue;
+
+        for (i = 0; i < count && strcmp(input_key(results[i].input), input); i++);
+        for (s = 0; s < NUM_STAGES && strcmp(stage_names[s], stage); s++);
+        if (i == count || s == NUM_STAGES)
+            continue;
+
+        now = results[i].ns[s];
+        slower = now > before * (1.0 + threshold / 100.0) && now > before + floor;
+        printf("%-22s %-22s %12.0f %12.0f %+8.1f%%%s\n", input, stage, before, now,
+               before > 0.0 ? 100.0 * (now / before - 1.0) : 0.0, slower ? "  SLOWER" : "");
+        regressed += slower;
+        compared++;
+    }
+
+    printf("%d of %d stages slowed down\n", regressed, compared);
+    if (compared == 0) {
+        fprintf(stderr, "None of the baseline is for the inputs and stages of this run\n");
+        return -1;
+    }
+    return regressed;
+}
+
+
+
+static void usage(void)
+{
+    fprintf(stderr, "Usage: twolame_bench [options] [file.wav ...]\n\n");
+    fprintf(stderr, "Times each stage of the encoder on silence, a sine, white noise and\n");
+    fprintf(stderr, "transients, then on each WAV file given.\n\n");
+    fprintf(stderr, "  -w warmup  untimed passes before measuring (default %d)\n", BENCH_WARMUP);
+    fprintf(stderr, "  -r reps    timed passes (default %d)\n", BENCH_REPS);
+    fprintf(stderr, "  -f frames  only use the first frames of each WAV file\n");
+    fprintf(stderr, "  -o file    write the median times to a baseline file\n");
+    fprintf(stderr, "  -c file    compare with a baseline file, and fail if a stage got slower\n");
+    fprintf(stderr, "             (or if the file is missing, or none of it matches this run)\n");
+    fprintf(stderr, "  -t percent how much slower counts as slower (default %.0f)\n",
+            BENCH_THRESHOLD);
+    fprintf(stderr, "  -n ns      ...and by at least this many ns/frame (default %.0f)\n",
+            BENCH_NOISE_FLOOR);
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    static const char *synthetic[] = { "silence", "sine", "noise", "transients" };
+    const int num_synthetic = (int) (sizeof(synthetic) / sizeof(synthetic[0]));
+    int warmup = BENCH_WARMUP, reps = BENCH_REPS, max_frames = 0;
+    double threshold = BENCH_THRESHOLD, floor = BENCH_NOISE_FLOOR;
+    const char *save = NULL, *compare = NULL;
+    bench_result *results;
+    int i, s, count = 0, errors = 0;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc)
+            usage();
+        if (!strcmp(argv[i], "-w"))
+            warmup = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-r"))
+            reps = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-f"))
+            max_frames = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-o"))
+            save = argv[++i];
+        else if (!strcmp(argv[i], "-c"))
+            compare = argv[++i];
+        else if (!strcmp(argv[i], "-t"))
+            threshold = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-n"))
+            floor = atof(argv[++i]);
+        else
+            usage();
+    }
+    if (warmup < 0 || reps < 1)
+        usage();
+
+    results = (bench_result *) calloc(num_synthetic + argc - i, sizeof(bench_result));
+    if (results == NULL)
+        return 1;
+
+    printf("twolame_bench: libtwolame version %s\n", get_twolame_version());
+    if (!BENCH_HAVE_CYCLES)
+        printf("(no cycle counter on this platform)\n");
+    calibrate_timer();
+
+    for (s = 0; s < num_synthetic; s++) {
+        bench_audio *in = audio_synthetic(synthetic[s], 44100, 2,
+                                          BENCH_FRAMES * TWOLAME_SAMPLES_PER_FRAME);
+
+        if (in != NULL && bench(in, warmup, reps, &results[count]) == 0)
+            count++;
+        else
+            errors++;
+        audio_free(in);
+    }
+
+    for (; i < argc; i++) {
+        bench_audio *in = audio_read_wav(argv[i], max_frames * TWOLAME_SAMPLES_PER_FRAME);
+
+        if (in != NULL && bench(in, warmup, reps, &results[count]) == 0)
+            count++;
+        else
+            errors++;
+        audio_free(in);
+    }
+
+    if (save != NULL && write_baseline(save, results, count) != 0)
+        errors++;
+
+    if (compare != NULL) {
+        FILE *file = fopen(compare, "r");
+
+        if (file != NULL) {
+            if (compare_baseline(file, results, count, threshold, floor) != 0)
+                errors++;
+            fclose(file);
+        } else {
+            fprintf(stderr, "Failed to open baseline file: %s (record one with -o)\n", compare);
+            errors++;
+        }
+    }
+
+    free(results);
+    return errors ? 1 : 0;
+}
+
+// vim:ts=4:sw=4:nowrap:
@@ -0,0 +1,521 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   End-to-end throughput of the encoder over a matrix of settings
+
+   Every combination of psychoacoustic model, mode, samplerate, bitrate
+   (CBR or VBR), error protection and DAB is encoded through the public API,
+   and the results are written out as JSON: one object per combination, so
+   that runs can be compared over time.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sys/resource.h>
+
+#include "twolame.h"
+#include "audio.h"
+
+
+#define MATRIX_MAX_VALUES   (16)
+#define MATRIX_CHUNK        (4 * TWOLAME_SAMPLES_PER_FRAME)   // Samples passed in per call
+#define MATRIX_MP2_BYTES    (16384)
+#define MATRIX_TIMERS       (22)    // The stages timed by encode_frame(), from 1
+
+/* What became of one combination */
+#define MATRIX_ENCODED      (0)
+#define MATRIX_REJECTED     (1)     // twolame_init_params() refused the settings
+#define MATRIX_FAILED       (-1)    // the settings were accepted, but encoding failed
+
+
+/* A list of values for one axis of the matrix */
+typedef struct matrix_axis_struc {
+    int count;
+    int values[MATRIX_MAX_VALUES];
+} matrix_axis;
+
+/* One point of the matrix */
+typedef struct matrix_config_struc {
+    int psymodel;
+    int mode;
+    int samplerate;
+    int bitrate;                // CBR bitrate, or 0 for VBR
+    int vbr_level;
+    int error_protection;
+    int dab;
+} matrix_config;
+
+typedef struct matrix_result_struc {
+    double wall_seconds;        // median over the repetitions
+    double cpu_seconds;
+    long output_bytes;
+    size_t encoder_bytes;
+    unsigned int stages[MATRIX_TIMERS];
+} matrix_result;
+
+
+static const char *mode_names[] = { "stereo", "joint", "dual", "mono" };
+
+/* What each block of encode_frame() counts in elapsed_time_twolame[] */
+static const char *stage_names[MATRIX_TIMERS] = {
+    NULL,
+    "frame_setup",
+    "available_bits",
+    "window_filter_subband",
+    "scalefactor_calc",
+    "find_sf_max",
+    "combine_lr",
+    "psycho",
+    "sf_transmission_pattern",
+    "main_bit_allocation",
+    "write_header",
+    "crc_placeholder",
+    "write_bit_alloc",
+    "write_scalefactors",
+    "subband_quantization",
+    "write_samples",
+    "stuffing",
+    "padding",
+    "ancillary",
+    "frame_check",
+    "energy_levels",
+    "crc"
+};
+
+
+
+/*
+  Command line
+*/
+
+static void usage(void)
+{
+    fprintf(stderr, "Usage: twolame_matrix [options] [file.wav ...]\n\n");
+    fprintf(stderr, "Encodes generated inputs and each WAV file with every combination of the\n");
+    fprintf(stderr, "settings below, and writes the throughput of each as JSON.\n\n");
+    fprintf(stderr, "  -o file     where to write the results (default matrix.json)\n");
+    fprintf(stderr, "  -l seconds  length of the generated inputs (default 10, 0 for none)\n");
+    fprintf(stderr, "  -g signals  generated inputs (default music)\n");
+    fprintf(stderr, "  -r reps     encode each combination reps times (default 1)\n");
+    fprintf(stderr, "  -p models   psychoacoustic models (default -1,0,1,2,3,4)\n");
+    fprintf(stderr, "  -m modes    modes (default mono,stereo,joint,dual)\n");
+    fprintf(stderr, "  -s rates    samplerates of the generated inputs\n");
+    fprintf(stderr, "              (default 32000,44100,48000,16000,22050,24000)\n");
+    fprintf(stderr, "  -b kbps     MPEG-1 CBR bitrates (default 128,192,256)\n");
+    fprintf(stderr, "  -B kbps     MPEG-2 CBR bitrates (default 64,96,160)\n");
+    fprintf(stderr, "  -v levels   VBR levels (default 0,5)\n");
+    fprintf(stderr, "  -e 0,1      error protection off and/or on (default 0,1)\n");
+    fprintf(stderr, "  -d 0,1      DAB extensions off and/or on (default 0,1)\n");
+    fprintf(stderr, "\nWAV files are encoded at their own samplerate. An empty list\n");
+    fprintf(stderr, "(e.g. -v \"\") leaves that axis out.\n");
+    exit(1);
+}
+
+/* Parse a comma separated list of numbers, or of mode names */
+static void parse_axis(const char *arg, matrix_axis * axis, int modes)
+{
+    char buf[256];
+    char *item;
+
+    snprintf(buf, sizeof(buf), "%s", arg);
+    axis->count = 0;
+    for (item = strtok(buf, ","); item != NULL; item = strtok(NULL, ",")) {
+        char *end;
+        int value, m;
+
+        if (axis->count == MATRIX_MAX_VALUES) {
+            fprintf(stderr, "Too many values in '%s'\n", arg);
+            usage();
+        }
+
+        if (modes) {
+            for (m = 0; m < 4 && strcmp(item, mode_names[m]); m++);
+            if (m == 4) {
+                fprintf(stderr, "Unknown mode '%s'\n", item);
+                usage();
+            }
+            value = TWOLAME_STEREO + m;
+        } else {
+            value = (int) strtol(item, &end, 10);
+            if (*end != '\0') {
+                fprintf(stderr, "'%s' isn't a number\n", item);
+                usage();
+            }
+        }
+        axis->values[axis->count++] = value;
+    }
+}
+
+/* Write str as a JSON string */
+static void json_string(FILE * out, const char *str)
+{
+    fputc('"', out);
+    for (; *str; str++) {
+        if (*str == '"' || *str == '\\')
+            fputc('\\', out);
+        if ((unsigned char) *str >= 0x20)
+            fputc(*str, out);
+    }
+    fputc('"', out);
+}
+
+
+
+/*
+  Encoding
+*/
+
+static double seconds_now(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static long peak_rss_kb(void)
+{
+    struct rusage usage;
+
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return -1;
+    return usage.ru_maxrss;
+}
+
+static twolame_options *encoder_new(const bench_audio * in, const matrix_config * config)
+{
+    twolame_options *encopts = twolame_init();
+
+    if (encopts == NULL)
+        return NULL;
+
+    twolame_set_verbosity(encopts, 0);
+    twolame_set_num_channels(encopts, in->channels);
+    twolame_set_in_samplerate(encopts, in->samplerate);
+    twolame_set_out_samplerate(encopts, config->samplerate);
+    twolame_set_mode(encopts, (TWOLAME_MPEG_mode) config->mode);
+    twolame_set_psymodel(encopts, config->psymodel);
+    if (config->bitrate > 0) {
+        twolame_set_bitrate(encopts, config->bitrate);
+    } else {
+        twolame_set_VBR(encopts, TRUE);
+        twolame_set_VBR_level(encopts, (float) config->vbr_level);
+    }
+    twolame_set_error_protection(encopts, config->error_protection);
+    twolame_set_DAB(encopts, config->dab);
+
+    if (twolame_init_params(encopts) != 0) {
+        twolame_close(&encopts);
+        return NULL;
+    }
+
+    return encopts;
+}
+
+/*
+    Encode the whole input with config, reps times
+    Returns MATRIX_ENCODED, MATRIX_REJECTED or MATRIX_FAILED
+*/
+static int encode(const bench_audio * in, const matrix_config * config, int reps,
+                  matrix_result * result)
+{
+    static unsigned char mp2[MATRIX_MP2_BYTES];
+    double *walls = (double *) calloc(reps, sizeof(double));
+    int r;
+
+    memset(result, 0, sizeof(matrix_result));
+    if (walls == NULL)
+        return MATRIX_FAILED;
+
+    for (r = 0; r < reps; r++) {
+        unsigned int elapsed_time_psycho_3[50];
+        twolame_options *encopts = encoder_new(in, config);
+        bit_stream bs;
+        double start;
+        clock_t cpu;
+        int pos, bytes;
+
+        if (encopts == NULL) {
+            free(walls);
+            return MATRIX_REJECTED;
+        }
+        result->encoder_bytes = twolame_get_memory_usage(encopts);
+        result->output_bytes = 0;
+
+        start = seconds_now();
+        cpu = clock();
+        for (pos = 0; pos < in->samples; pos += MATRIX_CHUNK) {
+            int count = in->samples - pos < MATRIX_CHUNK ? in->samples - pos : MATRIX_CHUNK;
+
+            if (in->fpcm != NULL)
+                bytes = twolame_encode_buffer_float32_interleaved(encopts,
+                                                                  in->fpcm + pos * in->channels,
+                                                                  count, mp2, sizeof(mp2),
+                                                                  result->stages,
+                                                                  elapsed_time_psycho_3);
+            else
+                bytes = twolame_encode_buffer_interleaved(encopts, in->pcm + pos * in->channels,
+                                                          count, mp2, sizeof(mp2), &bs,
+                                                          result->stages, elapsed_time_psycho_3);
+            if (bytes < 0)
+                break;
+            result->output_bytes += bytes;
+        }
+        if (pos >= in->samples) {
+            bytes = twolame_encode_flush(encopts, mp2, sizeof(mp2), &bs, result->stages,
+                                         elapsed_time_psycho_3);
+            if (bytes >= 0)
+                result->output_bytes += bytes;
+        }
+        result->cpu_seconds += (double) (clock() - cpu) / CLOCKS_PER_SEC;
+        walls[r] = seconds_now() - start;
+
+        twolame_close(&encopts);
+        if (bytes < 0) {
+            free(walls);
+            return MATRIX_FAILED;
+        }
+    }
+
+    // the median wall time; each repetition adds to the stage and cpu times
+    for (r = 1; r < reps; r++) {
+        double w = walls[r];
+        int i = r;
+
+        for (; i > 0 && walls[i - 1] > w; i--)
+            walls[i] = walls[i - 1];
+        walls[i] = w;
+    }
+    result->wall_seconds = reps % 2 ? walls[reps / 2] : (walls[reps / 2 - 1] + walls[reps / 2]) / 2;
+    result->cpu_seconds /= reps;
+    for (r = 1; r < MATRIX_TIMERS; r++)
+        result->stages[r] /= reps;
+
+    free(walls);
+    return MATRIX_ENCODED;
+}
+
+static void write_result(FILE * out, const bench_audio * in, const matrix_config * config,
+                         const matrix_result * result, int status, int first)
+{
+    double audio_seconds = (double) in->samples / in->samplerate;
+    double frames = (double) in->samples / TWOLAME_SAMPLES_PER_FRAME;
+    int i;
+
+    fprintf(out, "%s\n    {\"input\": ", first ? "" : ",");
+    json_string(out, in->name);
+    fprintf(out, ", \"samplerate\": %d, \"mpeg\": %d, \"psymodel\": %d, \"mode\": \"%s\", ",
+            config->samplerate, config->samplerate >= 32000 ? 1 : 2, config->psymodel,
+            mode_names[config->mode - TWOLAME_STEREO]);
+    if (config->bitrate > 0)
+        fprintf(out, "\"bitrate\": %d, \"vbr\": false, ", config->bitrate);
+    else
+        fprintf(out, "\"vbr\": true, \"vbr_level\": %d, ", config->vbr_level);
+    fprintf(out, "\"error_protection\": %s, \"dab\": %s, ",
+            config->error_protection ? "true" : "false", config->dab ? "true" : "false");
+
+    if (status == MATRIX_REJECTED) {
+        fprintf(out, "\"error\": \"the encoder rejected these settings\"}");
+        return;
+    }
+    if (status == MATRIX_FAILED) {
+        fprintf(out, "\"error\": \"encoding failed\"}");
+        return;
+    }
+
+    fprintf(out, "\"audio_seconds\": %.3f, \"frames\": %.0f, \"wall_seconds\": %.6f, "
+            "\"cpu_seconds\": %.6f, ", audio_seconds, frames, result->wall_seconds,
+            result->cpu_seconds);
+    fprintf(out, "\"realtime_factor\": %.2f, \"frames_per_second\": %.1f, ",
+            result->wall_seconds > 0.0 ? audio_seconds / result->wall_seconds : 0.0,
+            result->wall_seconds > 0.0 ? frames / result->wall_seconds : 0.0);
+    fprintf(out, "\"output_bytes\": %ld, \"encoder_bytes\": %lu, \"peak_rss_kb\": %ld, ",
+            result->output_bytes, (unsigned long) result->encoder_bytes, peak_rss_kb());
+
+    fprintf(out, "\"stage_ms\": {");
+    for (i = 1; i < MATRIX_TIMERS; i++)
+        fprintf(out, "%s\"%s\": %u", i > 1 ? ", " : "", stage_names[i], result->stages[i]);
+    fprintf(out, "}}");
+}
+
+/*
+    Encode one input with every combination of the settings
+    Returns the number of combinations that failed to encode, and adds
+    those the encoder rejected to *rejected
+*/
+static int run_matrix(FILE * out, const bench_audio * in, int samplerate,
+                      const matrix_axis axes[], int reps, int *results, int *rejected)
+{
+    const matrix_axis *psymodels = &axes[0], *modes = &axes[1], *mpeg1 = &axes[2],
+        *mpeg2 = &axes[3], *vbr = &axes[4], *crc = &axes[5], *dab = &axes[6];
+    const matrix_axis *cbr = samplerate >= 32000 ? mpeg1 : mpeg2;
+    int p, m, b, e, d, failed = 0;
+
+    for (p = 0; p < psymodels->count; p++)
+        for (m = 0; m < modes->count; m++)
+            for (b = 0; b < cbr->count + vbr->count; b++)
+                for (e = 0; e < crc->count; e++)
+                    for (d = 0; d < dab->count; d++) {
+                        matrix_config config;
+                        matrix_result result;
+                        int status;
+
+                        config.psymodel = psymodels->values[p];
+                        config.mode = modes->values[m];
+                        config.samplerate = samplerate;
+                        config.bitrate = b < cbr->count ? cbr->values[b] : 0;
+                        config.vbr_level = b < cbr->count ? 0 : vbr->values[b - cbr->count];
+                        config.error_protection = crc->values[e];
+                        config.dab = dab->values[d];
+
+                        status = encode(in, &config, reps, &result);
+                        write_result(out, in, &config, &result, status, *results == 0);
+                        failed += status == MATRIX_FAILED;
+                        *rejected += status == MATRIX_REJECTED;
+                        (*results)++;
+                    }
+
+    return failed;
+}
+
+
+
+int main(int argc, char **argv)
+{
+    const char *outname = "matrix.json";
+    const char *signals = "music";
+    matrix_axis rates, axes[7];
+    int seconds = 10, reps = 1, results = 0, rejected = 0, failed = 0, files;
+    char buf[256];
+    char *signal;
+    FILE *out;
+    int i;
+
+    parse_axis("32000,44100,48000,16000,22050,24000", &rates, 0);
+    parse_axis("-1,0,1,2,3,4", &axes[0], 0);
+    parse_axis("mono,stereo,joint,dual", &axes[1], 1);
+    parse_axis("128,192,256", &axes[2], 0);
+    parse_axis("64,96,160", &axes[3], 0);
+    parse_axis("0,5", &axes[4], 0);
+    parse_axis("0,1", &axes[5], 0);
+    parse_axis("0,1", &axes[6], 0);
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i += 2) {
+        const char *arg = argv[i + 1];
+
+        if (i + 1 >= argc || argv[i][1] == '\0' || argv[i][2] != '\0')
+            usage();
+        switch (argv[i][1]) {
+        case 'o':
+            outname = arg;
+            break;
+        case 'l':
+            seconds = atoi(arg);
+            break;
+        case 'g':
+            signals = arg;
+            break;
+        case 'r':
+            reps = atoi(arg);
+            break;
+        case 's':
+            parse_axis(arg, &rates, 0);
+            break;
+        case 'p':
+            parse_axis(arg, &axes[0], 0);
+            break;
+        case 'm':
+            parse_axis(arg, &axes[1], 1);
+            break;
+        case 'b':
+            parse_axis(arg, &axes[2], 0);
+            break;
+        case 'B':
+            parse_axis(arg, &axes[3], 0);
+            break;
+        case 'v':
+            parse_axis(arg, &axes[4], 0);
+            break;
+        case 'e':
+            parse_axis(arg, &axes[5], 0);
+            break;
+        case 'd':
+            parse_axis(arg, &axes[6], 0);
+            break;
+        default:
+            usage();
+        }
+    }
+    if (reps < 1 || seconds < 0)
+        usage();
+    files = i;
+
+    if ((out = fopen(outname, "w")) == NULL) {
+        fprintf(stderr, "Failed to open output file: %s\n", outname);
+        return 1;
+    }
+    fprintf(out, "{\n  \"version\": ");
+    json_string(out, get_twolame_version());
+    fprintf(out, ",\n  \"repetitions\": %d,\n  \"results\": [", reps);
+
+    // the generated inputs, at each samplerate
+    snprintf(buf, sizeof(buf), "%s", signals);
+    for (signal = strtok(buf, ","); signal != NULL && seconds > 0; signal = strtok(NULL, ",")) {
+        for (i = 0; i < rates.count; i++) {
+            bench_audio *in = audio_synthetic(signal, rates.values[i], 2,
+                                              seconds * rates.values[i]);
+
+            if (in == NULL) {
+                failed++;
+                continue;
+            }
+            fprintf(stderr, "%s at %d Hz\n", in->name, in->samplerate);
+            failed += run_matrix(out, in, in->samplerate, axes, reps, &results, &rejected);
+            audio_free(in);
+        }
+    }
+
+    // the WAV files, at their own samplerate
+    for (i = files; i < argc; i++) {
+        bench_audio *in = audio_read_wav(argv[i], 0);
+
+        if (in == NULL) {
+            failed++;
+            continue;
+        }
+        fprintf(stderr, "%s\n", in->name);
+        failed += run_matrix(out, in, in->samplerate, axes, reps, &results, &rejected);
+        audio_free(in);
+    }
+
+    fprintf(out, "\n  ]\n}\n");
+    fclose(out);
+
+    // settings the encoder doesn't allow are expected; anything else going wrong is not
+    fprintf(stderr, "Wrote %d results to %s (%d rejected, %d failed)\n", results, outname,
+            rejected, failed);
+    return failed ? 1 : 0;
+}
+
+// vim:ts=4:sw=4:nowrap:
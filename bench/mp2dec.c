@@ -0,0 +1,343 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Reference Layer II decoder for the tolerance harness
+
+   The bit allocation tables are typed in from the standard rather than
+   taken from the encoder, so a mistake in one doesn't hide in the other.
+   Only the window is shared: the synthesis window D[i] of the standard is
+   the encoder's analysis window C[i] times 32.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#define FLOAT double
+#include "enwindow.h"
+#include "mp2dec.h"
+
+
+#define MP2DEC_PI   3.14159265358979
+
+
+struct mp2dec_struc {
+    double v[2][1024];          // synthesis filterbank history
+    int offset[2];
+    double n[64][32];           // synthesis matrixing
+};
+
+/* Bit reader over one frame */
+typedef struct mp2dec_bits_struc {
+    const unsigned char *buf;
+    long pos;
+    long len;                   // in bits
+} mp2dec_bits;
+
+
+static const int bitrates[2][15] = {
+    {0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160},     // MPEG-2 LSF
+    {0, 32, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384} // MPEG-1
+};
+
+static const int samplerates[2][3] = {
+    {22050, 24000, 16000},
+    {44100, 48000, 32000}
+};
+
+/*
+   Bit allocation (ISO 11172-3 Tables 3-B.2a to d, ISO 13818-3 Table B.1)
+
+   Each table is a list of runs of subbands that share the number of bits of
+   the allocation and the number of quantisation levels it picks.
+*/
+typedef struct mp2dec_alloc_struc {
+    int subbands;               // the number of subbands in this run, 0 at the end
+    int nbal;
+    int levels[16];             // by allocation, from 1
+} mp2dec_alloc;
+
+static const mp2dec_alloc alloc_a[] = {    // 27 subbands, high rates at 48 kHz
+    {3, 4, {3, 7, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 16383, 32767, 65535}},
+    {8, 4, {3, 5, 7, 9, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 65535}},
+    {12, 3, {3, 5, 7, 9, 15, 31, 65535}},
+    {4, 2, {3, 5, 65535}},
+    {0, 0, {0}}
+};
+
+static const mp2dec_alloc alloc_b[] = {    // 30 subbands, high rates at 32 and 44.1 kHz
+    {3, 4, {3, 7, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 16383, 32767, 65535}},
+    {8, 4, {3, 5, 7, 9, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 65535}},
+    {12, 3, {3, 5, 7, 9, 15, 31, 65535}},
+    {7, 2, {3, 5, 65535}},
+    {0, 0, {0}}
+};
+
+static const mp2dec_alloc alloc_c[] = {    // 8 subbands, low rates at 44.1 and 48 kHz
+    {2, 4, {3, 5, 9, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 16383, 32767}},
+    {6, 3, {3, 5, 9, 15, 31, 63, 127}},
+    {0, 0, {0}}
+};
+
+static const mp2dec_alloc alloc_d[] = {    // 12 subbands, low rates at 32 kHz
+    {2, 4, {3, 5, 9, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 16383, 32767}},
+    {10, 3, {3, 5, 9, 15, 31, 63, 127}},
+    {0, 0, {0}}
+};
+
+static const mp2dec_alloc alloc_lsf[] = {  // 30 subbands, MPEG-2 LSF
+    {4, 4, {3, 5, 7, 9, 15, 31, 63, 127, 255, 511, 1023, 2047, 4095, 8191, 16383}},
+    {7, 3, {3, 5, 9, 15, 31, 63, 127}},
+    {19, 2, {3, 5, 9}},
+    {0, 0, {0}}
+};
+
+
+
+mp2dec *mp2dec_new(void)
+{
+    mp2dec *dec = (mp2dec *) calloc(1, sizeof(mp2dec));
+    int i, k;
+
+    if (dec == NULL)
+        return NULL;
+    for (i = 0; i < 64; i++)
+        for (k = 0; k < 32; k++)
+            dec->n[i][k] = cos((16 + i) * (2 * k + 1) * MP2DEC_PI / 64.0);
+    return dec;
+}
+
+void mp2dec_free(mp2dec * dec)
+{
+    free(dec);
+}
+
+
+static unsigned int getbits(mp2dec_bits * bits, int n)
+{
+    unsigned int v = 0;
+
+    while (n--) {
+        v <<= 1;
+        if (bits->pos < bits->len)
+            v |= (bits->buf[bits->pos >> 3] >> (7 - (bits->pos & 7))) & 1;
+        bits->pos++;
+    }
+    return v;
+}
+
+/* Subband synthesis of 32 samples (ISO 11172-3 Figure A.2) */
+static void synthesis(mp2dec * dec, int ch, const double sample[32], float *out)
+{
+    double *v;
+    int i, j, k;
+
+    dec->offset[ch] = (dec->offset[ch] + 1024 - 64) & 1023;
+    v = dec->v[ch];
+    for (i = 0; i < 64; i++) {
+        double sum = 0.0;
+
+        for (k = 0; k < 32; k++)
+            sum += dec->n[i][k] * sample[k];
+        v[(dec->offset[ch] + i) & 1023] = sum;
+    }
+
+    for (j = 0; j < 32; j++) {
+        double sum = 0.0;
+
+        for (i = 0; i < 8; i++) {
+            sum += v[(dec->offset[ch] + i * 128 + j) & 1023] * 32.0 * enwindow[i * 64 + j];
+            sum += v[(dec->offset[ch] + i * 128 + 96 + j) & 1023] * 32.0 * enwindow[i * 64 + 32 + j];
+        }
+        out[j] = (float) sum;
+    }
+}
+
+int mp2dec_decode_frame(mp2dec * dec, const unsigned char *buf, int len,
+                        float out[2][MP2DEC_SAMPLES], int *channels, int *samplerate)
+{
+    unsigned int alloc[2][32], scfsi[2][32];
+    double scale[2][3][32];
+    const mp2dec_alloc *table;
+    const int *levels[32];
+    int nbal[32];
+    mp2dec_bits bits;
+    int version, lsf, bitrate_index, sfreq, padding, protection, mode, mode_ext;
+    int nch, bound, sblimit, bytes, kbps;
+    int sb, ch, gr, s, i;
+
+    if (len < 4 || buf[0] != 0xff || (buf[1] & 0xe0) != 0xe0)
+        return -1;
+
+    bits.buf = buf;
+    bits.pos = 11;
+    bits.len = 32;
+    version = getbits(&bits, 2);        // 3 is MPEG-1, 2 is MPEG-2 (2.5 isn't supported)
+    if (version < 2 || getbits(&bits, 2) != 2)  // Layer II
+        return -1;
+    lsf = version == 2;
+    protection = !getbits(&bits, 1);
+    bitrate_index = getbits(&bits, 4);
+    sfreq = getbits(&bits, 2);
+    padding = getbits(&bits, 1);
+    getbits(&bits, 1);          // private
+    mode = getbits(&bits, 2);
+    mode_ext = getbits(&bits, 2);
+    if (bitrate_index == 0 || bitrate_index == 15 || sfreq == 3)
+        return -1;
+
+    kbps = bitrates[!lsf][bitrate_index];
+    *samplerate = samplerates[!lsf][sfreq];
+    bytes = 144000 * kbps / *samplerate + padding;
+    if (len < bytes)
+        return 0;
+
+    nch = mode == 3 ? 1 : 2;
+    *channels = nch;
+    bound = mode == 1 ? (mode_ext + 1) * 4 : 32;
+
+    // pick the table from the bitrate per channel
+    if (lsf) {
+        table = alloc_lsf;
+    } else {
+        int per_channel = kbps / nch;
+
+        if ((sfreq == 1 && per_channel >= 56) || (per_channel >= 56 && per_channel <= 80))
+            table = alloc_a;
+        else if (sfreq != 1 && per_channel >= 96)
+            table = alloc_b;
+        else if (sfreq != 2 && per_channel <= 48)
+            table = alloc_c;
+        else
+            table = alloc_d;
+    }
+    for (sblimit = 0; table->subbands > 0; table++) {
+        for (i = 0; i < table->subbands; i++, sblimit++) {
+            nbal[sblimit] = table->nbal;
+            levels[sblimit] = table->levels;
+        }
+    }
+    if (bound > sblimit)
+        bound = sblimit;
+
+    bits.len = bytes * 8L;
+    bits.pos = protection ? 48 : 32;    // the CRC isn't checked
+
+    memset(alloc, 0, sizeof(alloc));
+    for (sb = 0; sb < sblimit; sb++) {
+        if (sb < bound) {
+            for (ch = 0; ch < nch; ch++)
+                alloc[ch][sb] = getbits(&bits, nbal[sb]);
+        } else {
+            alloc[0][sb] = alloc[1][sb] = getbits(&bits, nbal[sb]);
+        }
+    }
+    for (sb = 0; sb < sblimit; sb++)
+        for (ch = 0; ch < nch; ch++)
+            if (alloc[ch][sb])
+                scfsi[ch][sb] = getbits(&bits, 2);
+
+    memset(scale, 0, sizeof(scale));
+    for (sb = 0; sb < sblimit; sb++) {
+        for (ch = 0; ch < nch; ch++) {
+            int index[3];
+
+            if (!alloc[ch][sb])
+                continue;
+            switch (scfsi[ch][sb]) {
+            case 0:
+                index[0] = getbits(&bits, 6);
+                index[1] = getbits(&bits, 6);
+                index[2] = getbits(&bits, 6);
+                break;
+            case 1:
+                index[0] = index[1] = getbits(&bits, 6);
+                index[2] = getbits(&bits, 6);
+                break;
+            case 2:
+                index[0] = index[1] = index[2] = getbits(&bits, 6);
+                break;
+            default:
+                index[0] = getbits(&bits, 6);
+                index[1] = index[2] = getbits(&bits, 6);
+                break;
+            }
+            for (i = 0; i < 3; i++)
+                scale[ch][i][sb] = 2.0 * pow(2.0, -index[i] / 3.0);
+        }
+    }
+
+    // twelve granules of three samples in each subband
+    for (gr = 0; gr < 12; gr++) {
+        double sample[2][3][32];
+
+        memset(sample, 0, sizeof(sample));
+        for (sb = 0; sb < sblimit; sb++) {
+            double level[3];
+
+            for (ch = 0; ch < nch; ch++) {
+                if (!alloc[ch][sb])
+                    continue;
+
+                // above the bound the right channel reuses the samples of the left
+                // (with its own scalefactors)
+                if (sb < bound || ch == 0) {
+                    int n = levels[sb][alloc[ch][sb] - 1];
+                    int code[3];
+
+                    if (n == 3 || n == 5 || n == 9) {
+                        // three samples grouped into one codeword
+                        int c = getbits(&bits, n == 3 ? 5 : n == 5 ? 7 : 10);
+
+                        for (s = 0; s < 3; s++) {
+                            code[s] = c % n;
+                            c /= n;
+                        }
+                    } else {
+                        int nb = 0;
+
+                        while ((1 << nb) < n + 1)
+                            nb++;
+                        for (s = 0; s < 3; s++)
+                            code[s] = getbits(&bits, nb);
+                    }
+
+                    // the levels are evenly spaced across (-1, 1)
+                    for (s = 0; s < 3; s++)
+                        level[s] = (double) (2 * code[s] - (n - 1)) / n;
+                }
+
+                for (s = 0; s < 3; s++)
+                    sample[ch][s][sb] = level[s] * scale[ch][gr / 4][sb];
+            }
+        }
+
+        for (ch = 0; ch < nch; ch++)
+            for (s = 0; s < 3; s++)
+                synthesis(dec, ch, sample[ch][s], out[ch] + (gr * 3 + s) * 32);
+    }
+
+    return bytes;
+}
+
+
+// vim:ts=4:sw=4:nowrap:
@@ -0,0 +1,46 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef TWOLAME_BENCH_MP2DEC_H
+#define TWOLAME_BENCH_MP2DEC_H
+
+#define MP2DEC_SAMPLES  (1152)  // Samples per channel in each frame
+
+/* A plain ISO 11172-3 / 13818-3 Layer II decoder (no free format),
+   written from the standard and sharing no code with the encoder */
+typedef struct mp2dec_struc mp2dec;
+
+mp2dec *mp2dec_new(void);
+void mp2dec_free(mp2dec * dec);
+
+/*
+    Decode the frame at the start of buf into out (full scale is 1.0)
+    Returns the number of bytes used, 0 if buf doesn't hold a whole frame,
+    or -1 if there is no valid header at the start of buf
+*/
+int mp2dec_decode_frame(mp2dec * dec, const unsigned char *buf, int len,
+                        float out[2][MP2DEC_SAMPLES], int *channels, int *samplerate);
+
+#endif
+
+
+// vim:ts=4:sw=4:nowrap:
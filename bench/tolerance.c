@@ -0,0 +1,712 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Tolerance harness: is a faster encoder still close enough?
+
+   Each input is encoded while the subband samples, scalefactors, SMRs and
+   bit allocation of every frame are traced. A reference run writes the
+   traces and the MP2 stream to a directory; a later run (of a build with
+   faster or reordered arithmetic, which needn't be bit exact) is compared
+   with it frame by frame, against a tolerance for each. Both streams are
+   also decoded with the reference decoder in mp2dec.c, and the SNR and
+   segmental SNR against the input may only drop so far.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "twolame.h"
+#include "common.h"
+#include "audio.h"
+#include "mp2dec.h"
+
+
+#define TOL_SECONDS         (5)     // Length of the generated inputs
+#define TOL_CHUNK           (4 * TWOLAME_SAMPLES_PER_FRAME)   // Samples passed in per call
+#define TOL_MP2_BYTES       (16384)
+#define TOL_DELAY_MAX       (TWOLAME_SAMPLES_PER_FRAME)         // Longest delay searched for
+#define TOL_SEGMENT         (TWOLAME_SAMPLES_PER_FRAME)
+#define TOL_SILENCE         (1e-6)  // Segments quieter than -60 dBFS don't count
+#define TOL_SEGMENT_MIN_DB  (-10.0)
+#define TOL_SEGMENT_MAX_DB  (60.0)
+#define TOL_MAX_DB          (120.0)
+
+static const char trace_magic[8] = { 'T', 'L', 'T', 'R', 'A', 'C', 'E', '1' };
+
+
+/* What is traced of each frame */
+typedef struct tol_frame_struc {
+    float sb_sample[2][3][SCALE_BLOCK][SBLIMIT];
+    float smr[2][SBLIMIT];
+    unsigned char scalar[2][3][SBLIMIT];
+    unsigned char bit_alloc[2][SBLIMIT];
+} tol_frame;
+
+/* One encode of one input */
+typedef struct tol_run_struc {
+    int channels;
+    int sblimit;
+    int frames;
+    int frames_alloc;
+    tol_frame *frame;
+    unsigned char *mp2;
+    long mp2_bytes;
+    long mp2_alloc;
+} tol_run;
+
+/* How far the run may be from the reference */
+typedef struct tol_limits_struc {
+    double sb_sample;           // absolute, full scale is 1.0
+    int scalar;                 // scalefactor index steps
+    double smr;                 // dB
+    double bit_alloc;           // percent of the allocations that differ
+    double snr;                 // dB lost
+} tol_limits;
+
+/* Quality of a decoded run */
+typedef struct tol_quality_struc {
+    int delay;
+    double snr;
+    double segmental_snr;
+} tol_quality;
+
+
+
+static void run_free(tol_run * run)
+{
+    free(run->frame);
+    free(run->mp2);
+    memset(run, 0, sizeof(tol_run));
+}
+
+static void trace_frame(const twolame_options * glopts, void *user_data)
+{
+    tol_run *run = (tol_run *) user_data;
+    tol_frame *frame;
+    int ch, gr, bl, sb;
+
+    if (run->frames == run->frames_alloc) {
+        int alloc = run->frames_alloc ? 2 * run->frames_alloc : 256;
+        tol_frame *more = (tol_frame *) realloc(run->frame, alloc * sizeof(tol_frame));
+
+        if (more == NULL)
+            return;
+        run->frame = more;
+        run->frames_alloc = alloc;
+    }
+
+    frame = &run->frame[run->frames++];
+    memset(frame, 0, sizeof(tol_frame));
+    run->channels = glopts->num_channels_out;
+    run->sblimit = glopts->sblimit;
+
+    for (ch = 0; ch < 2; ch++) {
+        for (gr = 0; gr < 3; gr++)
+            for (bl = 0; bl < SCALE_BLOCK; bl++)
+                for (sb = 0; sb < SBLIMIT; sb++)
+                    frame->sb_sample[ch][gr][bl][sb] = (float) (*glopts->sb_sample)[ch][gr][bl][sb];
+        for (sb = 0; sb < SBLIMIT; sb++) {
+            frame->smr[ch][sb] = (float) glopts->smr[ch][sb];
+            frame->bit_alloc[ch][sb] = (unsigned char) glopts->bit_alloc[ch][sb];
+            for (gr = 0; gr < 3; gr++)
+                frame->scalar[ch][gr][sb] = (unsigned char) glopts->scalar[ch][gr][sb];
+        }
+    }
+}
+
+static int append_mp2(tol_run * run, const unsigned char *data, int bytes)
+{
+    if (run->mp2_bytes + bytes > run->mp2_alloc) {
+        long alloc = run->mp2_alloc ? 2 * run->mp2_alloc : 65536;
+        unsigned char *more;
+
+        while (alloc < run->mp2_bytes + bytes)
+            alloc *= 2;
+        if ((more = (unsigned char *) realloc(run->mp2, alloc)) == NULL)
+            return -1;
+        run->mp2 = more;
+        run->mp2_alloc = alloc;
+    }
+    memcpy(run->mp2 + run->mp2_bytes, data, bytes);
+    run->mp2_bytes += bytes;
+    return 0;
+}
+
+/*
+    Encode the whole input, tracing every frame
+    Returns 0, or -1 if the encoder rejected the settings or failed
+*/
+static int encode(const bench_audio * in, int psymodel, int bitrate, tol_run * run)
+{
+    static unsigned char mp2[TOL_MP2_BYTES];
+    unsigned int elapsed_time_twolame[24], elapsed_time_psycho_3[50];
+    twolame_options *encopts = twolame_init();
+    bit_stream bs;
+    int pos, bytes = 0;
+
+    memset(run, 0, sizeof(tol_run));
+    if (encopts == NULL)
+        return -1;
+
+    twolame_set_verbosity(encopts, 0);
+    twolame_set_num_channels(encopts, in->channels);
+    twolame_set_in_samplerate(encopts, in->samplerate);
+    twolame_set_out_samplerate(encopts, in->samplerate);
+    twolame_set_psymodel(encopts, psymodel);
+    if (bitrate > 0)
+        twolame_set_bitrate(encopts, bitrate);
+    if (twolame_init_params(encopts) != 0) {
+        fprintf(stderr, "%s: the encoder rejected the settings\n", in->name);
+        twolame_close(&encopts);
+        return -1;
+    }
+    encopts->frame_trace = trace_frame;
+    encopts->frame_trace_data = run;
+
+    memset(elapsed_time_twolame, 0, sizeof(elapsed_time_twolame));
+    memset(elapsed_time_psycho_3, 0, sizeof(elapsed_time_psycho_3));
+    for (pos = 0; pos < in->samples && bytes >= 0; pos += TOL_CHUNK) {
+        int count = in->samples - pos < TOL_CHUNK ? in->samples - pos : TOL_CHUNK;
+
+        if (in->fpcm != NULL)
+            bytes = twolame_encode_buffer_float32_interleaved(encopts,
+                                                              in->fpcm + pos * in->channels,
+                                                              count, mp2, sizeof(mp2),
+                                                              elapsed_time_twolame,
+                                                              elapsed_time_psycho_3);
+        else
+            bytes = twolame_encode_buffer_interleaved(encopts, in->pcm + pos * in->channels,
+                                                      count, mp2, sizeof(mp2), &bs,
+                                                      elapsed_time_twolame, elapsed_time_psycho_3);
+        if (bytes > 0 && append_mp2(run, mp2, bytes) != 0)
+            bytes = -1;
+    }
+    if (bytes >= 0) {
+        bytes = twolame_encode_flush(encopts, mp2, sizeof(mp2), &bs, elapsed_time_twolame,
+                                     elapsed_time_psycho_3);
+        if (bytes > 0 && append_mp2(run, mp2, bytes) != 0)
+            bytes = -1;
+    }
+    twolame_close(&encopts);
+
+    if (bytes < 0 || run->frames == 0) {
+        fprintf(stderr, "%s: encoding failed\n", in->name);
+        run_free(run);
+        return -1;
+    }
+    return 0;
+}
+
+
+
+/*
+  Reference files: <dir>/<input>-p<model>-b<kbps>.trace and .mp2
+*/
+
+static void reference_name(char *name, size_t size, const char *dir, const bench_audio * in,
+                           int psymodel, int bitrate, const char *ext)
+{
+    snprintf(name, size, "%s/%s-p%d-b%d.%s", dir, in->name, psymodel, bitrate, ext);
+}
+
+static int write_reference(const char *dir, const bench_audio * in, int psymodel, int bitrate,
+                           const tol_run * run)
+{
+    char name[1024];
+    int header[3];
+    FILE *file;
+
+    // the traces are written as they are in memory, so they only compare on the same kind of machine
+    reference_name(name, sizeof(name), dir, in, psymodel, bitrate, "trace");
+    if ((file = fopen(name, "wb")) == NULL) {
+        fprintf(stderr, "Failed to open reference file: %s\n", name);
+        return -1;
+    }
+    header[0] = run->channels;
+    header[1] = run->sblimit;
+    header[2] = run->frames;
+    if (fwrite(trace_magic, sizeof(trace_magic), 1, file) != 1
+        || fwrite(header, sizeof(header), 1, file) != 1
+        || fwrite(run->frame, sizeof(tol_frame), run->frames, file) != (size_t) run->frames) {
+        fprintf(stderr, "Failed to write reference file: %s\n", name);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+
+    reference_name(name, sizeof(name), dir, in, psymodel, bitrate, "mp2");
+    if ((file = fopen(name, "wb")) == NULL) {
+        fprintf(stderr, "Failed to open reference file: %s\n", name);
+        return -1;
+    }
+    if (fwrite(run->mp2, 1, run->mp2_bytes, file) != (size_t) run->mp2_bytes) {
+        fprintf(stderr, "Failed to write reference file: %s\n", name);
+        fclose(file);
+        return -1;
+    }
+    fclose(file);
+    return 0;
+}
+
+/*
+    Load the reference run of an input
+    Returns 0, 1 if there isn't one, or -1 if it can't be read
+*/
+static int read_reference(const char *dir, const bench_audio * in, int psymodel, int bitrate,
+                          tol_run * run)
+{
+    char name[1024], magic[sizeof(trace_magic)];
+    int header[3];
+    FILE *file;
+    long size;
+
+    memset(run, 0, sizeof(tol_run));
+    reference_name(name, sizeof(name), dir, in, psymodel, bitrate, "trace");
+    if ((file = fopen(name, "rb")) == NULL)
+        return 1;
+    if (fread(magic, sizeof(magic), 1, file) != 1 || memcmp(magic, trace_magic, sizeof(magic))
+        || fread(header, sizeof(header), 1, file) != 1 || header[2] < 1) {
+        fprintf(stderr, "%s: not a trace file\n", name);
+        fclose(file);
+        return -1;
+    }
+    run->channels = header[0];
+    run->sblimit = header[1];
+    run->frames = run->frames_alloc = header[2];
+    run->frame = (tol_frame *) malloc(run->frames * sizeof(tol_frame));
+    if (run->frame == NULL
+        || fread(run->frame, sizeof(tol_frame), run->frames, file) != (size_t) run->frames) {
+        fprintf(stderr, "%s: failed to read the trace\n", name);
+        fclose(file);
+        run_free(run);
+        return -1;
+    }
+    fclose(file);
+
+    reference_name(name, sizeof(name), dir, in, psymodel, bitrate, "mp2");
+    if ((file = fopen(name, "rb")) == NULL) {
+        run_free(run);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    run->mp2 = (unsigned char *) malloc(size > 0 ? size : 1);
+    run->mp2_bytes = run->mp2_alloc = size;
+    if (run->mp2 == NULL || size <= 0 || fread(run->mp2, 1, size, file) != (size_t) size) {
+        fprintf(stderr, "%s: failed to read the stream\n", name);
+        fclose(file);
+        run_free(run);
+        return -1;
+    }
+    fclose(file);
+    return 0;
+}
+
+
+
+/*
+  Quality after decoding
+*/
+
+static double input_sample(const bench_audio * in, int i, int ch)
+{
+    if (in->fpcm != NULL)
+        return in->fpcm[i * in->channels + ch];
+    return in->pcm[i * in->channels + ch] / 32768.0;
+}
+
+static double ratio_db(double signal, double noise, double max_db)
+{
+    double db;
+
+    if (noise <= 0.0)
+        return max_db;
+    db = 10.0 * log10(signal / noise + 1e-30);
+    return db > max_db ? max_db : db;
+}
+
+/*
+    Decode the run, and measure it against the input delayed by delay samples
+    (or, if delay is -1, by the delay that fits best)
+    Returns 0, or -1 if the stream doesn't decode
+*/
+static int measure(const bench_audio * in, const tol_run * run, int delay, tol_quality * quality)
+{
+    static float frame[2][MP2DEC_SAMPLES];
+    mp2dec *dec = mp2dec_new();
+    float *out = NULL;
+    long pos = 0;
+    int samples = 0, channels = 0, samplerate = 0, nch, window, count, i, ch, d;
+    double best = -1.0, signal = 0.0, noise = 0.0, segments = 0.0;
+    int used = 0, out_alloc = 0;
+
+    memset(quality, 0, sizeof(tol_quality));
+    if (dec == NULL)
+        return -1;
+
+    while (pos < run->mp2_bytes) {
+        int bytes = mp2dec_decode_frame(dec, run->mp2 + pos, (int) (run->mp2_bytes - pos), frame,
+                                        &channels, &samplerate);
+
+        if (bytes <= 0)
+            break;
+        if (samples + MP2DEC_SAMPLES > out_alloc) {
+            float *more;
+
+            out_alloc = out_alloc ? 2 * out_alloc : 256 * MP2DEC_SAMPLES;
+            if ((more = (float *) realloc(out, (size_t) out_alloc * 2 * sizeof(float))) == NULL)
+                break;
+            out = more;
+        }
+        for (i = 0; i < MP2DEC_SAMPLES; i++) {
+            out[(samples + i) * 2] = frame[0][i];
+            out[(samples + i) * 2 + 1] = frame[channels - 1][i];
+        }
+        samples += MP2DEC_SAMPLES;
+        pos += bytes;
+    }
+    mp2dec_free(dec);
+    if (pos < run->mp2_bytes || samples == 0 || samplerate != in->samplerate) {
+        fprintf(stderr, "%s: the stream doesn't decode\n", in->name);
+        free(out);
+        return -1;
+    }
+
+    // finding the delay needs an input that doesn't repeat itself, like noise
+    nch = in->channels < channels ? in->channels : channels;
+    window = in->samples < samples - TOL_DELAY_MAX ? in->samples : samples - TOL_DELAY_MAX;
+    quality->delay = delay;
+    for (d = 0; d <= TOL_DELAY_MAX && window > 0 && delay < 0; d++) {
+        double error = 0.0;
+
+        for (i = 0; i < window && (best < 0.0 || error < best); i++) {
+            for (ch = 0; ch < nch; ch++) {
+                double e = input_sample(in, i, ch) - out[(i + d) * 2 + ch];
+                error += e * e;
+            }
+        }
+        if (best < 0.0 || error < best) {
+            best = error;
+            quality->delay = d;
+        }
+    }
+    if (quality->delay < 0 || quality->delay >= samples) {
+        fprintf(stderr, "%s: no delay found\n", in->name);
+        free(out);
+        return -1;
+    }
+
+    count = in->samples < samples - quality->delay ? in->samples : samples - quality->delay;
+    for (i = 0; i < count; i += TOL_SEGMENT) {
+        double seg_signal = 0.0, seg_noise = 0.0;
+        int n = count - i < TOL_SEGMENT ? count - i : TOL_SEGMENT, j;
+
+        for (j = i; j < i + n; j++) {
+            for (ch = 0; ch < nch; ch++) {
+                double x = input_sample(in, j, ch);
+                double e = x - out[(j + quality->delay) * 2 + ch];
+
+                seg_signal += x * x;
+                seg_noise += e * e;
+            }
+        }
+        signal += seg_signal;
+        noise += seg_noise;
+
+        if (seg_signal > TOL_SILENCE * n * nch) {
+            double db = ratio_db(seg_signal, seg_noise, TOL_SEGMENT_MAX_DB);
+
+            segments += db < TOL_SEGMENT_MIN_DB ? TOL_SEGMENT_MIN_DB : db;
+            used++;
+        }
+    }
+    quality->snr = ratio_db(signal, noise, TOL_MAX_DB);
+    quality->segmental_snr = used > 0 ? segments / used : TOL_SEGMENT_MAX_DB;
+
+    free(out);
+    return 0;
+}
+
+
+
+/*
+  Comparison with the reference
+*/
+
+static int report(const char *what, const char *now, const char *limit, int failed)
+{
+    printf("  %-16s %-30s %s%s\n", what, now, limit, failed ? "  FAIL" : "");
+    return failed;
+}
+
+/*
+    Compare a run with the reference run of the same input
+    Returns the number of measures out of tolerance
+*/
+static int compare(const bench_audio * in, const tol_run * ref, const tol_run * run, int delay,
+                   const tol_limits * limits)
+{
+    double sb_error = 0.0, smr_error = 0.0;
+    long scalars = 0, scalars_differ = 0, allocs = 0, allocs_differ = 0;
+    int scalar_error = 0, frames, f, ch, gr, bl, sb, failed = 0;
+    tol_quality ref_quality, run_quality;
+    char now[64], limit[64];
+
+    frames = ref->frames < run->frames ? ref->frames : run->frames;
+    printf("%s (%d frames)\n", in->name, frames);
+    snprintf(now, sizeof(now), "%d now, %d before", run->frames, ref->frames);
+    if (ref->frames != run->frames || ref->channels != run->channels
+        || ref->sblimit != run->sblimit)
+        failed += report("frames", now, "must match", 1);
+
+    for (f = 0; f < frames; f++) {
+        const tol_frame *a = &ref->frame[f], *b = &run->frame[f];
+
+        for (ch = 0; ch < run->channels; ch++) {
+            for (gr = 0; gr < 3; gr++)
+                for (bl = 0; bl < SCALE_BLOCK; bl++)
+                    for (sb = 0; sb < SBLIMIT; sb++) {
+                        double e = fabs(a->sb_sample[ch][gr][bl][sb] - b->sb_sample[ch][gr][bl][sb]);
+                        if (e > sb_error)
+                            sb_error = e;
+                    }
+
+            for (sb = 0; sb < run->sblimit; sb++) {
+                double e = fabs(a->smr[ch][sb] - b->smr[ch][sb]);
+
+                if (e > smr_error)
+                    smr_error = e;
+                allocs++;
+                allocs_differ += a->bit_alloc[ch][sb] != b->bit_alloc[ch][sb];
+                for (gr = 0; gr < 3; gr++) {
+                    int step = abs(a->scalar[ch][gr][sb] - b->scalar[ch][gr][sb]);
+
+                    if (step > scalar_error)
+                        scalar_error = step;
+                    scalars++;
+                    scalars_differ += step != 0;
+                }
+            }
+        }
+    }
+
+    snprintf(now, sizeof(now), "max error %.3g", sb_error);
+    snprintf(limit, sizeof(limit), "(limit %.3g)", limits->sb_sample);
+    failed += report("subband samples", now, limit, sb_error > limits->sb_sample);
+
+    snprintf(now, sizeof(now), "max %d steps, %.2f%% differ", scalar_error,
+             scalars ? 100.0 * scalars_differ / scalars : 0.0);
+    snprintf(limit, sizeof(limit), "(limit %d)", limits->scalar);
+    failed += report("scalefactors", now, limit, scalar_error > limits->scalar);
+
+    snprintf(now, sizeof(now), "max error %.3f dB", smr_error);
+    snprintf(limit, sizeof(limit), "(limit %.3f dB)", limits->smr);
+    failed += report("SMR", now, limit, smr_error > limits->smr);
+
+    snprintf(now, sizeof(now), "%.2f%% differ", allocs ? 100.0 * allocs_differ / allocs : 0.0);
+    snprintf(limit, sizeof(limit), "(limit %.2f%%)", limits->bit_alloc);
+    failed += report("bit allocation", now, limit,
+                     allocs && 100.0 * allocs_differ / allocs > limits->bit_alloc);
+
+    if (measure(in, ref, delay, &ref_quality) != 0
+        || measure(in, run, delay, &run_quality) != 0)
+        return failed + 1;
+
+    snprintf(now, sizeof(now), "%.2f dB, %.2f dB before", run_quality.snr, ref_quality.snr);
+    snprintf(limit, sizeof(limit), "(limit -%.2f dB)", limits->snr);
+    failed += report("SNR", now, limit, run_quality.snr < ref_quality.snr - limits->snr);
+
+    snprintf(now, sizeof(now), "%.2f dB, %.2f dB before", run_quality.segmental_snr,
+             ref_quality.segmental_snr);
+    failed += report("segmental SNR", now, limit,
+                     run_quality.segmental_snr < ref_quality.segmental_snr - limits->snr);
+
+    return failed;
+}
+
+/*
+    Encode one input, and record it, compare it or just measure it
+    Returns the number of failures
+*/
+static int run_input(const bench_audio * in, int psymodel, int bitrate, int delay,
+                     const char *save, const char *reference, const tol_limits * limits)
+{
+    tol_run run, ref;
+    tol_quality quality;
+    int failed = 0, found = 1;
+
+    if (encode(in, psymodel, bitrate, &run) != 0)
+        return 1;
+
+    if (reference != NULL) {
+        found = read_reference(reference, in, psymodel, bitrate, &ref);
+        if (found == 0) {
+            failed += compare(in, &ref, &run, delay, limits);
+            run_free(&ref);
+        } else if (found < 0) {
+            failed++;
+        }
+    }
+
+    if (found > 0) {
+        if (measure(in, &run, delay, &quality) != 0) {
+            failed++;
+        } else {
+            printf("%s (%d frames): SNR %.2f dB, segmental SNR %.2f dB\n", in->name, run.frames,
+                   quality.snr, quality.segmental_snr);
+        }
+        if (reference != NULL && save == NULL) {
+            printf("  no reference yet, so this is the reference now\n");
+            failed += write_reference(reference, in, psymodel, bitrate, &run) != 0;
+        }
+    }
+    if (save != NULL)
+        failed += write_reference(save, in, psymodel, bitrate, &run) != 0;
+
+    run_free(&run);
+    return failed;
+}
+
+
+/*
+    Find the delay through the encoder and decoder, from a second of noise
+    Returns the delay in samples, or -1 on error
+*/
+static int find_delay(int psymodel, int bitrate)
+{
+    bench_audio *in = audio_synthetic("noise", 44100, 2, 44100);
+    tol_quality quality;
+    tol_run run;
+    int delay = -1;
+
+    if (in == NULL)
+        return -1;
+    if (encode(in, psymodel, bitrate, &run) == 0) {
+        if (measure(in, &run, -1, &quality) == 0)
+            delay = quality.delay;
+        run_free(&run);
+    }
+    audio_free(in);
+    return delay;
+}
+
+
+static void usage(void)
+{
+    fprintf(stderr, "Usage: twolame_tolerance [options] [file.wav ...]\n\n");
+    fprintf(stderr, "Encodes generated inputs and each WAV file, tracing every frame, and\n");
+    fprintf(stderr, "checks the result against a reference run of another build.\n\n");
+    fprintf(stderr, "  -o dir      write the traces and streams to dir as the reference\n");
+    fprintf(stderr, "  -c dir      compare with the reference in dir, and fail when out of\n");
+    fprintf(stderr, "              tolerance (inputs without a reference are written to it)\n");
+    fprintf(stderr, "  -p model    psychoacoustic model (default 3)\n");
+    fprintf(stderr, "  -b kbps     bitrate (default: the encoder's)\n");
+    fprintf(stderr, "  -l seconds  length of the generated inputs (default %d, 0 for none)\n",
+            TOL_SECONDS);
+    fprintf(stderr, "  -g signals  generated inputs (default music,transients)\n");
+    fprintf(stderr, "Tolerances:\n");
+    fprintf(stderr, "  -s error    subband samples, absolute (default 1e-4)\n");
+    fprintf(stderr, "  -f steps    scalefactor indices (default 1)\n");
+    fprintf(stderr, "  -m dB       SMR (default 1.0)\n");
+    fprintf(stderr, "  -a percent  bit allocations that may differ (default 5)\n");
+    fprintf(stderr, "  -q dB       loss of SNR and segmental SNR after decoding (default 0.5)\n");
+    exit(1);
+}
+
+int main(int argc, char **argv)
+{
+    const char *save = NULL, *reference = NULL, *signals = "music,transients";
+    int psymodel = 3, bitrate = 0, seconds = TOL_SECONDS, delay, errors = 0;
+    tol_limits limits = { 1e-4, 1, 1.0, 5.0, 0.5 };
+    char buf[256];
+    char *signal;
+    int i;
+
+    for (i = 1; i < argc && argv[i][0] == '-'; i++) {
+        if (i + 1 >= argc)
+            usage();
+        if (!strcmp(argv[i], "-o"))
+            save = argv[++i];
+        else if (!strcmp(argv[i], "-c"))
+            reference = argv[++i];
+        else if (!strcmp(argv[i], "-p"))
+            psymodel = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-b"))
+            bitrate = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-l"))
+            seconds = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-g"))
+            signals = argv[++i];
+        else if (!strcmp(argv[i], "-s"))
+            limits.sb_sample = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-f"))
+            limits.scalar = atoi(argv[++i]);
+        else if (!strcmp(argv[i], "-m"))
+            limits.smr = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-a"))
+            limits.bit_alloc = atof(argv[++i]);
+        else if (!strcmp(argv[i], "-q"))
+            limits.snr = atof(argv[++i]);
+        else
+            usage();
+    }
+    if (seconds < 0)
+        usage();
+
+    printf("twolame_tolerance: libtwolame version %s, psychoacoustic model %d\n",
+           get_twolame_version(), psymodel);
+    if ((delay = find_delay(psymodel, bitrate)) < 0)
+        return 1;
+    printf("Delay through the encoder and decoder: %d samples\n", delay);
+
+    snprintf(buf, sizeof(buf), "%s", signals);
+    for (signal = strtok(buf, ","); signal != NULL && seconds > 0; signal = strtok(NULL, ",")) {
+        bench_audio *in = audio_synthetic(signal, 44100, 2, seconds * 44100);
+
+        if (in == NULL) {
+            errors++;
+            continue;
+        }
+        errors += run_input(in, psymodel, bitrate, delay, save, reference, &limits);
+        audio_free(in);
+    }
+
+    for (; i < argc; i++) {
+        bench_audio *in = audio_read_wav(argv[i], 0);
+
+        if (in == NULL) {
+            errors++;
+            continue;
+        }
+        errors += run_input(in, psymodel, bitrate, delay, save, reference, &limits);
+        audio_free(in);
+    }
+
+    if (errors)
+        printf("%d measures out of tolerance or failed\n", errors);
+    return errors ? 1 : 0;
+}
+
+// vim:ts=4:sw=4:nowrap:
@@ -0,0 +1,374 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Reader and writer threads
+
+   A reader thread keeps up to depth blocks of PCM audio read ahead of the
+   encoder, and a writer thread writes out up to depth buffers of MP2 audio
+   behind it, so that the encoder is never left waiting for the disk (or the
+   network). Blocks come back out of both rings in the order they went in.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
+
+#include <twolame.h>
+#include <sndfile.h>
+#include "frontend.h"
+
+
+#ifdef HAVE_PTHREAD_H
+
+typedef struct {
+    void *pcm;                  // AUDIO_BUF_SIZE samples (16-bit or float)
+    const void *audio;          // where the samples of the block really are
+    unsigned char *mp2;         // MP2_BUF_SIZE bytes
+    int size;                   // samples per channel, or bytes of MP2 audio
+} io_slot;
+
+typedef struct {
+    io_slot *slot;
+    int head;                   // next slot to fill
+    int tail;                   // next slot to empty
+    int count;                  // filled slots (including one being emptied)
+    pthread_cond_t not_full;
+    pthread_cond_t not_empty;
+} io_ring;
+
+struct async_io_struc {
+    int slots;                  // depth, and one more that is being worked on
+    io_ring input;
+    io_ring output;
+    pthread_mutex_t lock;
+    pthread_t reader;
+    pthread_t writer;
+
+    async_io_read_func read_func;
+    void *user_data;
+    FILE *outputfile;
+
+    int holding;                // the encoder has the tail of the input ring
+    int end_of_input;
+    int stop;
+    int write_errno;            // errno from the first failed write, or 0
+};
+
+
+static void *reader_thread(void *arg)
+{
+    async_io *io = (async_io *) arg;
+    io_ring *ring = &io->input;
+    int size;
+
+    do {
+        io_slot *slot;
+
+        pthread_mutex_lock(&io->lock);
+        while (ring->count == io->slots && !io->stop)
+            pthread_cond_wait(&ring->not_full, &io->lock);
+        if (io->stop) {
+            pthread_mutex_unlock(&io->lock);
+            break;
+        }
+        slot = &ring->slot[ring->head];
+        pthread_mutex_unlock(&io->lock);
+
+        // the encoder never touches the slot at the head, so read without the lock
+        size = io->read_func(io->user_data, slot->pcm, &slot->audio);
+
+        pthread_mutex_lock(&io->lock);
+        slot->size = size;
+        ring->head = (ring->head + 1) % io->slots;
+        ring->count++;
+        pthread_cond_signal(&ring->not_empty);
+        pthread_mutex_unlock(&io->lock);
+    } while (size > 0);
+
+    return NULL;
+}
+
+static void *writer_thread(void *arg)
+{
+    async_io *io = (async_io *) arg;
+    io_ring *ring = &io->output;
+
+    for (;;) {
+        io_slot *slot;
+        int failed, write_errno = 0;
+
+        pthread_mutex_lock(&io->lock);
+        while (ring->count == 0 && !io->stop)
+            pthread_cond_wait(&ring->not_empty, &io->lock);
+        if (ring->count == 0) {
+            // stopped, and everything has been written
+            pthread_mutex_unlock(&io->lock);
+            break;
+        }
+        slot = &ring->slot[ring->tail];
+        failed = (io->write_errno != 0);
+        pthread_mutex_unlock(&io->lock);
+
+        // once a write has failed, the rest are thrown away
+        if (!failed && fwrite(slot->mp2, sizeof(unsigned char), slot->size, io->outputfile)
+            != (size_t) slot->size)
+            write_errno = errno ? errno : EIO;
+
+        pthread_mutex_lock(&io->lock);
+        if (write_errno != 0)
+            io->write_errno = write_errno;
+        ring->tail = (ring->tail + 1) % io->slots;
+        ring->count--;
+        pthread_cond_signal(&ring->not_full);
+        pthread_mutex_unlock(&io->lock);
+    }
+
+    return NULL;
+}
+
+static int ring_init(io_ring * ring, int slots, int input)
+{
+    int i;
+
+    memset(ring, 0, sizeof(io_ring));
+    if ((ring->slot = (io_slot *) calloc(slots, sizeof(io_slot))) == NULL)
+        return -1;
+    pthread_cond_init(&ring->not_full, NULL);
+    pthread_cond_init(&ring->not_empty, NULL);
+
+    for (i = 0; i < slots; i++) {
+        if (input)
+            ring->slot[i].pcm = calloc(AUDIO_BUF_SIZE, sizeof(float));
+        else
+            ring->slot[i].mp2 = (unsigned char *) calloc(MP2_BUF_SIZE, sizeof(unsigned char));
+        if (ring->slot[i].pcm == NULL && ring->slot[i].mp2 == NULL)
+            return -1;
+    }
+
+    return 0;
+}
+
+static void ring_free(io_ring * ring, int slots)
+{
+    int i;
+
+    if (ring->slot == NULL)
+        return;
+
+    for (i = 0; i < slots; i++) {
+        free(ring->slot[i].pcm);
+        free(ring->slot[i].mp2);
+    }
+    free(ring->slot);
+
+    pthread_cond_destroy(&ring->not_full);
+    pthread_cond_destroy(&ring->not_empty);
+}
+
+static void async_io_free(async_io * io)
+{
+    ring_free(&io->input, io->slots);
+    ring_free(&io->output, io->slots);
+    pthread_mutex_destroy(&io->lock);
+    free(io);
+}
+
+async_io *async_io_open(async_io_read_func read_func, void *user_data, FILE * outputfile,
+                        int depth)
+{
+    async_io *io;
+
+    if (depth < 1)
+        return NULL;
+    if (depth > MAX_IO_DEPTH)
+        depth = MAX_IO_DEPTH;
+
+    if ((io = (async_io *) calloc(1, sizeof(async_io))) == NULL)
+        return NULL;
+    io->slots = depth + 1;
+    io->read_func = read_func;
+    io->user_data = user_data;
+    io->outputfile = outputfile;
+    pthread_mutex_init(&io->lock, NULL);
+
+    if (ring_init(&io->input, io->slots, TRUE) != 0
+        || ring_init(&io->output, io->slots, FALSE) != 0) {
+        async_io_free(io);
+        return NULL;
+    }
+
+    if (pthread_create(&io->reader, NULL, reader_thread, io) != 0) {
+        async_io_free(io);
+        return NULL;
+    }
+    if (pthread_create(&io->writer, NULL, writer_thread, io) != 0) {
+        pthread_mutex_lock(&io->lock);
+        io->stop = TRUE;
+        pthread_cond_signal(&io->input.not_full);
+        pthread_mutex_unlock(&io->lock);
+        pthread_join(io->reader, NULL);
+        async_io_free(io);
+        return NULL;
+    }
+
+    return io;
+}
+
+int async_io_read(async_io * io, const void **audio)
+{
+    io_ring *ring = &io->input;
+    int size = 0;
+
+    pthread_mutex_lock(&io->lock);
+
+    // the encoder is done with the block it had last time
+    if (io->holding) {
+        ring->tail = (ring->tail + 1) % io->slots;
+        ring->count--;
+        io->holding = FALSE;
+        pthread_cond_signal(&ring->not_full);
+    }
+
+    if (!io->end_of_input) {
+        while (ring->count == 0)
+            pthread_cond_wait(&ring->not_empty, &io->lock);
+        io->holding = TRUE;
+        *audio = ring->slot[ring->tail].audio;
+        size = ring->slot[ring->tail].size;
+        if (size <= 0) {
+            io->end_of_input = TRUE;
+            size = 0;
+        }
+    }
+
+    pthread_mutex_unlock(&io->lock);
+    return size;
+}
+
+unsigned char *async_io_buffer(async_io * io)
+{
+    io_ring *ring = &io->output;
+    unsigned char *buffer;
+
+    pthread_mutex_lock(&io->lock);
+    while (ring->count == io->slots)
+        pthread_cond_wait(&ring->not_full, &io->lock);
+    buffer = ring->slot[ring->head].mp2;
+    pthread_mutex_unlock(&io->lock);
+
+    return buffer;
+}
+
+int async_io_write(async_io * io, int size)
+{
+    io_ring *ring = &io->output;
+    int write_errno;
+
+    pthread_mutex_lock(&io->lock);
+    ring->slot[ring->head].size = size;
+    ring->head = (ring->head + 1) % io->slots;
+    ring->count++;
+    pthread_cond_signal(&ring->not_empty);
+    write_errno = io->write_errno;
+    pthread_mutex_unlock(&io->lock);
+
+    if (write_errno != 0) {
+        errno = write_errno;
+        return -1;
+    }
+    return size;
+}
+
+int async_io_close(async_io * io)
+{
+    int write_errno;
+
+    pthread_mutex_lock(&io->lock);
+    io->stop = TRUE;
+    pthread_cond_signal(&io->input.not_full);
+    pthread_cond_signal(&io->output.not_empty);
+    pthread_mutex_unlock(&io->lock);
+
+    pthread_join(io->reader, NULL);
+    pthread_join(io->writer, NULL);
+
+    write_errno = io->write_errno;
+    async_io_free(io);
+
+    if (write_errno != 0) {
+        errno = write_errno;
+        return -1;
+    }
+    return 0;
+}
+
+#else                           // HAVE_PTHREAD_H
+
+async_io *async_io_open(async_io_read_func read_func, void *user_data, FILE * outputfile,
+                        int depth)
+{
+    (void) read_func;
+    (void) user_data;
+    (void) outputfile;
+    (void) depth;
+    return NULL;
+}
+
+int async_io_read(async_io * io, const void **audio)
+{
+    (void) io;
+    (void) audio;
+    return 0;
+}
+
+unsigned char *async_io_buffer(async_io * io)
+{
+    (void) io;
+    return NULL;
+}
+
+int async_io_write(async_io * io, int size)
+{
+    (void) io;
+    (void) size;
+    return -1;
+}
+
+int async_io_close(async_io * io)
+{
+    (void) io;
+    return 0;
+}
+
+#endif                          // HAVE_PTHREAD_H
+
+
+/* vim:ts=4:sw=4:nowrap: */
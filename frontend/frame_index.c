@@ -0,0 +1,110 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Frame index (--index)
+
+   Written as the frames are encoded, so that they can be found in the
+   output without parsing it. All numbers are little-endian.
+
+   Header (16 bytes):
+     "TLIX", version (16-bit, 1), record size (16-bit, 24),
+     samplerate (32-bit), samples per frame (32-bit, 1152)
+
+   Then one record per frame, so record n is at 16 + 24 * n:
+     frame number (32-bit), byte offset (64-bit), size (16-bit),
+     bitrate index (8-bit), flags (8-bit, 1 if padded),
+     first sample (64-bit, per channel, so the time is sample / samplerate)
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <twolame.h>
+#include <sndfile.h>
+#include "frontend.h"
+
+
+#define FRAME_INDEX_VERSION     (1)
+#define FRAME_INDEX_HEADER      (16)
+#define FRAME_INDEX_RECORD      (24)
+#define FRAME_INDEX_PADDED      (0x01)
+
+
+static void put_le(unsigned char *p, uint64_t value, int bytes)
+{
+    int i;
+
+    for (i = 0; i < bytes; i++) {
+        p[i] = value & 0xff;
+        value >>= 8;
+    }
+}
+
+int frame_index_open(frame_index * index, const char *filename, int samplerate)
+{
+    unsigned char header[FRAME_INDEX_HEADER];
+
+    memset(index, 0, sizeof(frame_index));
+    if ((index->file = fopen(filename, "wb")) == NULL)
+        return -1;
+
+    memcpy(header, "TLIX", 4);
+    put_le(header + 4, FRAME_INDEX_VERSION, 2);
+    put_le(header + 6, FRAME_INDEX_RECORD, 2);
+    put_le(header + 8, samplerate, 4);
+    put_le(header + 12, TWOLAME_SAMPLES_PER_FRAME, 4);
+    if (fwrite(header, 1, sizeof(header), index->file) != sizeof(header))
+        index->error = TRUE;
+
+    return 0;
+}
+
+void frame_index_add(const twolame_frame_info * info, void *user_data)
+{
+    frame_index *index = (frame_index *) user_data;
+    unsigned char record[FRAME_INDEX_RECORD];
+
+    put_le(record, info->frame, 4);
+    put_le(record + 4, info->offset, 8);
+    put_le(record + 12, info->size, 2);
+    record[14] = info->bitrate_index;
+    record[15] = info->padding ? FRAME_INDEX_PADDED : 0;
+    put_le(record + 16, info->sample, 8);
+
+    if (fwrite(record, 1, sizeof(record), index->file) != sizeof(record))
+        index->error = TRUE;
+}
+
+int frame_index_close(frame_index * index)
+{
+    int error = index->error;
+
+    if (fclose(index->file) != 0)
+        error = TRUE;
+    memset(index, 0, sizeof(frame_index));
+
+    return error ? -1 : 0;
+}
+
+
+/* vim:ts=4:sw=4:nowrap: */
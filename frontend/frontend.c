@@ -24,6 +24,8 @@
 #include <string.h>
 #include <unistd.h>
 #include <getopt.h>
+#include <errno.h>
+#include <sys/time.h>
 
 #include <twolame.h>
 #include <sndfile.h>
@@ -38,9 +40,14 @@ int single_frame_mode = FALSE;  // only encode a single frame of MPEG audio ?
 int channelswap = FALSE;        // swap left and right channels ?
 SF_INFO sfinfo;                 // contains information about input file format
 int stdin_input = FALSE;        /* we're going to read from stdin */
+int io_depth = DEFAULT_IO_DEPTH;    // blocks read ahead and written behind (0 for none)
+int low_latency = FALSE;        // read a frame at a time, and write each frame straight out ?
+int segment_frames = 0;         // frames in each segment of output (0 for a single file)
 
 char inputfilename[MAX_NAME_SIZE] = "\0";
 char outputfilename[MAX_NAME_SIZE] = "\0";
+char indexfilename[MAX_NAME_SIZE] = "\0";
+char playlistname[MAX_NAME_SIZE] = "\0";
 
 
 
@@ -164,6 +171,7 @@ static void usage_long()
     fprintf(stderr,
             "\t    --samplesize bits    size of raw input samples in bits (default 16-bit)\n");
     fprintf(stderr, "\t-N, --channels nch       number of channels in raw input\n");
+    fprintf(stderr, "\t    --raw-format fmt     raw input in s16le, s16be, s24le, s32le or f32le\n");
     fprintf(stderr, "\t-g, --swap-channels      swap channels of input file\n");
     fprintf(stderr, "\t    --scale value        scale input (multiply PCM data)\n");
     fprintf(stderr, "\t    --scale-l value      scale channel 0 (left) input\n");
@@ -183,7 +191,14 @@ static void usage_long()
     fprintf(stderr, "\t-l, --ath lev            ATH level (default 0.0)\n");
     fprintf(stderr, "\t-q, --quick num          only calculate psy model every num frames\n");
     fprintf(stderr, "\t-S, --single-frame       only encode a single frame of MPEG Audio\n");
+    fprintf(stderr,
+            "\t    --low-latency        read and write one frame at a time, and time each frame\n");
     fprintf(stderr, "\t    --freeformat         create a free format bitstream\n");
+    fprintf(stderr, "\t    --index file         write an index of the frames to file\n");
+    fprintf(stderr,
+            "\t    --segment frames     split the output into files of this many frames\n");
+    fprintf(stderr,
+            "\t    --playlist file      playlist of the segments (default outfile.m3u8)\n");
 
 
     fprintf(stderr, "\nMiscellaneous Options\n");
@@ -197,6 +212,9 @@ static void usage_long()
     fprintf(stderr, "\t-R, --reserve-bits num   set number of reserved bits in each frame\n");
     fprintf(stderr, "\t-e, --deemphasis emp     de-emphasis n/5/c (default: (n)one)\n");
     fprintf(stderr, "\t-E, --energy             turn on energy level extensions\n");
+    fprintf(stderr,
+            "\t    --io-depth num       read/write num blocks in threads (default %d, 0 is off)\n",
+            DEFAULT_IO_DEPTH);
 
     fprintf(stderr, "\nVerbosity Options\n");
     fprintf(stderr, "\t-t, --talkativity num    talkativity 0-10 (default is 2)\n");
@@ -271,6 +289,7 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
     int use_raw = FALSE;                  // use raw input?
     int sample_size = DEFAULT_SAMPLESIZE; // number of bits per sample for raw input
     int byteswap = FALSE;                 // swap endian on input audio ?
+    int raw_format = 0;                   // libsndfile format given by --raw-format
     char *shortopts;
 
     // process args
@@ -282,6 +301,7 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
         {"samplerate", required_argument, NULL, 's'},
         {"samplesize", required_argument, NULL, 1000},
         {"channels", required_argument, NULL, 'N'},
+        {"raw-format", required_argument, NULL, 1014},
         {"swap-channels", no_argument, NULL, 'g'},
         {"scale", required_argument, NULL, 1001},
         {"scale-l", required_argument, NULL, 1002},
@@ -298,7 +318,11 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
         {"ath", required_argument, NULL, 'l'},
         {"quick", required_argument, NULL, 'q'},
         {"single-frame", no_argument, NULL, 'S'},
+        {"low-latency", no_argument, NULL, 1013},
         {"freeformat", no_argument, NULL, 1009},
+        {"index", required_argument, NULL, 1015},
+        {"segment", required_argument, NULL, 1016},
+        {"playlist", required_argument, NULL, 1017},
 
         // Misc
         {"copyright", no_argument, NULL, 'c'},
@@ -311,6 +335,7 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
         {"reserve-bits", required_argument, NULL, 'R'},
         {"deemphasis", required_argument, NULL, 'e'},
         {"energy", no_argument, NULL, 'E'},
+        {"io-depth", required_argument, NULL, 1012},
 
         // Verbosity
         {"talkativity", required_argument, NULL, 't'},
@@ -371,6 +396,16 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
             sfinfo.channels = atoi(optarg);
             break;
 
+        case 1014:             // --raw-format
+            raw_format = raw_input_sf_format(optarg);
+            if (raw_format == 0) {
+                fprintf(stderr, "Error: raw format must be s16le/s16be/s24le/s32le/f32le not '%s'\n\n",
+                        optarg);
+                usage_long();
+            }
+            use_raw = TRUE;
+            break;
+
         case 'g':
             channelswap = TRUE;
             break;
@@ -445,10 +480,30 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
             single_frame_mode = TRUE;
             break;
 
+        case 1013:             // --low-latency
+            low_latency = TRUE;
+            break;
+
         case 1009:
             twolame_set_freeformat(encopts, TRUE);
             break;
 
+        case 1015:             // --index
+            strncpy(indexfilename, optarg, MAX_NAME_SIZE-1);
+            break;
+
+        case 1016:             // --segment
+            segment_frames = atoi(optarg);
+            if (segment_frames < 1) {
+                fprintf(stderr, "Error: segment must be at least 1 frame not '%s'\n\n", optarg);
+                usage_long();
+            }
+            break;
+
+        case 1017:             // --playlist
+            strncpy(playlistname, optarg, MAX_NAME_SIZE-1);
+            break;
+
         // Miscellaneous
         case 'c':
             twolame_set_copyright(encopts, TRUE);
@@ -489,6 +544,14 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
         case 'E':
             twolame_set_energy_levels(encopts, TRUE);
             break;
+        case 1012:             // --io-depth
+            io_depth = atoi(optarg);
+            if (io_depth < 0 || io_depth > MAX_IO_DEPTH) {
+                fprintf(stderr, "Error: io-depth must be 0 to %d not '%s'\n\n", MAX_IO_DEPTH,
+                        optarg);
+                usage_long();
+            }
+            break;
 
 
         // Verbosity
@@ -575,6 +638,10 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
                 sfinfo.format |= SF_ENDIAN_LITTLE;
             }
         }
+
+        // --raw-format says it all
+        if (raw_format)
+            sfinfo.format = raw_format;
     }
 
     // Check that we now have input and output file names ok
@@ -591,6 +658,15 @@ static void parse_args(int argc, char **argv, twolame_options * encopts)
         fprintf(stderr, "Missing output filename.\n");
         usage_short();
     }
+    // Segments are named after the output file, and listed next to it by default
+    if (segment_frames) {
+        if (strcmp(outputfilename, "-") == 0) {
+            fprintf(stderr, "Error: segmented output can't be written to STDOUT.\n");
+            usage_short();
+        }
+        if (playlistname[0] == '\0')
+            new_extension(outputfilename, ".m3u8", playlistname);
+    }
     // Check -r is supplied when reading from STDIN
     if (strcmp(inputfilename, "-") == 0 && !use_raw) {
         fprintf(stderr, "Error: please use RAW audio '-r' switch when reading from STDIN.\n");
@@ -699,22 +775,211 @@ static void print_info_sndfile(SNDFILE *file, SF_INFO *sfinfo, unsigned int tota
     fprintf(stderr, "Input Library: %s\n", sndlibver);
 }
 
+/*
+  print_info_native()
+  Display information about an input file read without libsndfile
+*/
+static void print_info_native(SF_INFO *sfinfo, const char *format, const char *library,
+                              unsigned int total_frames)
+{
+    char duration[40];
+
+    fprintf(stderr, "Input Format: %s\n", format);
+    if (total_frames) {
+        format_duration_string(sfinfo, duration, sizeof(duration));
+        fprintf(stderr, "Input Duration: %s\n", duration);
+    }
+    fprintf(stderr, "Input Library: none (%s)\n", library);
+}
+
+/*
+  The input file: mapped, read as raw PCM, or else opened with libsndfile
+*/
+#define INPUT_MAPPED        (0)
+#define INPUT_RAW           (1)
+#define INPUT_SNDFILE       (2)
+
+typedef struct {
+    int type;
+    SNDFILE *file;
+    mmap_input mapped;
+    raw_input raw;
+    int use_float;              // samples are floats, rather than 16-bit
+    int read_size;              // samples read at a time by libsndfile (or raw_input_read())
+    int mapped_size;            // samples per channel taken at a time from the mapping
+} input_source;
+
+/*
+  sndfile_is_float()
+  Are there more than 16 bits in the samples libsndfile will read?
+*/
+static int sndfile_is_float(SF_INFO *sfinfo)
+{
+    switch (sfinfo->format & SF_FORMAT_SUBMASK) {
+    case SF_FORMAT_PCM_24:
+    case SF_FORMAT_PCM_32:
+    case SF_FORMAT_FLOAT:
+    case SF_FORMAT_DOUBLE:
+        return TRUE;
+    default:
+        return FALSE;
+    }
+}
+
+/*
+  read_audio()
+  Point audio at the next block of input: straight into the mapping of the
+  input file, or else at pcmaudio (AUDIO_BUF_SIZE floats), once it has been
+  read into it.
+  Called by the reader thread, if there is one.
+  Returns the number of samples per channel
+*/
+static int read_audio(void *user_data, void *pcmaudio, const void **audio)
+{
+    input_source *input = (input_source *) user_data;
+    int samples_read, i;
+
+    if (input->type == INPUT_MAPPED)
+        return mmap_input_read(&input->mapped, input->mapped_size, (const short int **) audio);
+
+    *audio = pcmaudio;
+    if (input->type == INPUT_RAW)
+        samples_read = raw_input_read(&input->raw, pcmaudio, input->read_size);
+    else if (input->use_float)
+        samples_read = sf_read_float(input->file, (float *) pcmaudio, input->read_size)
+            / sfinfo.channels;
+    else
+        samples_read = sf_read_short(input->file, (short int *) pcmaudio, input->read_size)
+            / sfinfo.channels;
+
+    // Do swapping of left and right channels if requested
+    if (channelswap && sfinfo.channels == 2) {
+        if (input->use_float) {
+            float *pcm = (float *) pcmaudio;
+            for (i = 0; i < samples_read; i++) {
+                float tmp = pcm[(2 * i)];
+                pcm[(2 * i)] = pcm[(2 * i) + 1];
+                pcm[(2 * i) + 1] = tmp;
+            }
+        } else {
+            short int *pcm = (short int *) pcmaudio;
+            for (i = 0; i < samples_read; i++) {
+                short tmp = pcm[(2 * i)];
+                pcm[(2 * i)] = pcm[(2 * i) + 1];
+                pcm[(2 * i) + 1] = tmp;
+            }
+        }
+    }
+
+    return samples_read;
+}
+
+/*
+  next_audio()
+  Get the next block of input from the reader thread, or else read it now
+*/
+static int next_audio(async_io *io, input_source *input, void *pcmaudio, const void **audio)
+{
+    if (io != NULL)
+        return async_io_read(io, audio);
+    return read_audio(input, pcmaudio, audio);
+}
+
+/*
+  write_mp2()
+  Hand buffer (from async_io_buffer(), with a writer thread) to the writer
+  thread, or else write it now. In low latency mode it goes straight to the
+  file descriptor, rather than waiting in stdio's buffer.
+  Returns the number of bytes written (or queued)
+*/
+static int write_mp2(async_io *io, FILE *outputfile, unsigned char *buffer, int size)
+{
+    int written = 0;
+
+    if (io != NULL)
+        return async_io_write(io, size);
+    if (!low_latency)
+        return fwrite(buffer, sizeof(unsigned char), size, outputfile);
+
+    while (written < size) {
+        ssize_t bytes = write(fileno(outputfile), buffer + written, size - written);
+        if (bytes < 0 && errno == EINTR)
+            continue;
+        if (bytes <= 0)
+            break;
+        written += bytes;
+    }
+    return written;
+}
+
+/*
+  record_latency()
+  Add the time since start to the histogram of frame latencies
+*/
+static void record_latency(unsigned int *histogram, const struct timeval *start)
+{
+    struct timeval now;
+    long usec;
+
+    gettimeofday(&now, NULL);
+    usec = (now.tv_sec - start->tv_sec) * 1000000L + (now.tv_usec - start->tv_usec);
+    if (usec < 0)
+        usec = 0;
+    if (usec >= LATENCY_BUCKETS)
+        usec = LATENCY_BUCKETS - 1;
+    histogram[usec]++;
+}
+
+/*
+  print_latency()
+  Display percentiles of the time from each frame of audio being read
+  to its MP2 frame being written
+*/
+static void print_latency(const unsigned int *histogram)
+{
+    const double percentiles[] = { 50.0, 90.0, 99.0, 99.9, 100.0 };
+    const char *names[] = { "50%", "90%", "99%", "99.9%", "max" };
+    unsigned long frames = 0, seen = 0;
+    int i, p = 0;
+
+    for (i = 0; i < LATENCY_BUCKETS; i++)
+        frames += histogram[i];
+    if (frames == 0)
+        return;
+
+    fprintf(stderr, "\nFrame latency (%lu frames):", frames);
+    for (i = 0; i < LATENCY_BUCKETS && p < 5; i++) {
+        seen += histogram[i];
+        while (p < 5 && seen * 100.0 >= percentiles[p] * frames) {
+            fprintf(stderr, " %s %s%dus", names[p], (i == LATENCY_BUCKETS - 1) ? ">=" : "", i);
+            p++;
+        }
+    }
+    fprintf(stderr, "\n");
+}
+
 
 
 int main(int argc, char **argv)
 {
     twolame_options *encopts = NULL;
-    SNDFILE *inputfile = NULL;
+    input_source input;
+    async_io *io = NULL;
     FILE *outputfile = NULL;
-    short int *pcmaudio = NULL;
+    frame_index index;
+    segment_output segments;
+    void *pcmaudio = NULL;
+    const void *audio = NULL;
     unsigned int frame_count = 0;
     unsigned int total_samples = 0;
     unsigned int total_frames = 0;
     unsigned int total_bytes = 0;
     unsigned char *mp2buffer = NULL;
+    unsigned char *mp2out = NULL;
+    unsigned int *latency = NULL;
+    struct timeval read_time;
     int samples_read = 0;
     int mp2fill_size = 0;
-    int audioReadSize = 0;
     char filesize[20];
 
 
@@ -730,8 +995,25 @@ int main(int argc, char **argv)
     // Display the filenames
     print_filenames(twolame_get_verbosity(encopts));
 
-    // Open the input file
-    inputfile = open_input_sndfile(inputfilename, &sfinfo);
+    // Map the input file if it is plain PCM, read it ourselves if it is raw PCM,
+    // otherwise open it with libsndfile
+    // (channel swapping needs a copy of the samples to work on)
+    memset(&input, 0, sizeof(input));
+    if (!stdin_input && !channelswap
+        && mmap_input_open(inputfilename, &sfinfo, &input.mapped) == 0) {
+        input.type = INPUT_MAPPED;
+        sfinfo.channels = input.mapped.channels;
+        sfinfo.samplerate = input.mapped.samplerate;
+        sfinfo.frames = input.mapped.frames;
+    } else if (raw_input_open(inputfilename, &sfinfo, &input.raw) == 0) {
+        input.type = INPUT_RAW;
+        input.use_float = input.raw.is_float;
+        sfinfo.frames = input.raw.frames;
+    } else {
+        input.type = INPUT_SNDFILE;
+        input.file = open_input_sndfile(inputfilename, &sfinfo);
+        input.use_float = sndfile_is_float(&sfinfo);
+    }
 
     // Calculate the size and number of frames we are going to encode
     if (sfinfo.frames && !stdin_input)
@@ -741,7 +1023,18 @@ int main(int argc, char **argv)
 
     // Display input information
     if (twolame_get_verbosity(encopts) > 1) {
-        print_info_sndfile(inputfile, &sfinfo, total_frames);
+        char format[40];
+
+        if (input.type == INPUT_SNDFILE) {
+            print_info_sndfile(input.file, &sfinfo, total_frames);
+        } else if (input.type == INPUT_RAW) {
+            snprintf(format, sizeof(format), "RAW, %s", input.raw.name);
+            print_info_native(&sfinfo, format, "raw PCM", total_frames);
+        } else {
+            snprintf(format, sizeof(format), "%s, Signed 16 bit PCM",
+                     (sfinfo.format & SF_FORMAT_TYPEMASK) == SF_FORMAT_RAW ? "RAW" : "WAV");
+            print_info_native(&sfinfo, format, "memory mapped", total_frames);
+        }
     }
 
     // Use information from input file to configure libtwolame
@@ -757,8 +1050,8 @@ int main(int argc, char **argv)
     twolame_print_config(encopts);
 
 
-    // Allocate memory for the PCM audio data
-    if ((pcmaudio = (short int *) calloc(AUDIO_BUF_SIZE, sizeof(short int))) == NULL) {
+    // Allocate memory for the PCM audio data (16-bit samples or floats)
+    if ((pcmaudio = calloc(AUDIO_BUF_SIZE, sizeof(float))) == NULL) {
         fprintf(stderr, "Error: pcmaudio memory allocation failed\n");
         exit(ERR_MEM_ALLOC);
     }
@@ -768,42 +1061,94 @@ int main(int argc, char **argv)
         exit(ERR_MEM_ALLOC);
     }
 
-    // Open the output file
-    outputfile = open_output_file(outputfilename);
+    // Open the output file, or have the encoder hand each frame to the segment
+    // that it belongs in, so that the output is cut on frame boundaries
+    if (segment_frames) {
+        if (segment_output_open(&segments, outputfilename, playlistname, segment_frames,
+                                twolame_get_out_samplerate(encopts)) != 0) {
+            perror("Failed to open playlist file");
+            exit(ERR_OPENING_OUTPUT);
+        }
+        segments.flush = low_latency;
+        twolame_set_output_callback(encopts, segment_output_write, &segments);
+    } else {
+        outputfile = open_output_file(outputfilename);
+    }
+
+    // Have the encoder say where each frame is, if an index is wanted
+    if (indexfilename[0] != '\0') {
+        if (frame_index_open(&index, indexfilename, twolame_get_out_samplerate(encopts)) != 0) {
+            perror("Failed to open index file");
+            exit(ERR_OPENING_OUTPUT);
+        }
+        twolame_set_frame_callback(encopts, frame_index_add, &index);
+    }
 
     // Only encode a single frame of mpeg audio ?
-    if (single_frame_mode)
-        audioReadSize = TWOLAME_SAMPLES_PER_FRAME;
-    else
-        audioReadSize = AUDIO_BUF_SIZE;
+    // (whole frames are taken from a mapped file, which the encoder uses in place)
+    if (single_frame_mode) {
+        input.read_size = TWOLAME_SAMPLES_PER_FRAME;
+        input.mapped_size = TWOLAME_SAMPLES_PER_FRAME;
+    } else if (low_latency) {
+        // exactly one frame, so that each is encoded as soon as it has arrived
+        input.read_size = TWOLAME_SAMPLES_PER_FRAME * sfinfo.channels;
+        input.mapped_size = TWOLAME_SAMPLES_PER_FRAME;
+    } else {
+        input.read_size = AUDIO_BUF_SIZE;
+        input.mapped_size = MMAP_BLOCK_SIZE;
+    }
+
+    // Read and write in threads of their own, so that the encoder isn't kept
+    // waiting on either (falls back to doing it all here without threads)
+    // In low latency mode frames mustn't be kept waiting in a queue either
+    // (segments are written as the encoder hands them over, so there is nothing
+    // for the writer thread to do then)
+    if (io_depth > 0 && !single_frame_mode && !low_latency)
+        io = async_io_open(read_audio, &input, outputfile, io_depth);
+
+    if (low_latency) {
+        if ((latency = (unsigned int *) calloc(LATENCY_BUCKETS, sizeof(unsigned int))) == NULL) {
+            fprintf(stderr, "Error: latency memory allocation failed\n");
+            exit(ERR_MEM_ALLOC);
+        }
+    }
 
 
     // Now do the reading/encoding/writing
-    while ((samples_read = sf_read_short(inputfile, pcmaudio, audioReadSize)) > 0) {
+    while ((samples_read = next_audio(io, &input, pcmaudio, &audio)) > 0) {
         int bytes_out = 0;
 
-        // Calculate the number of samples we have (per channel)
-        samples_read /= sfinfo.channels;
+        if (latency != NULL)
+            gettimeofday(&read_time, NULL);
+
+        // Count the samples we have (per channel)
         total_samples += (unsigned int)samples_read;
 
-        // Do swapping of left and right channels if requested
-        if (channelswap && sfinfo.channels == 2) {
-            int i;
-            for (i = 0; i < samples_read; i++) {
-                short tmp = pcmaudio[(2 * i)];
-                pcmaudio[(2 * i)] = pcmaudio[(2 * i) + 1];
-                pcmaudio[(2 * i) + 1] = tmp;
-            }
-        }
+        // The mapping before this block has been encoded
+        if (input.type == INPUT_MAPPED)
+            mmap_input_release(&input.mapped, (const short int *) audio);
+
         // Encode the audio to MP2
-        mp2fill_size =
-            twolame_encode_buffer_interleaved(encopts, pcmaudio, samples_read, mp2buffer,
-                                              MP2_BUF_SIZE);
+        // (samples with more than 16 bits are passed on as floats, so none are lost)
+        mp2out = (io != NULL) ? async_io_buffer(io) : mp2buffer;
+        if (input.use_float)
+            mp2fill_size =
+                twolame_encode_buffer_float32_interleaved(encopts, (const float *) audio,
+                                                          samples_read, mp2out, MP2_BUF_SIZE);
+        else
+            mp2fill_size =
+                twolame_encode_buffer_interleaved(encopts, (const short int *) audio,
+                                                  samples_read, mp2out, MP2_BUF_SIZE);
 
         // Stop if we don't have any bytes (probably don't have enough audio for a full frame of
         // mpeg audio)
         if (mp2fill_size == 0)
             break;
+        if (mp2fill_size < 0 && segment_frames && segments.error != 0) {
+            errno = segments.error;
+            perror("error while writing to output file");
+            exit(ERR_WRITING_OUTPUT);
+        }
         if (mp2fill_size < 0) {
             fprintf(stderr, "error while encoding audio: %d\n", mp2fill_size);
             exit(ERR_ENCODING);
@@ -815,12 +1160,18 @@ int main(int argc, char **argv)
         // }
 
         // Write the encoded audio out
-        bytes_out = fwrite(mp2buffer, sizeof(unsigned char), mp2fill_size, outputfile);
-        if (bytes_out != mp2fill_size) {
-            perror("error while writing to output file");
-            exit(ERR_WRITING_OUTPUT);
+        // (segments have been written already, and mp2fill_size is the samples used)
+        if (!segment_frames) {
+            bytes_out = write_mp2(io, outputfile, mp2out, mp2fill_size);
+            if (bytes_out != mp2fill_size) {
+                perror("error while writing to output file");
+                exit(ERR_WRITING_OUTPUT);
+            }
+            total_bytes += bytes_out;
         }
-        total_bytes += bytes_out;
+
+        if (latency != NULL)
+            record_latency(latency, &read_time);
 
         // Only single frame ?
         if (single_frame_mode)
@@ -838,19 +1189,21 @@ int main(int argc, char **argv)
         }
     }
 
-    // Was there an error reading the audio?
-    if (sf_error(inputfile) != SF_ERR_NO_ERROR) {
-        fprintf(stderr, "Error reading from input file: %s\n", sf_strerror(inputfile));
-    }
-
     //
     // Flush any remaining audio. (don't send any new audio data) There
     // should only ever be a max of 1 frame on a flush. There may be zero
     // frames if the audio data was an exact multiple of 1152
     //
-    mp2fill_size = twolame_encode_flush(encopts, mp2buffer, MP2_BUF_SIZE);
+    mp2out = (io != NULL) ? async_io_buffer(io) : mp2buffer;
+    mp2fill_size = twolame_encode_flush(encopts, mp2out, MP2_BUF_SIZE);
+    if (mp2fill_size < 0 && segment_frames && segments.error != 0) {
+        errno = segments.error;
+        perror("error while writing to output file");
+        exit(ERR_WRITING_OUTPUT);
+    }
     if (mp2fill_size > 0) {
-        int bytes_out = fwrite(mp2buffer, sizeof(unsigned char), mp2fill_size, outputfile);
+        int bytes_out = segment_frames ? mp2fill_size
+            : write_mp2(io, outputfile, mp2out, mp2fill_size);
         frame_count++;
         if (bytes_out <= 0) {
             perror("error while writing to output file");
@@ -865,17 +1218,57 @@ int main(int argc, char **argv)
                 fflush(stderr);
             }
         }
-        total_bytes += bytes_out;
+        if (!segment_frames)
+            total_bytes += bytes_out;
+    }
+
+    // Wait for the writer thread to finish (and the reader thread to stop)
+    if (io != NULL && async_io_close(io) != 0) {
+        perror("error while writing to output file");
+        exit(ERR_WRITING_OUTPUT);
+    }
+
+    if (segment_frames) {
+        if (segment_output_close(&segments) != 0) {
+            perror("error while writing to output file");
+            exit(ERR_WRITING_OUTPUT);
+        }
+        total_bytes = segments.bytes;
     }
 
+    if (indexfilename[0] != '\0' && frame_index_close(&index) != 0) {
+        perror("error while writing to index file");
+        exit(ERR_WRITING_OUTPUT);
+    }
+
+    // Was there an error reading the audio?
+    if (input.type == INPUT_SNDFILE && sf_error(input.file) != SF_ERR_NO_ERROR) {
+        fprintf(stderr, "Error reading from input file: %s\n", sf_strerror(input.file));
+    }
+    if (input.type == INPUT_RAW && input.raw.error != 0) {
+        fprintf(stderr, "Error reading from input file: %s\n", strerror(input.raw.error));
+    }
+
+    if (latency != NULL && twolame_get_verbosity(encopts) > 0)
+        print_latency(latency);
+
     if (twolame_get_verbosity(encopts) > 1) {
         format_filesize_string(filesize, sizeof(filesize), total_bytes);
         fprintf(stderr, "\nEncoding Finished.\n");
         fprintf(stderr, "Total bytes written: %s.\n", filesize);
+        if (segment_frames)
+            fprintf(stderr, "Segments written: %d (listed in %s).\n", segments.segments,
+                    playlistname);
     }
     // Close input and output streams
-    sf_close(inputfile);
-    fclose(outputfile);
+    if (input.type == INPUT_SNDFILE)
+        sf_close(input.file);
+    else if (input.type == INPUT_RAW)
+        raw_input_close(&input.raw);
+    else
+        mmap_input_close(&input.mapped);
+    if (outputfile != NULL)
+        fclose(outputfile);
 
     // Close the libtwolame encoder
     twolame_close(&encopts);
@@ -884,6 +1277,7 @@ int main(int argc, char **argv)
     // Free up memory
     free(pcmaudio);
     free(mp2buffer);
+    free(latency);
 
     return (ERR_NO_ERROR);
 }
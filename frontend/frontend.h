@@ -30,6 +30,10 @@
 #define DEFAULT_CHANNELS     (2)
 #define DEFAULT_SAMPLERATE   (44100)
 #define DEFAULT_SAMPLESIZE   (16)
+#define MMAP_BLOCK_SIZE      (4 * TWOLAME_SAMPLES_PER_FRAME)   // samples per channel
+#define DEFAULT_IO_DEPTH     (4)     // blocks read ahead, and buffers waiting to be written
+#define MAX_IO_DEPTH         (64)
+#define LATENCY_BUCKETS      (100000)    // microseconds of latency histogram (the last is 100ms+)
 
 
 /*
@@ -45,3 +49,139 @@
 #define ERR_ENCODING         (12)    // Error occurred during encoding
 #define ERR_WRITING_OUTPUT   (14)    // Error occurred writing to output file
 
+
+/*
+  Memory mapped input (mmap_input.c)
+*/
+typedef struct mmap_input_struc {
+    void *map;
+    size_t map_size;
+    size_t released;            // bytes at the start of the mapping given back already
+    const short int *samples;   // the first sample, in the mapping
+    unsigned long frames;       // samples per channel
+    unsigned long position;     // next sample per channel to hand out
+    int channels;
+    int samplerate;
+} mmap_input;
+
+/* Map a plain 16-bit PCM WAV file, or a RAW file as described by sfinfo;
+   returns -1 if it can't be, and libsndfile should read it instead */
+int mmap_input_open(const char *filename, const SF_INFO * sfinfo, mmap_input * input);
+
+/* Point audio at the next frames samples per channel (interleaved);
+   returns how many there are, 0 at the end */
+int mmap_input_read(mmap_input * input, int frames, const short int **audio);
+
+/* Give back the pages of the mapping before audio, which have been encoded */
+void mmap_input_release(mmap_input * input, const short int *audio);
+
+void mmap_input_close(mmap_input * input);
+
+
+/*
+  Raw PCM input (raw_input.c)
+*/
+typedef struct raw_input_struc {
+    int fd;
+    int type;                   // which of the formats below
+    const char *name;           // s16le, s16be, s24le, s32le or f32le
+    int sample_bytes;
+    int is_float;               // read as floats (full scale 1.0), not 16-bit samples
+    int channels;
+    int samplerate;
+    unsigned long frames;       // samples per channel, or 0 if not known
+    int error;                  // errno, if reading failed
+    unsigned char *bytes;       // AUDIO_BUF_SIZE samples, as they are in the file
+} raw_input;
+
+/* The libsndfile format for one of the names above, or 0 */
+int raw_input_sf_format(const char *name);
+
+/* Open a RAW file (or - for stdin) described by sfinfo;
+   returns -1 if it isn't in one of the formats above */
+int raw_input_open(const char *filename, const SF_INFO * sfinfo, raw_input * input);
+
+/* Read up to samples samples (all channels, no more than AUDIO_BUF_SIZE) into
+   buffer, as 16-bit samples or floats; returns samples per channel, 0 at the end */
+int raw_input_read(raw_input * input, void *buffer, int samples);
+
+void raw_input_close(raw_input * input);
+
+
+/*
+  Reader and writer threads (async_io.c)
+*/
+typedef struct async_io_struc async_io;
+
+/* Read the next block of input into buffer (room for AUDIO_BUF_SIZE floats), or point
+   audio somewhere else that holds it; returns samples per channel, 0 at the end */
+typedef int (*async_io_read_func) (void *user_data, void *buffer, const void **audio);
+
+/* Start a thread reading up to depth blocks ahead with read_func, and one writing
+   up to depth buffers to outputfile; returns NULL if threads can't be used */
+async_io *async_io_open(async_io_read_func read_func, void *user_data, FILE * outputfile,
+                        int depth);
+
+/* Point audio at the next block read; returns samples per channel, 0 at the end
+   (the block stays valid until the next call) */
+int async_io_read(async_io * io, const void **audio);
+
+/* Get an empty buffer (MP2_BUF_SIZE bytes) to encode into, and queue the first
+   size bytes of it to be written; returns -1 if an earlier write failed */
+unsigned char *async_io_buffer(async_io * io);
+int async_io_write(async_io * io, int size);
+
+/* Wait for everything to be written and stop both threads;
+   returns -1 (with errno set) if a write failed */
+int async_io_close(async_io * io);
+
+
+/*
+  Frame index (frame_index.c)
+*/
+typedef struct frame_index_struc {
+    FILE *file;
+    int error;                  // a write failed
+} frame_index;
+
+/* Create the index file, for output at samplerate; returns -1 if it can't be */
+int frame_index_open(frame_index * index, const char *filename, int samplerate);
+
+/* The twolame_frame_callback that adds a frame to the index given as user_data */
+void frame_index_add(const twolame_frame_info * info, void *user_data);
+
+/* Returns -1 if writing the index failed */
+int frame_index_close(frame_index * index);
+
+
+/*
+  Segmented output (segment_output.c)
+*/
+typedef struct segment_output_struc {
+    char prefix[MAX_NAME_SIZE];     // output file name, without its extension
+    char suffix[MAX_NAME_SIZE];     // and the extension
+    char *filename;             // of the segment being written
+    size_t filename_size;
+    FILE *file;                 // the segment being written, or NULL between segments
+    FILE *playlist;
+    int same_dir;               // the segments are next to the playlist
+    int frames_per_segment;
+    int samplerate;
+    int frames;                 // frames in the segment being written
+    int segments;               // segments finished
+    unsigned long bytes;        // bytes written to all the segments
+    int flush;                  // flush each frame out as soon as it is written
+    int error;                  // errno of the first failure, or 0
+} segment_output;
+
+/* Start a playlist of segments of frames_per_segment frames, named after filename;
+   returns -1 if the playlist can't be created */
+int segment_output_open(segment_output * out, const char *filename, const char *playlistname,
+                        int frames_per_segment, int samplerate);
+
+/* The twolame_output_callback that writes a frame to the segment output given as user_data */
+int segment_output_write(const unsigned char *data, int size, void *user_data);
+
+/* Finish the last segment and end the playlist;
+   returns -1 (with errno set) if anything failed to be written */
+int segment_output_close(segment_output * out);
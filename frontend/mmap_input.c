@@ -0,0 +1,269 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Memory mapped input
+
+   Plain 16-bit PCM WAV files (and RAW files in the machine's byte order)
+   are mapped rather than read, and the encoder is handed pointers straight
+   into the mapping; it then encodes whole frames without copying them.
+   Anything else is left to libsndfile.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef HAVE_SYS_MMAN_H
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
+#include <twolame.h>
+#include <sndfile.h>
+#include "frontend.h"
+
+
+#define WAVE_FORMAT_PCM         (0x0001)
+#define WAVE_FORMAT_EXTENSIBLE  (0xfffe)
+#define MMAP_RELEASE_BYTES      (4 * 1024 * 1024)   // Drop the pages behind every 4MB
+#define MMAP_PAGE_BYTES         (4096)              // Pages are at least this big
+
+
+#ifdef HAVE_SYS_MMAN_H
+
+static unsigned int read_le(const unsigned char *p, int bytes)
+{
+    unsigned int v = 0;
+
+    while (bytes--)
+        v = (v << 8) | p[bytes];
+    return v;
+}
+
+static int little_endian(void)
+{
+    union {
+        unsigned char b[2];
+        unsigned short s;
+    } detect_endian;
+
+    detect_endian.b[0] = 0x34;
+    detect_endian.b[1] = 0x12;
+    return detect_endian.s == 0x1234;
+}
+
+/*
+    Find the samples in a mapped WAV file
+    Returns 0, or -1 if they aren't plain 16-bit PCM
+*/
+static int parse_wav(mmap_input * input, const unsigned char *data, size_t size)
+{
+    size_t pos = 12;
+    int channels = 0, samplerate = 0, bits = 0, format = 0;
+
+    if (size < 12 || memcmp(data, "RIFF", 4) || memcmp(data + 8, "WAVE", 4))
+        return -1;
+
+    while (pos + 8 <= size) {
+        size_t chunk_size = read_le(data + pos + 4, 4);
+
+        if (!memcmp(data + pos, "fmt ", 4)) {
+            const unsigned char *fmt = data + pos + 8;
+
+            if (chunk_size < 16 || pos + 8 + chunk_size > size)
+                return -1;
+            format = read_le(fmt, 2);
+            channels = read_le(fmt + 2, 2);
+            samplerate = read_le(fmt + 4, 4);
+            bits = read_le(fmt + 14, 2);
+
+            // WAVE_FORMAT_EXTENSIBLE: the real format is the start of the sub-format GUID
+            if (format == WAVE_FORMAT_EXTENSIBLE && chunk_size >= 40)
+                format = read_le(fmt + 24, 2);
+
+        } else if (!memcmp(data + pos, "data", 4)) {
+            pos += 8;
+            if (format != WAVE_FORMAT_PCM || bits != 16 || channels < 1 || channels > 2
+                || samplerate <= 0 || (pos & 1))
+                return -1;
+
+            // a data chunk that is too long (or of unknown length, when it was streamed)
+            // runs to the end of the file
+            if (chunk_size > size - pos)
+                chunk_size = size - pos;
+
+            input->samples = (const short int *) (data + pos);
+            input->frames = chunk_size / (2 * channels);
+            input->channels = channels;
+            input->samplerate = samplerate;
+            return 0;
+        }
+
+        // chunks are padded to an even length
+        if (chunk_size > size - pos - 8)
+            break;
+        pos += 8 + chunk_size + (chunk_size & 1);
+    }
+
+    return -1;
+}
+
+int mmap_input_open(const char *filename, const SF_INFO * sfinfo, mmap_input * input)
+{
+    struct stat st;
+    void *map;
+    int fd;
+
+    memset(input, 0, sizeof(mmap_input));
+
+    // the samples are handed over as they are, so they have to be in the machine's order
+    if ((sfinfo->format & SF_FORMAT_TYPEMASK) == SF_FORMAT_RAW) {
+        int endian = sfinfo->format & SF_FORMAT_ENDMASK;
+
+        if ((sfinfo->format & SF_FORMAT_SUBMASK) != SF_FORMAT_PCM_16
+            || (endian != SF_ENDIAN_FILE && endian != SF_ENDIAN_CPU
+                && endian != (little_endian() ? SF_ENDIAN_LITTLE : SF_ENDIAN_BIG))
+            || sfinfo->channels < 1 || sfinfo->channels > 2)
+            return -1;
+    } else if (sfinfo->format != 0 || !little_endian()) {
+        return -1;
+    }
+
+    if ((fd = open(filename, O_RDONLY)) < 0)
+        return -1;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0
+        || (off_t) (size_t) st.st_size != st.st_size) {
+        close(fd);
+        return -1;
+    }
+
+    map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+        return -1;
+    input->map = map;
+    input->map_size = (size_t) st.st_size;
+
+    if ((sfinfo->format & SF_FORMAT_TYPEMASK) == SF_FORMAT_RAW) {
+        input->samples = (const short int *) map;
+        input->channels = sfinfo->channels;
+        input->samplerate = sfinfo->samplerate;
+        input->frames = input->map_size / (2 * input->channels);
+    } else if (parse_wav(input, (const unsigned char *) map, input->map_size) != 0) {
+        mmap_input_close(input);
+        return -1;
+    }
+
+#ifdef MADV_SEQUENTIAL
+    // read ahead aggressively, and don't keep pages around once they are behind us
+    madvise(map, input->map_size, MADV_SEQUENTIAL);
+#endif
+
+    return 0;
+}
+
+int mmap_input_read(mmap_input * input, int frames, const short int **audio)
+{
+    const unsigned char *block, *page;
+    volatile unsigned char touch = 0;
+
+    if (input->position >= input->frames)
+        return 0;
+    if ((unsigned long) frames > input->frames - input->position)
+        frames = (int) (input->frames - input->position);
+
+    *audio = input->samples + input->position * input->channels;
+    input->position += frames;
+
+    // fault the block in here, so that a reader thread does the waiting rather than the encoder
+    block = (const unsigned char *) *audio;
+    for (page = block; page < block + (size_t) frames * 2 * input->channels; page += MMAP_PAGE_BYTES)
+        touch ^= *page;
+
+    return frames;
+}
+
+void mmap_input_release(mmap_input * input, const short int *audio)
+{
+#ifdef MADV_DONTNEED
+    const unsigned char *base = (const unsigned char *) input->map;
+    size_t released;
+
+    // let go of what has been encoded, so that long files don't fill up memory
+    released = ((const unsigned char *) audio - base) & ~((size_t) MMAP_RELEASE_BYTES - 1);
+    if (released > input->released) {
+        madvise((void *) (base + input->released), released - input->released, MADV_DONTNEED);
+        input->released = released;
+    }
+#else
+    (void) input;
+    (void) audio;
+#endif
+}
+
+void mmap_input_close(mmap_input * input)
+{
+    if (input->map != NULL)
+        munmap(input->map, input->map_size);
+    memset(input, 0, sizeof(mmap_input));
+}
+
+#else                           // HAVE_SYS_MMAN_H
+
+int mmap_input_open(const char *filename, const SF_INFO * sfinfo, mmap_input * input)
+{
+    (void) filename;
+    (void) sfinfo;
+    memset(input, 0, sizeof(mmap_input));
+    return -1;
+}
+
+int mmap_input_read(mmap_input * input, int frames, const short int **audio)
+{
+    (void) input;
+    (void) frames;
+    (void) audio;
+    return 0;
+}
+
+void mmap_input_release(mmap_input * input, const short int *audio)
+{
+    (void) input;
+    (void) audio;
+}
+
+void mmap_input_close(mmap_input * input)
+{
+    memset(input, 0, sizeof(mmap_input));
+}
+
+#endif                          // HAVE_SYS_MMAN_H
+
+
+/* vim:ts=4:sw=4:nowrap: */
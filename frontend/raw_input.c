@@ -0,0 +1,265 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Raw PCM input
+
+   Raw 16-bit, 24-bit, 32-bit and float samples are read straight from the
+   file (or pipe) and converted here, rather than through libsndfile.
+   16-bit samples stay 16-bit; the others become floats (full scale 1.0)
+   for twolame_encode_buffer_float32_interleaved(), so no precision is
+   lost on the way. The conversion loops are kept simple enough for the
+   compiler to vectorise.
+*/
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#include <twolame.h>
+#include <sndfile.h>
+#include "frontend.h"
+
+
+#define RAW_S16LE   (0)
+#define RAW_S16BE   (1)
+#define RAW_S24LE   (2)
+#define RAW_S32LE   (3)
+#define RAW_F32LE   (4)
+
+// in the order of the RAW_ numbers
+static const struct {
+    const char *name;
+    int format;                 // libsndfile format of the same samples
+    int bytes;                  // bytes per sample
+    int is_float;               // read as floats, rather than 16-bit samples
+} raw_formats[] = {
+    { "s16le", SF_FORMAT_RAW | SF_FORMAT_PCM_16 | SF_ENDIAN_LITTLE, 2, FALSE },
+    { "s16be", SF_FORMAT_RAW | SF_FORMAT_PCM_16 | SF_ENDIAN_BIG, 2, FALSE },
+    { "s24le", SF_FORMAT_RAW | SF_FORMAT_PCM_24 | SF_ENDIAN_LITTLE, 3, TRUE },
+    { "s32le", SF_FORMAT_RAW | SF_FORMAT_PCM_32 | SF_ENDIAN_LITTLE, 4, TRUE },
+    { "f32le", SF_FORMAT_RAW | SF_FORMAT_FLOAT | SF_ENDIAN_LITTLE, 4, TRUE },
+    { NULL, 0, 0, FALSE }
+};
+
+
+static int little_endian(void)
+{
+    union {
+        unsigned char b[2];
+        unsigned short s;
+    } detect_endian;
+
+    detect_endian.b[0] = 0x34;
+    detect_endian.b[1] = 0x12;
+    return detect_endian.s == 0x1234;
+}
+
+int raw_input_sf_format(const char *name)
+{
+    int i;
+
+    for (i = 0; raw_formats[i].name != NULL; i++)
+        if (strcmp(name, raw_formats[i].name) == 0)
+            return raw_formats[i].format;
+    return 0;
+}
+
+int raw_input_open(const char *filename, const SF_INFO * sfinfo, raw_input * input)
+{
+    int format = sfinfo->format;
+    struct stat st;
+    int i;
+
+    memset(input, 0, sizeof(raw_input));
+    input->fd = -1;
+
+    if ((format & SF_FORMAT_TYPEMASK) != SF_FORMAT_RAW
+        || sfinfo->channels < 1 || sfinfo->channels > 2)
+        return -1;
+
+    // raw samples with no byte order given are in the machine's
+    if ((format & SF_FORMAT_ENDMASK) == SF_ENDIAN_FILE
+        || (format & SF_FORMAT_ENDMASK) == SF_ENDIAN_CPU)
+        format = (format & ~SF_FORMAT_ENDMASK)
+            | (little_endian() ? SF_ENDIAN_LITTLE : SF_ENDIAN_BIG);
+
+    for (i = 0; raw_formats[i].name != NULL; i++)
+        if (format == raw_formats[i].format)
+            break;
+    if (raw_formats[i].name == NULL)
+        return -1;
+
+    if (strcmp(filename, "-") == 0)
+        input->fd = STDIN_FILENO;
+    else if ((input->fd = open(filename, O_RDONLY)) < 0)
+        return -1;
+
+    if ((input->bytes = (unsigned char *) malloc(AUDIO_BUF_SIZE * 4)) == NULL) {
+        raw_input_close(input);
+        return -1;
+    }
+
+    input->type = i;
+    input->name = raw_formats[i].name;
+    input->sample_bytes = raw_formats[i].bytes;
+    input->is_float = raw_formats[i].is_float;
+    input->channels = sfinfo->channels;
+    input->samplerate = sfinfo->samplerate;
+    if (fstat(input->fd, &st) == 0 && S_ISREG(st.st_mode))
+        input->frames = st.st_size / (input->sample_bytes * input->channels);
+
+    return 0;
+}
+
+/*
+    Read up to size bytes, waiting for a pipe to deliver them all
+    Returns the number of bytes read (errno is kept if reading failed)
+*/
+static int read_fully(raw_input * input, int size)
+{
+    int got = 0;
+
+    while (got < size) {
+        ssize_t bytes = read(input->fd, input->bytes + got, size - got);
+        if (bytes < 0 && errno == EINTR)
+            continue;
+        if (bytes < 0) {
+            input->error = errno;
+            break;
+        }
+        if (bytes == 0)
+            break;
+        got += bytes;
+    }
+    return got;
+}
+
+static void convert_s16le(const unsigned char *in, short int *out, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+        out[i] = (short int) (in[2 * i] | (in[2 * i + 1] << 8));
+}
+
+static void convert_s16be(const unsigned char *in, short int *out, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++)
+        out[i] = (short int) ((in[2 * i] << 8) | in[2 * i + 1]);
+}
+
+static void convert_s24le(const unsigned char *in, float *out, int count)
+{
+    int i;
+
+    // put the sample in the top of an int, so that its sign comes along
+    for (i = 0; i < count; i++) {
+        int x = (int) (((unsigned int) in[3 * i] << 8) | ((unsigned int) in[3 * i + 1] << 16)
+                       | ((unsigned int) in[3 * i + 2] << 24));
+        out[i] = (float) x * (1.0f / 2147483648.0f);
+    }
+}
+
+static void convert_s32le(const unsigned char *in, float *out, int count)
+{
+    int i;
+
+    for (i = 0; i < count; i++) {
+        int x = (int) ((unsigned int) in[4 * i] | ((unsigned int) in[4 * i + 1] << 8)
+                       | ((unsigned int) in[4 * i + 2] << 16) | ((unsigned int) in[4 * i + 3] << 24));
+        out[i] = (float) x * (1.0f / 2147483648.0f);
+    }
+}
+
+static void convert_f32le(const unsigned char *in, float *out, int count)
+{
+    int i;
+
+    if (little_endian()) {
+        memcpy(out, in, count * sizeof(float));
+        return;
+    }
+
+    for (i = 0; i < count; i++) {
+        unsigned int x = (unsigned int) in[4 * i] | ((unsigned int) in[4 * i + 1] << 8)
+            | ((unsigned int) in[4 * i + 2] << 16) | ((unsigned int) in[4 * i + 3] << 24);
+        memcpy(&out[i], &x, sizeof(float));
+    }
+}
+
+int raw_input_read(raw_input * input, void *buffer, int samples)
+{
+    int frame_bytes = input->sample_bytes * input->channels;
+    int bytes, count;
+
+    if (samples > AUDIO_BUF_SIZE)
+        samples = AUDIO_BUF_SIZE;
+    samples -= samples % input->channels;
+
+    bytes = read_fully(input, samples * input->sample_bytes);
+
+    // a sample cut short by the end of the input is dropped
+    count = (bytes / frame_bytes) * input->channels;
+
+    switch (input->type) {
+    case RAW_S16LE:
+        convert_s16le(input->bytes, (short int *) buffer, count);
+        break;
+    case RAW_S16BE:
+        convert_s16be(input->bytes, (short int *) buffer, count);
+        break;
+    case RAW_S24LE:
+        convert_s24le(input->bytes, (float *) buffer, count);
+        break;
+    case RAW_S32LE:
+        convert_s32le(input->bytes, (float *) buffer, count);
+        break;
+    case RAW_F32LE:
+        convert_f32le(input->bytes, (float *) buffer, count);
+        break;
+    }
+
+    return count / input->channels;
+}
+
+void raw_input_close(raw_input * input)
+{
+    if (input->fd > STDIN_FILENO)
+        close(input->fd);
+    free(input->bytes);
+    memset(input, 0, sizeof(raw_input));
+    input->fd = -1;
+}
+
+
+/* vim:ts=4:sw=4:nowrap: */
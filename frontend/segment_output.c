@@ -0,0 +1,193 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+/*
+   Segmented output (--segment)
+
+   The encoder hands each frame to segment_output_write() (its output
+   callback) as soon as it is complete, and the frames are written to a
+   series of files of a fixed number of frames each: out.mp2 becomes
+   out-00000.mp2, out-00001.mp2 and so on. Put together again, the
+   segments are exactly the stream that would have been written to out.mp2.
+
+   As each segment is finished it is added to an HLS style playlist
+   (out.m3u8), so that it can be served while the rest is still being
+   encoded. The playlist is ended once the last segment is in it.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <twolame.h>
+#include <sndfile.h>
+#include "frontend.h"
+
+
+#define SEGMENT_NUMBER_FORMAT   "%s-%05d%s"
+#define SEGMENT_NUMBER_SIZE     (12)    // the - and the number, which can reach 11 characters
+
+
+// length of the directory part of a file name, including the last separator
+static int dir_length(const char *filename)
+{
+    int i, length = 0;
+
+    for (i = 0; filename[i] != '\0'; i++)
+        if (filename[i] == '/' || filename[i] == '\\')
+            length = i + 1;
+    return length;
+}
+
+static void set_error(segment_output * out)
+{
+    if (out->error == 0)
+        out->error = errno ? errno : EIO;
+}
+
+/*
+    Finish the current segment, and add it to the playlist
+*/
+static void end_segment(segment_output * out)
+{
+    const char *name = out->filename;
+
+    if (fclose(out->file) != 0)
+        set_error(out);
+    out->file = NULL;
+
+    // segments in the same directory as the playlist are listed relative to it
+    if (out->same_dir)
+        name += dir_length(name);
+
+    if (fprintf(out->playlist, "#EXTINF:%.3f,\n%s\n",
+                (double) out->frames * TWOLAME_SAMPLES_PER_FRAME / out->samplerate, name) < 0
+        || fflush(out->playlist) != 0)
+        set_error(out);
+
+    out->frames = 0;
+    out->segments++;
+}
+
+int segment_output_open(segment_output * out, const char *filename, const char *playlistname,
+                        int frames_per_segment, int samplerate)
+{
+    int dir = dir_length(filename);
+    const char *dot = strrchr(filename + dir, '.');
+
+    memset(out, 0, sizeof(segment_output));
+    if (frames_per_segment < 1 || samplerate < 1)
+        return -1;
+
+    // out.mp2 is split into out-NNNNN.mp2 (a name without an extension gets .mp2)
+    if (dot == NULL || dot == filename + dir)
+        dot = filename + strlen(filename);
+    snprintf(out->prefix, sizeof(out->prefix), "%.*s", (int) (dot - filename), filename);
+    snprintf(out->suffix, sizeof(out->suffix), "%s", *dot ? dot : OUTPUT_SUFFIX);
+
+    // room for the prefix, the number, the suffix and the terminator
+    out->filename_size = strlen(out->prefix) + SEGMENT_NUMBER_SIZE + strlen(out->suffix) + 1;
+    if ((out->filename = (char *) malloc(out->filename_size)) == NULL)
+        return -1;
+
+    out->frames_per_segment = frames_per_segment;
+    out->samplerate = samplerate;
+    out->same_dir = (dir_length(playlistname) == dir && strncmp(playlistname, filename, dir) == 0);
+
+    if ((out->playlist = fopen(playlistname, "w")) == NULL) {
+        free(out->filename);
+        out->filename = NULL;
+        return -1;
+    }
+
+    // target duration is the longest segment, rounded up to whole seconds
+    if (fprintf(out->playlist, "#EXTM3U\n#EXT-X-VERSION:3\n#EXT-X-PLAYLIST-TYPE:EVENT\n"
+                "#EXT-X-TARGETDURATION:%ld\n#EXT-X-MEDIA-SEQUENCE:0\n",
+                ((long) frames_per_segment * TWOLAME_SAMPLES_PER_FRAME + samplerate - 1)
+                / samplerate) < 0
+        || fflush(out->playlist) != 0)
+        set_error(out);
+
+    return 0;
+}
+
+int segment_output_write(const unsigned char *data, int size, void *user_data)
+{
+    segment_output *out = (segment_output *) user_data;
+
+    if (out->error != 0)
+        return -1;
+
+    // every frame is always taken whole, so each call is exactly one frame
+    if (out->file == NULL) {
+        int length = snprintf(out->filename, out->filename_size, SEGMENT_NUMBER_FORMAT,
+                              out->prefix, out->segments, out->suffix);
+        if (length < 0 || (size_t) length >= out->filename_size) {
+            errno = ENAMETOOLONG;
+            set_error(out);
+            return -1;
+        }
+        if ((out->file = fopen(out->filename, "wb")) == NULL) {
+            set_error(out);
+            return -1;
+        }
+    }
+
+    if (fwrite(data, sizeof(unsigned char), size, out->file) != (size_t) size
+        || (out->flush && fflush(out->file) != 0)) {
+        set_error(out);
+        return -1;
+    }
+    out->bytes += size;
+
+    if (++out->frames == out->frames_per_segment)
+        end_segment(out);
+
+    return (out->error != 0) ? -1 : size;
+}
+
+int segment_output_close(segment_output * out)
+{
+    int error;
+
+    // the last segment can be shorter than the others
+    if (out->file != NULL)
+        end_segment(out);
+
+    if (fprintf(out->playlist, "#EXT-X-ENDLIST\n") < 0)
+        set_error(out);
+    if (fclose(out->playlist) != 0)
+        set_error(out);
+    out->playlist = NULL;
+    free(out->filename);
+    out->filename = NULL;
+
+    error = out->error;
+    if (error != 0) {
+        errno = error;
+        return -1;
+    }
+    return 0;
+}
+
+
+/* vim:ts=4:sw=4:nowrap: */
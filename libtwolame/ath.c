@@ -74,6 +74,12 @@ FLOAT twolame_ath_energy(FLOAT freq, FLOAT value)
 {
     FLOAT db;
     db = twolame_ath_db(freq, 0) + value;   // Originally: ath_db(freq,value)
+    return twolame_ath_db2energy(db);
+}
+
+
+FLOAT twolame_ath_db2energy(FLOAT db)
+{
     /* The values in the standard, and from the ATH formula are in dB. In the psycho model we are
        working in the energy domain. Hence the values that are in the absthr_X tables are not in
        dB. This function converts from dB into the energy domain. As noted on the LAME mailing list
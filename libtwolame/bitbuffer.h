@@ -23,8 +23,20 @@
 #ifndef TWOLAME_BITBUFFER_H
 #define TWOLAME_BITBUFFER_H
 
+#include <stdint.h>
+
 #include "common.h"
 
+/* Bit writer used while a frame is being put together. Bits are collected in a 64-bit
+   accumulator and stored a whole 32-bit word at a time, with no bounds checks: the caller
+   checks once per frame that there is room for it in the bit_stream (see encode_frame()) */
+typedef struct bit_writer_struc {
+    uint64_t acc;               /* pending bits, right aligned */
+    int acc_bits;               /* number of pending bits in acc */
+    unsigned char *ptr;         /* where the next whole byte goes */
+    long totbit;                /* bit counter of bit stream */
+} bit_writer;
+
 void twolame_buffer_init(unsigned char *buffer, int buffer_size, bit_stream *bs);
 void twolame_buffer_deinit(bit_stream ** bs);
 
@@ -77,4 +77,82 @@ static inline void buffer_putbits(bit_stream * bs, unsigned int val, int N)
         printf("buffer_putbits: error. bit_stream buffer needs to be bigger\n");
 }
 
+
+/* start writing at the current position of the bit stream */
+static inline void buffer_writer_begin(bit_writer * bw, bit_stream * bs)
+{
+    bw->ptr = bs->buf + bs->buf_byte_idx;
+    bw->acc_bits = 8 - bs->buf_bit_idx;
+    bw->acc = bw->acc_bits ? (*bw->ptr >> bs->buf_bit_idx) : 0;
+    bw->totbit = bs->totbit;
+}
+
+/* store the pending bits that make up whole bytes */
+static inline void buffer_writer_flush_bytes(bit_writer * bw)
+{
+    while (bw->acc_bits >= 8) {
+        bw->acc_bits -= 8;
+        *bw->ptr++ = (unsigned char) (bw->acc >> bw->acc_bits);
+    }
+}
+
+/* write N bits (N <= 32) with the writer */
+static inline void buffer_writer_putbits(bit_writer * bw, unsigned int val, int N)
+{
+    bw->acc = (bw->acc << N) | (val & (((uint64_t) 1 << N) - 1));
+    bw->acc_bits += N;
+    bw->totbit += N;
+
+    if (bw->acc_bits >= 32) {
+        uint32_t word;
+
+        bw->acc_bits -= 32;
+        word = (uint32_t) (bw->acc >> bw->acc_bits);
+        bw->ptr[0] = (unsigned char) (word >> 24);
+        bw->ptr[1] = (unsigned char) (word >> 16);
+        bw->ptr[2] = (unsigned char) (word >> 8);
+        bw->ptr[3] = (unsigned char) word;
+        bw->ptr += 4;
+    }
+}
+
+/* write N zero bits with the writer, whole bytes are cleared in one go */
+static inline void buffer_writer_put_zero_bits(bit_writer * bw, int N)
+{
+    int align;
+
+    if (N <= 32) {
+        if (N > 0)
+            buffer_writer_putbits(bw, 0, N);
+        return;
+    }
+
+    /* line up on a byte boundary, then store all the pending bytes */
+    align = (8 - (bw->acc_bits & 7)) & 7;
+    buffer_writer_putbits(bw, 0, align);
+    N -= align;
+    buffer_writer_flush_bytes(bw);
+
+    memset(bw->ptr, 0, N >> 3);
+    bw->ptr += N >> 3;
+    bw->totbit += N & ~7;
+
+    buffer_writer_putbits(bw, 0, N & 7);
+}
+
+/* store whatever is left in the writer and hand the position back to the bit stream */
+static inline void buffer_writer_end(bit_writer * bw, bit_stream * bs)
+{
+    buffer_writer_flush_bytes(bw);
+
+    bs->buf_byte_idx = bw->ptr - bs->buf;
+    bs->buf_bit_idx = 8 - bw->acc_bits;
+    bs->totbit = bw->totbit;
+
+    /* buffer_putbits() expects the unused bits of the top byte to be clear */
+    if (bs->buf_byte_idx < bs->buf_size)
+        bs->buf[bs->buf_byte_idx] =
+            bw->acc_bits ? (unsigned char) (bw->acc << (8 - bw->acc_bits)) : 0;
+}
+
 // vim:ts=4:sw=4:nowrap:
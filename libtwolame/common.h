@@ -71,10 +71,25 @@
 #define            CRC16_POLYNOMIAL         0x8005
 #define            CRC8_POLYNOMIAL          0x1D
 #define            FREEFORMAT_MAX_BITRATE   450
+/* 1152 samples at the freeformat maximum and 16kHz (144 * 450000 / 16000 = 4050),
+   plus padding, rounded up */
+#define            MAX_FRAME_BYTES          4096
 
 #define            MIN(A, B)        ((A) < (B) ? (A) : (B))
 #define            MAX(A, B)        ((A) > (B) ? (A) : (B))
 
+/* Hot arrays start on a cache line, so vectorised loops can use aligned
+   loads and no vector straddles two lines. Structures holding them have to
+   be allocated with TWOLAME_MALLOC() or from an arena, which line them up */
+#define            TWOLAME_CACHE_LINE       64
+#if defined(_MSC_VER)
+# define           TWOLAME_ALIGN            __declspec(align(64))
+#elif defined(__GNUC__)
+# define           TWOLAME_ALIGN            __attribute__ ((aligned(64)))
+#else
+# define           TWOLAME_ALIGN
+#endif
+
 
 /* This is the smallest MNR a subband can have before it is counted
    as 'noisy' by the logic which chooses the number of JS subbands */
@@ -117,25 +132,39 @@ psycho 1 mem struct
 ****************************************************************************************/
 #define DBTAB           1000
 
+/* The histories the psycho models keep from one frame to the next are
+   stored as float even when FLOAT is double */
+typedef float HFLOAT;
+
+#define SUBSIZE 136
+
 typedef struct {
     int line;
-    FLOAT bark, hear, x;
+    FLOAT bark, hear;
 } g_thres, *g_ptr;
 
-typedef struct {
-    FLOAT x;
-    int type, next, map;
-} mask, *mask_ptr;
-
 typedef struct psycho_1_mem_struct {
     int off[2];
-    FLOAT fft_buf[2][1408];
+    TWOLAME_ALIGN HFLOAT fft_buf[2][1408];
     int *cbound;
     int crit_band;
     int sub_size;
-    mask_ptr power;
     g_ptr ltg;
-    FLOAT dbtable[DBTAB];
+
+    /* The global masking threshold at each line of ltg */
+    FLOAT ltg_x[SUBSIZE];
+
+    /* The power spectrum, the kind of component at each line and the critical band
+       (index into ltg) of each line */
+    TWOLAME_ALIGN FLOAT x[HAN_SIZE];
+    int type[HAN_SIZE];
+    int map[HAN_SIZE];
+
+    /* The lines of the tonal and non-tonal (one per critical band) components */
+    int tone[HAN_SIZE / 2];
+    int ntone;
+    int noise[SBLIMIT];
+    int nnoise;
 } psycho_1_mem;
 
 
@@ -144,18 +173,23 @@ typedef struct psycho_1_mem_struct {
 Psycho3 memory structure
 ****************************************************************************************/
 #define HBLKSIZE 513
+/* HBLKSIZE rounded up to whole cache lines (of floats or doubles), for the
+   rows of two dimensional arrays */
+#define HBLKSIZE_PADDED 528
 
-#define SUBSIZE 136
-typedef struct psycho_3_mem_struct {
-    int off[2];
-    int freq_subset[SUBSIZE];
-    FLOAT bark[HBLKSIZE];
-    FLOAT ath[HBLKSIZE];
-    FLOAT fft_buf[2][1408];
 #define CRITBANDMAX 32          /* this is much higher than it needs to be. really only about 24 */
+typedef struct {
+    int freq_subset[SUBSIZE];
+    TWOLAME_ALIGN FLOAT bark[HBLKSIZE];
+    TWOLAME_ALIGN FLOAT ath[HBLKSIZE];
     int cbands;                 /* How many critical bands there really are */
     int cbandindex[CRITBANDMAX];    /* The spectral line index of the start of each critical band */
-    FLOAT dbtable[DBTAB];
+} psycho_3_tables;
+
+typedef struct psycho_3_mem_struct {
+    int off[2];
+    TWOLAME_ALIGN HFLOAT fft_buf[2][1408];
+    psycho_3_tables *tables;
 } psycho_3_mem;
 
 
@@ -177,9 +211,9 @@ typedef FLOAT F2_32[2][32];
 typedef FLOAT FCB[CBANDS];
 typedef FLOAT FCBCB[CBANDS][CBANDS];
 typedef FLOAT FBLK[BLKSIZE];
-typedef FLOAT FHBLK[HBLKSIZE];
-typedef FLOAT F2HBLK[2][HBLKSIZE];
-typedef FLOAT F22HBLK[2][2][HBLKSIZE];
+typedef HFLOAT FHBLK[HBLKSIZE_PADDED];
+typedef HFLOAT F2HBLK[2][HBLKSIZE_PADDED];
+typedef HFLOAT F22HBLK[2][2][HBLKSIZE_PADDED];
 typedef FLOAT DCB[CBANDS];
 
 typedef struct psycho_4_mem_struct {
@@ -200,9 +234,14 @@ typedef struct psycho_4_mem_struct {
     FLOAT bc[CBANDS];
     FLOAT cbval[CBANDS];
     FLOAT rnorm[CBANDS];
-    FLOAT wsamp_r[BLKSIZE], phi[BLKSIZE], energy[BLKSIZE], window[BLKSIZE];
-    FLOAT ath[HBLKSIZE], thr[HBLKSIZE], c[HBLKSIZE];
-    FLOAT fthr[HBLKSIZE], absthr[HBLKSIZE]; // psy2 only
+    TWOLAME_ALIGN FLOAT wsamp_r[BLKSIZE];
+    TWOLAME_ALIGN FLOAT phi[BLKSIZE];
+    TWOLAME_ALIGN FLOAT energy[BLKSIZE];
+    TWOLAME_ALIGN FLOAT ath[HBLKSIZE];
+    TWOLAME_ALIGN FLOAT thr[HBLKSIZE];
+    TWOLAME_ALIGN FLOAT c[HBLKSIZE];
+    TWOLAME_ALIGN FLOAT fthr[HBLKSIZE]; // psy2 only
+    TWOLAME_ALIGN FLOAT absthr[HBLKSIZE];       // psy2 only
     int numlines[CBANDS];
     int partition[HBLKSIZE];
     FLOAT *tmn;
@@ -210,7 +249,6 @@ typedef struct psycho_4_mem_struct {
     FHBLK *lthr;
     F2HBLK *r, *phi_sav;
     FLOAT snrtmp[2][32];
-    FLOAT cos_table[TRIGTABLESIZE];
 } psycho_4_mem, psycho_2_mem;
 
 
@@ -219,14 +257,46 @@ typedef struct psycho_4_mem_struct {
 ****************************************************************************************/
 
 typedef struct subband_mem_struct {
-    FLOAT x[2][512];
-    FLOAT m[16][32];
+    TWOLAME_ALIGN FLOAT x[2][512];
     int off[2];
     int half[2];
 } subband_mem;
 
 
 
+/***************************************************************************************
+ Resampling memory structure
+****************************************************************************************/
+
+#define RESAMPLE_MAX_PHASES     1024
+#define RESAMPLE_BUFFER         2048
+typedef struct resample_mem_struct {
+    int up;                     // samplerate_out / samplerate_in is up / down
+    int down;
+    int taps;                   // length of the filter of each phase
+    FLOAT *filter;              // up phases of taps coefficients each
+    int phase;                  // phase of the next output sample
+    int pos;                    // first input sample of the next output sample
+    int length;                 // number of input samples in x
+    int flushed;                // the end of the input has been pushed through the filter
+    TWOLAME_ALIGN FLOAT x[2][RESAMPLE_BUFFER];
+} resample_mem;
+
+
+
+/***************************************************************************************
+ Memory arena
+****************************************************************************************/
+
+typedef struct twolame_arena_struct {
+    void *block;                // as returned by the allocator
+    unsigned char *base;        // start of the arena, on a cache line
+    size_t size;
+    size_t used;
+} twolame_arena;
+
+
+
 /***************************************************************************************
  Header and frame information
 ****************************************************************************************/
@@ -253,6 +323,19 @@ typedef unsigned int subband_t[2][3][SCALE_BLOCK][SBLIMIT];
 typedef FLOAT jsb_sample_t[3][SCALE_BLOCK][SBLIMIT];
 typedef FLOAT sb_sample_t[2][3][SCALE_BLOCK][SBLIMIT];
 
+/* Where the samples of the frame being encoded are read from: either the internal
+   frame buffers, or (for whole frames) the caller's own planar or interleaved PCM */
+typedef struct pcm_view_struc {
+    const short int *pcm[2];    /* first sample of each channel */
+    const float *fpcm[2];       /* or float samples (full scale is 1.0), when not NULL */
+    int stride;                 /* distance between two samples of a channel */
+} pcm_view;
+
+/* Sample i of channel ch of a pcm_view, as a FLOAT with full scale at 1.0 */
+#define PCM_VIEW_SAMPLE(view, ch, i) \
+    ((view)->fpcm[ch] != NULL ? (FLOAT) (view)->fpcm[ch][(i) * (view)->stride] \
+                              : (FLOAT) (view)->pcm[ch][(i) * (view)->stride] / SCALE)
+
 
 
 /***************************************************************************************
@@ -328,7 +411,9 @@ struct twolame_options_struct {
 
     // Used by twolame_encode_frame
     int twolame_init;
-    short int buffer[2][TWOLAME_SAMPLES_PER_FRAME]; // Sample buffer
+    TWOLAME_ALIGN short int buffer[2][TWOLAME_SAMPLES_PER_FRAME];   // Sample buffer
+    TWOLAME_ALIGN float fbuffer[2][TWOLAME_SAMPLES_PER_FRAME];      // Sample buffer for float input
+    pcm_view input;             // Samples of the frame being encoded (usually buffer or fbuffer)
     unsigned int samples_in_buffer; // Number of samples currently in buffer
     unsigned int psycount;
     unsigned int num_crc_bits;  // Number of bits CRC is calculated on
@@ -337,6 +422,7 @@ struct twolame_options_struct {
     unsigned int scfsi[2][SBLIMIT];
     unsigned int scalar[2][3][SBLIMIT];
     unsigned int j_scale[3][SBLIMIT];
+    TWOLAME_ALIGN FLOAT sb_max[2][3][SBLIMIT];  // max. of each set of 12 subband samples
     FLOAT smrdef[2][32];
     FLOAT smr[2][SBLIMIT];
     FLOAT max_sc[2][SBLIMIT];
@@ -349,7 +435,8 @@ struct twolame_options_struct {
 
     /* Resampling stuff */
     FLOAT resample_ratio;
-    void *resample_handle[2];
+    int resample_quality;       // 0 (fastest) to 3 (best) [2]
+    resample_mem *resample;     // NULL unless samplerate_in != samplerate_out
 
 
     // memory for psycho models
@@ -358,6 +445,15 @@ struct twolame_options_struct {
     psycho_2_mem *p2mem;
     psycho_3_mem *p3mem;
     psycho_4_mem *p4mem;
+    int compact_memory;         // share the read-only psycho tables with the cache [FALSE]
+    int psycho_cache_index;     // entry of the psycho cache whose tables are shared, or -1
+
+    // memory allocation
+    twolame_alloc_func alloc_func;
+    twolame_free_func free_func;
+    void *alloc_user_data;
+    void *block;                // this structure, as returned by alloc_func
+    twolame_arena arena;        // everything allocated by twolame_init_params()
 
 
     // memory for subband
@@ -370,6 +466,25 @@ struct twolame_options_struct {
     int tablenum;
 
     int vbrstats[15];
+
+    // Output callback: each frame is handed over from output_frame as soon as it is complete
+    twolame_output_callback output_callback;
+    void *output_user_data;
+    unsigned char output_frame[MAX_FRAME_BYTES];
+    bit_stream output_bs;
+    int output_offset;          // first byte of output_frame not yet taken by the callback
+    int output_pending;         // number of bytes of output_frame not yet taken
+
+    // Frame callback: told where each frame is, once it has been encoded
+    twolame_frame_callback frame_callback;
+    void *frame_callback_data;
+    uint64_t frames_encoded;
+    uint64_t bytes_encoded;
+
+    // Frame trace: called at the end of every frame with sb_sample, scalar, smr and
+    // bit_alloc still in place (only used by the tolerance harness in bench/)
+    void (*frame_trace) (const struct twolame_options_struct * glopts, void *user_data);
+    void *frame_trace_data;
 };
 
 #endif                          // TWOLAME_COMMON_H
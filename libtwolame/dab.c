@@ -30,60 +30,43 @@
 #include "dab.h"
 
 
-void
-twolame_dab_crc_calc(twolame_options * glopts,
-                     unsigned int bit_alloc[2][SBLIMIT],
-                     unsigned int scfsi[2][SBLIMIT],
-                     unsigned int scalar[2][3][SBLIMIT], unsigned int *crc, int packed)
-{
-    int i, j, k;
-    int nch = glopts->num_channels_out;
-    int nb_scalar;
-    int f[5] = { 0, 4, 8, 16, 30 };
-    int first, last;
+/* First subband of each range of subbands protected by one DAB scalefactor CRC byte */
+static const int dab_crc_first_sb[5] = { 0, 4, 8, 16, 30 };
+
+/* CRC8 (polynomial 0x1D) of each 3-bit value, for updating with a whole scalefactor
+   (the CRC covers the top 3 bits of each of them) in one lookup */
+static const unsigned char dab_crc_table3[8] = {
+    0x00, 0x1d, 0x3a, 0x27, 0x74, 0x69, 0x4e, 0x53
+};
 
-    first = f[packed];
-    last = f[packed + 1];
-    if (last > glopts->sblimit)
-        last = glopts->sblimit;
 
-    nb_scalar = 0;
-    *crc = 0x0;
-    for (i = first; i < last; i++)
-        for (k = 0; k < nch; k++)
-            if (bit_alloc[k][i])    /* above jsbound, bit_alloc[0][i] == ba[1][i] */
-                switch (scfsi[k][i]) {
-                case 0:
-                    for (j = 0; j < 3; j++) {
-                        nb_scalar++;
-                        twolame_dab_crc_update(scalar[k][j][i] >> 3, 3, crc);
-                    }
-                    break;
-                case 1:
-                case 3:
-                    nb_scalar += 2;
-                    twolame_dab_crc_update(scalar[k][0][i] >> 3, 3, crc);
-                    twolame_dab_crc_update(scalar[k][2][i] >> 3, 3, crc);
-                    break;
-                case 2:
-                    nb_scalar++;
-                    twolame_dab_crc_update(scalar[k][0][i] >> 3, 3, crc);
-                }
+/* Add a transmitted scalefactor to a DAB scalefactor CRC */
+void twolame_dab_crc_scalefactor(unsigned int scalefactor, unsigned int *crc)
+{
+    *crc = ((*crc << 3) ^ dab_crc_table3[((*crc >> 5) ^ (scalefactor >> 3)) & 7]) & 0xff;
 }
 
-void twolame_dab_crc_update(unsigned int data, unsigned int length, unsigned int *crc)
+
+/* Clear the DAB scalefactor CRCs for a new frame, and point crc_of_sb[sb] at the CRC
+   that covers subband sb (or NULL), so they can be worked out by
+   twolame_write_scalefactors() as it writes the scalefactors out */
+void twolame_dab_crc_start(twolame_options * glopts, unsigned int *crc_of_sb[SBLIMIT])
 {
-    unsigned int masking, carry;
+    int i, sb;
+    int len = glopts->dab_crc_len;
+
+    if (len > 4)
+        len = 4;
 
-    masking = 1 << length;
+    for (sb = 0; sb < SBLIMIT; sb++)
+        crc_of_sb[sb] = NULL;
 
-    while ((masking >>= 1)) {
-        carry = *crc & 0x80;
-        *crc <<= 1;
-        if (!carry ^ !(data & masking))
-            *crc ^= CRC8_POLYNOMIAL;
+    for (i = 0; i < len; i++) {
+        glopts->dab_crc[i] = 0x0;
+        for (sb = dab_crc_first_sb[i]; sb < dab_crc_first_sb[i + 1]; sb++)
+            crc_of_sb[sb] = &glopts->dab_crc[i];
     }
-    *crc &= 0xff;
 }
 
+
 // vim:ts=4:sw=4:nowrap:
@@ -25,6 +25,7 @@
 //#include <stdio.h>
 #include "printf.h"
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include "twolame.h"
@@ -32,6 +33,7 @@
 #include "bitbuffer.h"
 #include "availbits.h"
 #include "encode.h"
+#include "dab.h"
 #include "util.h"
 
 #include "bitbuffer_inline.h"
@@ -282,65 +284,65 @@ int twolame_encode_init(twolame_options * glopts)
    sample_encoding
 */
 
-void twolame_scalefactor_calc(FLOAT sb_sample[][3][SCALE_BLOCK][SBLIMIT],
-                              unsigned int sf_index[][3][SBLIMIT], int nch, int sblimit)
+/* Convert a row of per-subband maxima into scalefactor indices.
+   The result is the index of the smallest scalefactor that is still >= cur_max, which
+   (as the table is strictly decreasing) is just the number of entries 1..63 that are >= cur_max.
+   Counting is done for all subbands at once, so the inner loop is a branch free compare and
+   add over contiguous memory and can be vectorized. It gives exactly the same indices as the
+   old 5-step binary search by Patrick De Smet. */
+static void scalefactor_index_row(const FLOAT cur_max[SBLIMIT], unsigned int sf_index[SBLIMIT],
+                                  int sblimit)
+{
+    unsigned int count[SBLIMIT];
+    int sb, n;
+
+    for (sb = 0; sb < sblimit; sb++)
+        count[sb] = 0;
+    for (n = 1; n < SCALE_RANGE; n++) {
+        FLOAT sf = scalefactor[n];
+        for (sb = 0; sb < sblimit; sb++)
+            count[sb] += (cur_max[sb] <= sf);
+    }
+    for (sb = 0; sb < sblimit; sb++)
+        sf_index[sb] = count[sb];
+}
+
+/* The scalefactor index of the maximum of each set of 12 subband samples, which
+   twolame_window_filter_subband() found as it wrote them */
+void twolame_scalefactor_calc_max(FLOAT sb_max[][3][SBLIMIT],
+                                  unsigned int sf_index[][3][SBLIMIT], int nch, int sblimit)
 {
-    /* Optimized to use binary search instead of linear scan through the scalefactor table;
-       guarantees to find scalefactor in only 5 jumps/comparisons and not in {0 (lin. best) to 63
-       (lin. worst)}. Scalefactors for subbands > sblimit are no longer computed. Uses a single
-       sblimit-loop. Patrick De Smet Oct 1999. */
     int ch, gr;
-    /* Using '--' loops to avoid possible "cmp value + bne/beq" compiler */
-    /* inefficiencies. Below loops should compile to "bne/beq" only code */
-    for (ch = nch; ch--;)
-        for (gr = 3; gr--;) {
-            int sb;
-            for (sb = sblimit; sb--;) {
-                int j;
-                unsigned int l;
-                register FLOAT temp;
-                unsigned int scale_fac;
-                /* Determination of max. over each set of 12 subband samples: */
-                /* PDS TODO: maybe this could/should ??!! be integrated into */
-                /* the subband filtering routines? */
-                register FLOAT cur_max = fabs(sb_sample[ch][gr][SCALE_BLOCK - 1][sb]);
-                for (j = SCALE_BLOCK - 1; j--;) {
-                    if ((temp = fabs(sb_sample[ch][gr][j][sb])) > cur_max)
-                        cur_max = temp;
-                }
-                /* PDS: binary search in the scalefactor table: */
-                /* This is the real speed up: */
-                for (l = 16, scale_fac = 32; l; l >>= 1) {
-                    if (cur_max <= scalefactor[scale_fac])
-                        scale_fac += l;
-                    else
-                        scale_fac -= l;
-                }
-                if (cur_max > scalefactor[scale_fac])
-                    scale_fac--;
-                sf_index[ch][gr][sb] = scale_fac;
-                /* There is a direct way of working out the index, if the maximum value is known
-                   but since it involves a log it isn't really speedy. Items in the scalefactor[]
-                   table are calculated by: the n'th entry = 2 / (cuberoot(2) ^ n) And so using a
-                   bit of maths you get: index = (int)(log(2.0/cur_max) / LNCUBEROOTTWO);
-                   printf("cur_max %.14lf scalefactorindex %i multiple %.14lf\n",cur_max,
-                   scale_fac, scalefactor[scale_fac]); */
-            }
-        }
+
+    for (ch = 0; ch < nch; ch++)
+        for (gr = 0; gr < 3; gr++)
+            scalefactor_index_row(sb_max[ch][gr], sf_index[ch][gr], sblimit);
 }
 
 
-/* Combine L&R channels into a mono joint stereo channel */
-void twolame_combine_lr(FLOAT sb_sample[2][3][SCALE_BLOCK][SBLIMIT],
-                        FLOAT joint_sample[3][SCALE_BLOCK][SBLIMIT], int sblimit)
+/* Combine L&R channels into a mono joint stereo channel, and find its scalefactors in the
+   same pass: the maxima are tracked while the mono samples are being written */
+void twolame_combine_lr_scalefactor_calc(FLOAT sb_sample[2][3][SCALE_BLOCK][SBLIMIT],
+                                         FLOAT joint_sample[3][SCALE_BLOCK][SBLIMIT],
+                                         unsigned int j_scale[3][SBLIMIT], int sblimit)
 {
     int sb, sample, gr;
 
-    for (sb = 0; sb < sblimit; ++sb)
+    for (gr = 0; gr < 3; ++gr) {
+        FLOAT cur_max[SBLIMIT];
+
+        for (sb = 0; sb < sblimit; ++sb)
+            cur_max[sb] = 0;
         for (sample = 0; sample < SCALE_BLOCK; ++sample)
-            for (gr = 0; gr < 3; ++gr)
-                joint_sample[gr][sample][sb] =
-                    .5 * (sb_sample[0][gr][sample][sb] + sb_sample[1][gr][sample][sb]);
+            for (sb = 0; sb < sblimit; ++sb) {
+                FLOAT temp = .5 * (sb_sample[0][gr][sample][sb] + sb_sample[1][gr][sample][sb]);
+                joint_sample[gr][sample][sb] = temp;
+                temp = fabs(temp);
+                cur_max[sb] = (temp > cur_max[sb]) ? temp : cur_max[sb];
+            }
+
+        scalefactor_index_row(cur_max, j_scale[gr], sblimit);
+    }
 }
 
 /* PURPOSE:For each subband, puts the smallest scalefactor of the 3
@@ -453,23 +455,23 @@ void twolame_sf_transmission_pattern(twolame_options * glopts,
         }
 }
 
-void twolame_write_header(twolame_options * glopts, bit_stream * bs)
+void twolame_write_header(twolame_options * glopts, bit_writer * bw)
 {
     frame_header *header = &glopts->header;
 
-    buffer_putbits(bs, 0xfff, 12);  /* syncword 12 bits */
-    buffer_put1bit(bs, header->version);    /* ID 1 bit */
-    buffer_putbits(bs, 4 - header->lay, 2); /* layer 2 bits */
-    buffer_put1bit(bs, !header->error_protection);  /* bit set => no err prot */
-    buffer_putbits(bs, header->bitrate_index, 4);
-    buffer_putbits(bs, header->samplerate_idx, 2);
-    buffer_put1bit(bs, header->padding);
-    buffer_put1bit(bs, header->private_extension);    /* private extension bit */
-    buffer_putbits(bs, header->mode, 2);
-    buffer_putbits(bs, header->mode_ext, 2);
-    buffer_put1bit(bs, header->copyright);
-    buffer_put1bit(bs, header->original);
-    buffer_putbits(bs, header->emphasis, 2);
+    buffer_writer_putbits(bw, 0xfff, 12);  /* syncword 12 bits */
+    buffer_writer_putbits(bw, header->version, 1);    /* ID 1 bit */
+    buffer_writer_putbits(bw, 4 - header->lay, 2); /* layer 2 bits */
+    buffer_writer_putbits(bw, !header->error_protection, 1);  /* bit set => no err prot */
+    buffer_writer_putbits(bw, header->bitrate_index, 4);
+    buffer_writer_putbits(bw, header->samplerate_idx, 2);
+    buffer_writer_putbits(bw, header->padding, 1);
+    buffer_writer_putbits(bw, header->private_extension, 1);    /* private extension bit */
+    buffer_writer_putbits(bw, header->mode, 2);
+    buffer_writer_putbits(bw, header->mode_ext, 2);
+    buffer_writer_putbits(bw, header->copyright, 1);
+    buffer_writer_putbits(bw, header->original, 1);
+    buffer_writer_putbits(bw, header->emphasis, 2);
 }
 
 /*************************************************************************
@@ -480,7 +482,7 @@ void twolame_write_header(twolame_options * glopts, bit_stream * bs)
  4,3,2, or 0 bits depending on the quantization table used.
 
 ************************************************************************/
-void twolame_write_bit_alloc(twolame_options * glopts, unsigned int bit_alloc[2][SBLIMIT], bit_stream * bs)
+void twolame_write_bit_alloc(twolame_options * glopts, unsigned int bit_alloc[2][SBLIMIT], bit_writer * bw)
 {
     int nch = glopts->num_channels_out;
     int sblimit = glopts->sblimit;
@@ -489,7 +491,7 @@ void twolame_write_bit_alloc(twolame_options * glopts, unsigned int bit_alloc[2]
 
     for (sb = 0; sb < sblimit; sb++) {
         for (ch = 0; ch < ((sb < jsbound) ? nch : 1); ch++) {
-            buffer_putbits(bs, bit_alloc[ch][sb], nbal[line[glopts->tablenum][sb]]);
+            buffer_writer_putbits(bw, bit_alloc[ch][sb], nbal[line[glopts->tablenum][sb]]);
             glopts->num_crc_bits += nbal[line[glopts->tablenum][sb]];
         }
     }
@@ -510,37 +512,57 @@ void twolame_write_bit_alloc(twolame_options * glopts, unsigned int bit_alloc[2]
 void twolame_write_scalefactors(twolame_options * glopts,
                                 unsigned int bit_alloc[2][SBLIMIT],
                                 unsigned int sf_selectinfo[2][SBLIMIT],
-                                unsigned int sf_index[2][3][SBLIMIT], bit_stream * bs)
+                                unsigned int sf_index[2][3][SBLIMIT], bit_writer * bw)
 {
     int nch = glopts->num_channels_out;
     int sblimit = glopts->sblimit;
     int sb, gr, ch;
+    unsigned int *dab_crc[SBLIMIT];
 
     /* Write out the scalefactor selection information */
     for (sb = 0; sb < sblimit; sb++)
         for (ch = 0; ch < nch; ch++)
             if (bit_alloc[ch][sb]) {
-                buffer_putbits(bs, sf_selectinfo[ch][sb], 2);
+                buffer_writer_putbits(bw, sf_selectinfo[ch][sb], 2);
                 glopts->num_crc_bits += 2;
             }
 
+    /* For DAB, the scalefactor CRCs are worked out here, on the scalefactors as they go
+       out, rather than by another pass over them. It will be up to the frontend to insert
+       them into the end of the previous frame. */
+    if (glopts->do_dab)
+        twolame_dab_crc_start(glopts, dab_crc);
+    else
+        memset(dab_crc, 0, sizeof(dab_crc));
+
     /* Write out the scalefactors */
     for (sb = 0; sb < sblimit; sb++)
         for (ch = 0; ch < nch; ch++)
             if (bit_alloc[ch][sb])  // above jsbound, bit_alloc[0][i] == ba[1][i]
             {
+                unsigned int *crc = dab_crc[sb];
+
                 switch (sf_selectinfo[ch][sb]) {
                 case 0:
-                    for (gr = 0; gr < 3; gr++)
-                        buffer_putbits(bs, sf_index[ch][gr][sb], 6);
+                    for (gr = 0; gr < 3; gr++) {
+                        buffer_writer_putbits(bw, sf_index[ch][gr][sb], 6);
+                        if (crc)
+                            twolame_dab_crc_scalefactor(sf_index[ch][gr][sb], crc);
+                    }
                     break;
                 case 1:
                 case 3:
-                    buffer_putbits(bs, sf_index[ch][0][sb], 6);
-                    buffer_putbits(bs, sf_index[ch][2][sb], 6);
+                    buffer_writer_putbits(bw, sf_index[ch][0][sb], 6);
+                    buffer_writer_putbits(bw, sf_index[ch][2][sb], 6);
+                    if (crc) {
+                        twolame_dab_crc_scalefactor(sf_index[ch][0][sb], crc);
+                        twolame_dab_crc_scalefactor(sf_index[ch][2][sb], crc);
+                    }
                     break;
                 case 2:
-                    buffer_putbits(bs, sf_index[ch][0][sb], 6);
+                    buffer_writer_putbits(bw, sf_index[ch][0][sb], 6);
+                    if (crc)
+                        twolame_dab_crc_scalefactor(sf_index[ch][0][sb], crc);
                     break;
                 }
             }
@@ -564,6 +586,30 @@ static const FLOAT b[18] = {
     -0.000030518, -0.000015259
 };
 
+/* Quantize one row of subband samples [first, last) for a single
+   (ch, gr, j). All per-subband constants have been looked up beforehand,
+   so the loop is branch free and walks contiguous memory, which lets the
+   compiler vectorize it. */
+static inline void subband_quantize_row(const FLOAT * samples, const FLOAT * scale,
+                                        const FLOAT * qa, const FLOAT * qb, const FLOAT * qsteps,
+                                        const unsigned int *qsign, unsigned int *out,
+                                        int first, int last)
+{
+    int sb;
+
+    for (sb = first; sb < last; sb++) {
+        FLOAT d = samples[sb] / scale[sb] * qa[sb] + qb[sb];
+        int neg = (d < 0);
+        FLOAT offset = neg ? 1 : 0;
+        unsigned int sign = neg ? 0 : qsign[sb];
+
+        /* extract MSB N-1 bits from the FLOATing point sample, and tag the inverted sign bit
+           at position N. The scaled value is always below 32768, so the signed conversion
+           (which has a vector form) is exact */
+        out[sb] = (unsigned int) (int) ((d + offset) * qsteps[sb]) | sign;
+    }
+}
+
 /************************************************************************
    subband_quantization (Layer II)
 
@@ -587,63 +633,57 @@ void twolame_subband_quantization(twolame_options * glopts,
                                   unsigned int bit_alloc[2][SBLIMIT],
                                   unsigned int sbband[2][3][SCALE_BLOCK][SBLIMIT])
 {
-    int sb, j, ch, gr, qnt_coeff_index, sig;
+    int sb, j, ch, gr;
     int nch = glopts->num_channels_out;
     int sblimit = glopts->sblimit;
     int jsbound = glopts->jsbound;
-    FLOAT d;
-
-    for (gr = 0; gr < 3; gr++)
-        for (j = 0; j < SCALE_BLOCK; j++)
-            for (sb = 0; sb < sblimit; sb++)
-                for (ch = 0; ch < ((sb < jsbound) ? nch : 1); ch++)
-
-                    if (bit_alloc[ch][sb]) {
-                        /* scale and quantize FLOATing point sample */
-                        if (nch == 2 && sb >= jsbound)  /* use j-stereo samples */
-                            d = j_samps[gr][j][sb] / scalefactor[j_scale[gr][sb]];
-                        else
-                            d = sb_samples[ch][gr][j][sb] / scalefactor[sf_index[ch][gr][sb]];
-
-                        /* Check that the wrong scale factor hasn't been chosen - which would
-                           result in a scaled sample being > 1.0 This error shouldn't ever happen
-                           *unless* something went wrong in scalefactor calc
-
-                           if (mod (d) > 1.0) printf ("Not scaled properly %d %d %d %d\n",
-                           ch, gr, j, sb); */
-
-                        {
-                            /* 'index' indicates which "step line" we are using */
-                            int index = line[glopts->tablenum][sb];
-
-                            /* Find the "step index" within that line */
-                            qnt_coeff_index = step_index[index][bit_alloc[ch][sb]];
-                        }
-                        d = d * a[qnt_coeff_index] + b[qnt_coeff_index];
-
-                        /* extract MSB N-1 bits from the FLOATing point sample */
-                        if (d >= 0)
-                            sig = 1;
-                        else {
-                            sig = 0;
-                            d += 1.0;
-                        }
+    FLOAT qa[SBLIMIT], qb[SBLIMIT], qsteps[SBLIMIT], scale[SBLIMIT];
+    unsigned int qsign[SBLIMIT];
+
+    /* Above the jsbound of a stereo frame only channel 0 is coded, from the j-stereo samples */
+    if (nch == 1 || jsbound > sblimit)
+        jsbound = sblimit;
+
+    for (ch = 0; ch < nch; ch++) {
+        int last = (ch == 0) ? sblimit : jsbound;
+
+        /* Hoist the quantization coefficients for this channel out of the sample loops.
+           Subbands without bit allocation get a = b = 0 and steps = 0, so they quantize
+           to 0 and are never written out by twolame_write_samples() */
+        for (sb = 0; sb < last; sb++) {
+            int qnt_coeff_index = 0;
+            if (bit_alloc[ch][sb])
+                qnt_coeff_index = step_index[line[glopts->tablenum][sb]][bit_alloc[ch][sb]];
+            qa[sb] = a[qnt_coeff_index];
+            qb[sb] = b[qnt_coeff_index];
+            qsteps[sb] = (FLOAT) steps2n[qnt_coeff_index];
+            qsign[sb] = steps2n[qnt_coeff_index];
+        }
 
-                        sbband[ch][gr][j][sb] =
-                            (unsigned int) (d * (FLOAT) steps2n[qnt_coeff_index]);
-                        /* tag the inverted sign bit to sbband at position N */
-                        /* The bit inversion is a must for grouping with 3,5,9 steps so it is done
-                           for all subbands */
-                        if (sig)
-                            sbband[ch][gr][j][sb] |= steps2n[qnt_coeff_index];
-                    }
+        for (gr = 0; gr < 3; gr++) {
+            /* Look the scalefactors up once for the 12 samples of each subband. The samples
+               are still divided by them: multiplying by the reciprocal rounds differently */
+            for (sb = 0; sb < jsbound; sb++)
+                scale[sb] = scalefactor[sf_index[ch][gr][sb]];
+            for (sb = jsbound; sb < last; sb++)
+                scale[sb] = scalefactor[j_scale[gr][sb]];
+
+            for (j = 0; j < SCALE_BLOCK; j++) {
+                subband_quantize_row(sb_samples[ch][gr][j], scale, qa, qb, qsteps, qsign,
+                                     sbband[ch][gr][j], 0, jsbound);
+                if (last > jsbound)
+                    subband_quantize_row(j_samps[gr][j], scale, qa, qb, qsteps, qsign,
+                                         sbband[ch][gr][j], jsbound, last);
+            }
+        }
+    }
 
     /* Set everything above the sblimit to 0 */
     for (ch = 0; ch < nch; ch++)
         for (gr = 0; gr < 3; gr++)
-            for (sb = 0; sb < SCALE_BLOCK; sb++)
-                for (j = sblimit; j < SBLIMIT; j++)
-                    sbband[ch][gr][sb][j] = 0;
+            for (j = 0; j < SCALE_BLOCK; j++)
+                for (sb = sblimit; sb < SBLIMIT; sb++)
+                    sbband[ch][gr][j][sb] = 0;
 }
 
 /************************************************************************
@@ -659,7 +699,7 @@ void twolame_subband_quantization(twolame_options * glopts,
 ***********************************************************************/
 void twolame_write_samples(twolame_options * glopts,
                            unsigned int sbband[2][3][SCALE_BLOCK][SBLIMIT],
-                           unsigned int bit_alloc[2][SBLIMIT], bit_stream * bs)
+                           unsigned int bit_alloc[2][SBLIMIT], bit_writer * bw)
 {
     unsigned int nch = glopts->num_channels_out;
     unsigned int sblimit = glopts->sblimit;
@@ -679,7 +719,7 @@ void twolame_write_samples(twolame_options * glopts,
                         if (group[thisstep_index] == 3) {
                             /* Going to send 1 sample per codeword -> 3 samples */
                             for (x = 0; x < 3; x++) {
-                                buffer_putbits(bs, sbband[ch][gr][j + x][sb], bits[thisstep_index]);
+                                buffer_writer_putbits(bw, sbband[ch][gr][j + x][sb], bits[thisstep_index]);
                             }
 
                         } else {
@@ -691,7 +731,7 @@ void twolame_write_samples(twolame_options * glopts,
                             temp =
                                 sbband[ch][gr][j][sb] + sbband[ch][gr][j + 1][sb] * y +
                                 sbband[ch][gr][j + 2][sb] * y * y;
-                            buffer_putbits(bs, temp, bits[thisstep_index]);
+                            buffer_writer_putbits(bw, temp, bits[thisstep_index]);
                         }
                     }
                 }
@@ -26,11 +26,12 @@
 
 int twolame_encode_init(twolame_options * glopts);
 
-void twolame_scalefactor_calc(FLOAT sb_sample[][3][SCALE_BLOCK][SBLIMIT],
-                              unsigned int scalar[][3][SBLIMIT], int nch, int sblimit);
+void twolame_scalefactor_calc_max(FLOAT sb_max[][3][SBLIMIT],
+                                  unsigned int scalar[][3][SBLIMIT], int nch, int sblimit);
 
-void twolame_combine_lr(FLOAT sb_sample[2][3][SCALE_BLOCK][SBLIMIT],
-                        FLOAT joint_sample[3][SCALE_BLOCK][SBLIMIT], int sblimit);
+void twolame_combine_lr_scalefactor_calc(FLOAT sb_sample[2][3][SCALE_BLOCK][SBLIMIT],
+                                         FLOAT joint_sample[3][SCALE_BLOCK][SBLIMIT],
+                                         unsigned int j_scale[3][SBLIMIT], int sblimit);
 
 void twolame_find_sf_max(twolame_options * glopts,
                          unsigned int sf_index[2][3][SBLIMIT], FLOAT sf_max[2][SBLIMIT]);
@@ -39,14 +40,14 @@ void twolame_sf_transmission_pattern(twolame_options * glopts,
                                      unsigned int sf_index[2][3][SBLIMIT],
                                      unsigned int sf_selectinfo[2][SBLIMIT]);
 
-void twolame_write_header(twolame_options * glopts, bit_stream * bs);
+void twolame_write_header(twolame_options * glopts, bit_writer * bw);
 
-void twolame_write_bit_alloc(twolame_options * glopts, unsigned int bit_alloc[2][SBLIMIT], bit_stream * bs);
+void twolame_write_bit_alloc(twolame_options * glopts, unsigned int bit_alloc[2][SBLIMIT], bit_writer * bw);
 
 void twolame_write_scalefactors(twolame_options * glopts,
                                 unsigned int bit_alloc[2][SBLIMIT],
                                 unsigned int sf_selectinfo[2][SBLIMIT],
-                                unsigned int scalar[2][3][SBLIMIT], bit_stream * bs);
+                                unsigned int scalar[2][3][SBLIMIT], bit_writer * bw);
 
 void twolame_subband_quantization(twolame_options * glopts,
                                   unsigned int sf_index[2][3][SBLIMIT],
@@ -58,7 +59,7 @@ void twolame_subband_quantization(twolame_options * glopts,
 
 void twolame_write_samples(twolame_options * glopts,
                            unsigned int sbband[2][3][SCALE_BLOCK][SBLIMIT],
-                           unsigned int bit_alloc[2][SBLIMIT], bit_stream * bs);
+                           unsigned int bit_alloc[2][SBLIMIT], bit_writer * bw);
 
 
 /*******************************************************
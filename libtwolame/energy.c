@@ -24,6 +24,7 @@
 
 //#include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
 
 #include "twolame.h"
 #include "common.h"
@@ -65,8 +66,7 @@ void twolame_do_energy_levels(twolame_options * glopts, bit_stream * bs)
        The last 5 bytes *must* be reserved for this to work correctly (otherwise you'll be
        overwriting mpeg audio data) */
 
-    short int *leftpcm = glopts->buffer[0];
-    short int *rightpcm = glopts->buffer[1];
+    const pcm_view *input = &glopts->input;
 
     int i, leftMax, rightMax;
     unsigned char rhibyte, rlobyte, lhibyte, llobyte;
@@ -78,10 +78,12 @@ void twolame_do_energy_levels(twolame_options * glopts, bit_stream * bs)
     // find the maximum in the left and right channels
     leftMax = rightMax = -1;
     for (i = 0; i < TWOLAME_SAMPLES_PER_FRAME; i++) {
-        if (abs(leftpcm[i]) > leftMax)
-            leftMax = abs(leftpcm[i]);
-        if (abs(rightpcm[i]) > rightMax)
-            rightMax = abs(rightpcm[i]);
+        FLOAT left = fabs(PCM_VIEW_SAMPLE(input, 0, i)) * SCALE;
+        FLOAT right = fabs(PCM_VIEW_SAMPLE(input, 1, i)) * SCALE;
+        if (left > leftMax)
+            leftMax = (left > 32767) ? 32767 : (int) left;
+        if (right > rightMax)
+            rightMax = (right > 32767) ? 32767 : (int) right;
     }
 
 
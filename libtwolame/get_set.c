@@ -156,6 +156,30 @@ int twolame_get_out_samplerate(twolame_options * glopts)
     return (glopts->samplerate_out);
 }
 
+int twolame_set_resample_quality(twolame_options * glopts, int quality)
+{
+    if (quality < 0 || quality > 3)
+        return (-1);
+    glopts->resample_quality = quality;
+    return (0);
+}
+
+int twolame_get_resample_quality(twolame_options * glopts)
+{
+    return (glopts->resample_quality);
+}
+
+int twolame_set_compact_memory(twolame_options * glopts, int compact)
+{
+    glopts->compact_memory = compact ? TRUE : FALSE;
+    return (0);
+}
+
+int twolame_get_compact_memory(twolame_options * glopts)
+{
+    return (glopts->compact_memory);
+}
+
 int twolame_set_brate(twolame_options * glopts, int bitrate)
 {
     glopts->bitrate = bitrate;
@@ -349,6 +373,24 @@ int twolame_get_quick_count(twolame_options * glopts)
 }
 
 
+int twolame_set_output_callback(twolame_options * glopts,
+                                twolame_output_callback callback, void *user_data)
+{
+    glopts->output_callback = callback;
+    glopts->output_user_data = user_data;
+    glopts->output_offset = 0;
+    glopts->output_pending = 0;
+    return (0);
+}
+
+int twolame_set_frame_callback(twolame_options * glopts,
+                               twolame_frame_callback callback, void *user_data)
+{
+    glopts->frame_callback = callback;
+    glopts->frame_callback_data = user_data;
+    return (0);
+}
+
 int twolame_set_verbosity(twolame_options * glopts, int verbosity)
 {
     if (verbosity < 0 || verbosity > 10) {
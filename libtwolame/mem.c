@@ -28,21 +28,103 @@
 
 /*******************************************************************************
 *
-*  Allocate number of bytes of memory equal to "size".
+*  Allocate number of bytes of memory equal to "size", cleared and starting
+*  on a cache line. What calloc() returned is kept just before it.
 *
 *******************************************************************************/
 
 void *twolame_malloc(size_t size, int line, char *file)
 {
-    void *ptr = (void *) calloc(size, 1);
+    unsigned char *block = (unsigned char *) calloc(size + TWOLAME_CACHE_LINE, 1);
+    unsigned char *ptr;
 
-    if (ptr == NULL) {
+    if (block == NULL) {
         printf("Unable to allocate %d bytes at line %d of %s\n", (int) size, line, file);
+        return NULL;
     }
 
+    // calloc() lines up to at least a pointer, so there is always room for one
+    ptr = block + TWOLAME_CACHE_LINE - ((size_t) block % TWOLAME_CACHE_LINE);
+    ((void **) ptr)[-1] = block;
+
     return (ptr);
 }
 
+void twolame_free(void *ptr)
+{
+    free(((void **) ptr)[-1]);
+}
+
+
+
+/* The allocator used unless one is given to twolame_init_with_allocator() */
+void *twolame_default_alloc(size_t size, void *user_data)
+{
+    (void) user_data;
+    return TWOLAME_MALLOC(size);
+}
+
+void twolame_default_free(void *ptr, void *user_data)
+{
+    (void) user_data;
+    twolame_free(ptr);
+}
+
+
+/*******************************************************************************
+*
+*  Everything twolame_init_params() sets up for an encoder is placed in one
+*  block of memory, the arena, which is sized up front. Allocations from it
+*  are never freed on their own; the whole arena goes at once.
+*
+*******************************************************************************/
+
+int twolame_arena_init(twolame_options * glopts, size_t size)
+{
+    twolame_arena *arena = &glopts->arena;
+    size_t offset;
+
+    size = TWOLAME_ARENA_SIZE(size);
+    arena->block = glopts->alloc_func(size + TWOLAME_CACHE_LINE - 1, glopts->alloc_user_data);
+    if (arena->block == NULL) {
+        printf("twolame_arena_init(): unable to allocate %lu bytes\n", (unsigned long) size);
+        return -1;
+    }
+
+    // the allocator doesn't have to line it up with a cache line, or clear it
+    offset = (TWOLAME_CACHE_LINE - ((size_t) arena->block % TWOLAME_CACHE_LINE)) % TWOLAME_CACHE_LINE;
+    arena->base = (unsigned char *) arena->block + offset;
+    arena->size = size;
+    arena->used = 0;
+    memset(arena->base, 0, size);
+
+    return 0;
+}
+
+void *twolame_arena_alloc(twolame_arena * arena, size_t size)
+{
+    void *ptr;
+
+    size = TWOLAME_ARENA_SIZE(size);
+    if (arena->used + size > arena->size) {
+        printf("twolame_arena_alloc(): arena of %lu bytes is full\n", (unsigned long) arena->size);
+        return NULL;
+    }
+
+    ptr = arena->base + arena->used;
+    arena->used += size;
+    return ptr;
+}
+
+void twolame_arena_deinit(twolame_options * glopts)
+{
+    twolame_arena *arena = &glopts->arena;
+
+    if (arena->block != NULL)
+        glopts->free_func(arena->block, glopts->alloc_user_data);
+    memset(arena, 0, sizeof(twolame_arena));
+}
+
 
 
 // vim:ts=4:sw=4:nowrap:
@@ -41,10 +41,21 @@
 
 // Macros
 #define TWOLAME_MALLOC(size) twolame_malloc( size, __LINE__, __FILE__ )
-#define TWOLAME_FREE(ptr) if(ptr!=NULL) { free(ptr); ptr=NULL; }
+#define TWOLAME_FREE(ptr) if(ptr!=NULL) { twolame_free(ptr); ptr=NULL; }
+
+// Everything in an arena starts on a new cache line
+#define TWOLAME_ARENA_SIZE(size) \
+    (((size_t) (size) + TWOLAME_CACHE_LINE - 1) & ~((size_t) TWOLAME_CACHE_LINE - 1))
 
 // Functions
 void *twolame_malloc(size_t size, int line, char *file);
+void twolame_free(void *ptr);
+void *twolame_default_alloc(size_t size, void *user_data);
+void twolame_default_free(void *ptr, void *user_data);
+
+int twolame_arena_init(twolame_options * glopts, size_t size);
+void *twolame_arena_alloc(twolame_arena * arena, size_t size);
+void twolame_arena_deinit(twolame_options * glopts);
 
 #endif
 
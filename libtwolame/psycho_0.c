@@ -24,12 +24,14 @@
 
 //#include <stdio.h>
 #include <math.h>
+#include <string.h>
 
 #include "twolame.h"
 #include "common.h"
 #include "ath.h"
 #include "mem.h"
 #include "psycho_0.h"
+#include "tables.h"
 
 /* MFC Mar 03
    It's almost obscene how well this psycho model works for the amount of
@@ -51,10 +53,11 @@
    logs, whatever. Fiddle with the numbers until we get a good SMR output */
 
 
-static psycho_0_mem *twolame_psycho_0_init(twolame_options * glopts, int sfreq)
+psycho_0_mem *twolame_psycho_0_init(twolame_options * glopts, int sfreq)
 {
     FLOAT freqperline = (FLOAT) sfreq / 1024.0;
     psycho_0_mem *mem = (psycho_0_mem *) TWOLAME_MALLOC(sizeof(psycho_0_mem));
+    const FLOAT *athtab = twolame_ath_table(sfreq);
     int sb, i;
 
     for (sb = 0; sb < SBLIMIT; sb++) {
@@ -64,7 +67,7 @@ static psycho_0_mem *twolame_psycho_0_init(twolame_options * glopts, int sfreq)
     /* Find the minimum ATH in each subband */
     for (i = 0; i < 512; i++) {
         FLOAT thisfreq = i * freqperline;
-        FLOAT ath_val = twolame_ath_db(thisfreq, 0);
+        FLOAT ath_val = (athtab != NULL) ? athtab[i] : twolame_ath_db(thisfreq, 0);
         if (ath_val < mem->ath_min[i >> 4])
             mem->ath_min[i >> 4] = ath_val;
     }
@@ -78,26 +81,12 @@ void twolame_psycho_0(twolame_options * glopts, FLOAT SMR[2][SBLIMIT], unsigned
 {
     psycho_0_mem *mem;
     int nch = glopts->num_channels_out;
-    int sfreq = glopts->samplerate_out;
     int ch, sb, gr;
     unsigned int minscaleindex[2][SBLIMIT]; /* Smaller scale indexes mean bigger scalefactors */
 
-    if (!glopts->p0mem) {
-        glopts->p0mem = twolame_psycho_0_init(glopts, sfreq);
-    }
+    // set up by twolame_init_params()
     mem = glopts->p0mem;
 
-
-    /* call functions for critical boundaries, freq. */
-    if (!glopts->p0mem) {       /* bands, bark values, and mapping */
-
-    } else {
-
-        mem = glopts->p0mem;
-
-    }
-
-
     /* Find the minimum scalefactor index for each ch/sb */
     for (ch = 0; ch < nch; ch++)
         for (sb = 0; sb < SBLIMIT; sb++)
@@ -118,6 +107,17 @@ void twolame_psycho_0(twolame_options * glopts, FLOAT SMR[2][SBLIMIT], unsigned
 }
 
 
+/* A new copy of the tables of mem, for another encoder, placed in arena */
+psycho_0_mem *twolame_psycho_0_copy(const psycho_0_mem * src, twolame_arena * arena)
+{
+    psycho_0_mem *mem = (psycho_0_mem *) twolame_arena_alloc(arena, sizeof(psycho_0_mem));
+
+    if (mem != NULL)
+        memcpy(mem, src, sizeof(psycho_0_mem));
+    return mem;
+}
+
+
 void twolame_psycho_0_deinit(psycho_0_mem ** mem)
 {
 
@@ -26,12 +26,14 @@
 #include "printf.h"
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 
 #include "twolame.h"
 #include "common.h"
 #include "mem.h"
 #include "fft.h"
 #include "psycho_1.h"
+#include "tables.h"
 
 /**********************************************************************
 
@@ -108,27 +110,17 @@ static void psycho_1_read_freq_band(g_ptr * ltg, int lay, int freq, int *sub_siz
 }
 
 
-static void psycho_1_make_map(int sub_size, mask power[HAN_SIZE], g_thres * ltg)
+static void psycho_1_make_map(int sub_size, int map[HAN_SIZE], g_thres * ltg)
 /* this function calculates the global masking threshold */
 {
     int i, j;
 
     for (i = 1; i < sub_size; i++)
         for (j = ltg[i - 1].line; j <= ltg[i].line; j++)
-            power[j].map = i;
+            map[j] = i;
 }
 
-static void psycho_1_init_add_db(psycho_1_mem * mem)
-{
-    int i;
-    FLOAT x;
-    for (i = 0; i < DBTAB; i++) {
-        x = (FLOAT) i / 10.0;
-        mem->dbtable[i] = 10 * log10(1 + pow(10.0, x / 10.0)) - x;
-    }
-}
-
-static inline FLOAT add_db(psycho_1_mem * mem, FLOAT a, FLOAT b)
+static inline FLOAT add_db(FLOAT a, FLOAT b)
 {
     /* MFC - if the difference between a and b is large (>99), then just return the largest one.
        (about 10% of the time) - For differences between 0 and 99, return the largest value, but
@@ -147,10 +139,10 @@ static inline FLOAT add_db(psycho_1_mem * mem, FLOAT a, FLOAT b)
 
     idiff = (int) fdiff;
     if (idiff >= 0) {
-        return (a + mem->dbtable[idiff]);
+        return (a + twolame_psycho_1_dbtable[idiff]);
     }
 
-    return (b + mem->dbtable[-idiff]);
+    return (b + twolame_psycho_1_dbtable[-idiff]);
 }
 
 /****************************************************************
@@ -161,38 +153,27 @@ static inline FLOAT add_db(psycho_1_mem * mem, FLOAT a, FLOAT b)
 *
 *
 ****************************************************************/
-static void psycho_1_hann_fft_pickmax(FLOAT sample[FFT_SIZE], mask power[HAN_SIZE],
+static void psycho_1_hann_fft_pickmax(FLOAT sample[FFT_SIZE], psycho_1_mem * mem,
                                       FLOAT spike[SBLIMIT], FLOAT energy[FFT_SIZE])
 {
     FLOAT x_real[FFT_SIZE];
+    FLOAT *x = mem->x;
+    int *type = mem->type;
     register int i, j;
-    register FLOAT sqrt_8_over_3;
-    static int init = 0;
-    static FLOAT window[FFT_SIZE];
     FLOAT sum;
 
-    if (!init) {
-        /* calculate window function for the Fourier transform */
-        /* These values need only be initiliased once, regardless of the caller */
-        sqrt_8_over_3 = pow(8.0 / 3.0, 0.5);
-        for (i = 0; i < FFT_SIZE; i++) {
-            /* Hann window formula */
-            window[i] = sqrt_8_over_3 * 0.5 * (1 - cos(2.0 * PI * i / (FFT_SIZE))) / FFT_SIZE;
-        }
-        init = 1;
-    }
+    /* window the samples with the Hann window for the Fourier transform */
     for (i = 0; i < FFT_SIZE; i++)
-        x_real[i] = (FLOAT) (sample[i] * window[i]);
+        x_real[i] = (FLOAT) (sample[i] * twolame_psycho_1_window[i]);
 
     twolame_psycho_1_fft(x_real, energy, FFT_SIZE);
 
     for (i = 0; i < HAN_SIZE; i++) {    /* calculate power density spectrum */
         if (energy[i] < 1E-20)
-            power[i].x = -200.0 + POWERNORM;
+            x[i] = -200.0 + POWERNORM;
         else
-            power[i].x = 10 * log10(energy[i]) + POWERNORM;
-        power[i].next = STOP;
-        power[i].type = FALSE;
+            x[i] = 10 * log10(energy[i]) + POWERNORM;
+        type[i] = FALSE;
     }
 
     /* Calculate the sum of spectral component in each subband from bound 4-16 */
@@ -212,30 +193,28 @@ static void psycho_1_hann_fft_pickmax(FLOAT sample[FFT_SIZE], mask power[HAN_SIZ
 *
 ****************************************************************/
 
-static void psycho_1_tonal_label(psycho_1_mem * mem, int *tone)
+static void psycho_1_tonal_label(psycho_1_mem * mem)
 /* this function extracts (tonal)  sinusoidals from the spectrum  */
 {
-    int i, j, last = LAST, first, run, last_but_one = LAST; /* dpwe */
+    FLOAT *x = mem->x;
+    int *type = mem->type;
+    int *tone = mem->tone;
+    int peak[HAN_SIZE / 2];
+    int npeak = 0, ntone = 0, ended = FALSE;
+    int i, j, k, first, run, last = LAST, last_but_one = LAST; /* dpwe */
     FLOAT max;
-    mask *power = mem->power;
 
-    *tone = LAST;
+    /* the local maxima are the candidates for tonal components */
     for (i = 2; i < HAN_SIZE - 12; i++) {
-        if (power[i].x > power[i - 1].x && power[i].x >= power[i + 1].x) {
-            power[i].type = TONE;
-            power[i].next = LAST;
-            if (last != LAST)
-                power[last].next = i;
-            else
-                first = *tone = i;
-            last = i;
+        if (x[i] > x[i - 1] && x[i] >= x[i + 1]) {
+            type[i] = TONE;
+            peak[npeak++] = i;
         }
     }
-    last = LAST;
-    first = *tone;
-    *tone = LAST;
-    while ((first != LAST) && (first != STOP)) {    /* the conditions for the tonal */
-        if (first < 3 || first > 500)
+
+    for (k = 0; k < npeak; k++) {
+        first = peak[k];
+        if (first < 3 || first > 500)   /* the conditions for the tonal */
             run = 0;            /* otherwise k+/-j will be out of bounds */
         else if (first < 63)
             run = 2;            /* components in layer II, which */
@@ -245,47 +224,46 @@ static void psycho_1_tonal_label(psycho_1_mem * mem, int *tone)
             run = 6;            /* the tonal components */
         else
             run = 12;
-        max = power[first].x - 7;   /* after calculation of tonal */
+        max = x[first] - 7;     /* after calculation of tonal */
         for (j = 2; j <= run; j++)  /* components, set to local max */
-            if (max < power[first - j].x || max < power[first + j].x) {
-                power[first].type = FALSE;
+            if (max < x[first - j] || max < x[first + j]) {
+                type[first] = FALSE;
                 break;
             }
-        if (power[first].type == TONE) {    /* extract tonal components */
-            int help = first;
-            if (*tone == LAST)
-                *tone = first;
-            while ((power[help].next != LAST) && (power[help].next - first) <= run)
-                help = power[help].next;
-            help = power[help].next;
-            power[first].next = help;
-            if ((first - last) <= run) {
-                if (last_but_one != LAST)
-                    power[last_but_one].next = first;
-            }
-            if (first > 1 && first < 500) { /* calculate the sum of the */
-                FLOAT tmp;      /* powers of the components */
-                tmp = add_db(mem, power[first - 1].x, power[first + 1].x);
-                power[first].x = add_db(mem, power[first].x, tmp);
-            }
-            for (j = 1; j <= run; j++) {
-                power[first - j].x = power[first + j].x = DBMIN;
-                power[first - j].next = power[first + j].next = STOP;
-                power[first - j].type = power[first + j].type = FALSE;
+        if (type[first] != TONE)
+            continue;
+
+        /* extract tonal components: the maxima within run lines above are
+           skipped, as they are cleared along with the rest of the lines within run */
+        while (k + 1 < npeak && peak[k + 1] - first <= run)
+            k++;
+        if (first > 1 && first < 500) { /* calculate the sum of the */
+            FLOAT tmp;          /* powers of the components */
+            tmp = add_db(x[first - 1], x[first + 1]);
+            x[first] = add_db(x[first], tmp);
+        }
+        for (j = 1; j <= run; j++) {
+            x[first - j] = x[first + j] = DBMIN;
+            type[first - j] = type[first + j] = FALSE;
+        }
+
+        /* The list ends up as the linked list of dist10 did: if the last component was
+           within run lines it has just been cleared, and is replaced by this one if the
+           component before it is still in the list. Otherwise the list stops there. */
+        if (!ended) {
+            if (last != LAST && first - last <= run) {
+                if (ntone > 1 && tone[ntone - 2] == last_but_one)
+                    tone[ntone - 1] = first;
+                else
+                    ended = TRUE;
+            } else {
+                tone[ntone++] = first;
             }
-            last_but_one = last;
-            last = first;
-            first = power[first].next;
-        } else {
-            int ll;
-            if (last == LAST);  /* *tone = power[first].next; dpwe */
-            else
-                power[last].next = power[first].next;
-            ll = first;
-            first = power[first].next;
-            power[ll].next = STOP;
         }
+        last_but_one = last;
+        last = first;
     }
+    mem->ntone = ntone;
 }
 
 /****************************************************************
@@ -296,25 +274,25 @@ static void psycho_1_tonal_label(psycho_1_mem * mem, int *tone)
 *
 ****************************************************************/
 
-static void psycho_1_noise_label(psycho_1_mem * mem, int *noise, FLOAT energy[FFT_SIZE])
+static void psycho_1_noise_label(psycho_1_mem * mem, FLOAT energy[FFT_SIZE])
 {
-    int i, j, centre, last = LAST;
+    int i, j, centre;
     FLOAT index, weight, sum;
     int crit_band = mem->crit_band;
     int *cbound = mem->cbound;
-    mask *power = mem->power;
+    FLOAT *x = mem->x;
+    int *type = mem->type;
+    int nnoise = 0;
     /* calculate the remaining spectral */
     for (i = 0; i < crit_band - 1; i++) {   /* lines for non-tonal components */
         for (j = cbound[i], weight = 0.0, sum = DBMIN; j < cbound[i + 1]; j++) {
-            if (power[j].type != TONE) {
-                if (power[j].x != DBMIN) {
-                    sum = add_db(mem, power[j].x, sum);
-                    /* Weight is used in finding the geometric mean of the noise energy within a
-                       subband */
-                    weight += CF * energy[j] * (FLOAT) (j - cbound[i]) / (FLOAT) (cbound[i + 1] - cbound[i]);   /* correction
-                                                                                                                 */
-                    power[j].x = DBMIN;
-                }
+            if (type[j] != TONE && x[j] != DBMIN) {
+                sum = add_db(x[j], sum);
+                /* Weight is used in finding the geometric mean of the noise energy within a
+                   subband */
+                weight += CF * energy[j] * (FLOAT) (j - cbound[i]) / (FLOAT) (cbound[i + 1] - cbound[i]);   /* correction
+                                                                                                             */
+                x[j] = DBMIN;
             }                   /* check to see if the spectral line is low dB, and if */
         }                       /* so replace the center of the critical band, which is */
         /* the center freq. of the noise component */
@@ -333,23 +311,18 @@ static void psycho_1_noise_label(psycho_1_mem * mem, int *noise, FLOAT energy[FF
         /* add to list of non-tonal components */
 
         /* Masahiro Iwadare's fix for infinite looping problem? */
-        if (power[centre].type == TONE) {
-            if (power[centre + 1].type == TONE) {
+        if (type[centre] == TONE) {
+            if (type[centre + 1] == TONE) {
                 centre++;
             } else
                 centre--;
         }
 
-        if (last == LAST)
-            *noise = centre;
-        else {
-            power[centre].next = LAST;
-            power[last].next = centre;
-        }
-        power[centre].x = sum;
-        power[centre].type = NOISE;
-        last = centre;
+        mem->noise[nnoise++] = centre;
+        x[centre] = sum;
+        type[centre] = NOISE;
     }
+    mem->nnoise = nnoise;
 }
 
 /****************************************************************
@@ -359,65 +332,57 @@ static void psycho_1_noise_label(psycho_1_mem * mem, int *noise, FLOAT energy[FF
 *
 ****************************************************************/
 
-static void psycho_1_subsampling(mask power[HAN_SIZE], g_thres * ltg, int *tone, int *noise)
+static void psycho_1_subsampling(psycho_1_mem * mem)
 {
-    int i, old;
-
-    i = *tone;
-    old = STOP;                 /* calculate tonal components for */
-
-    while ((i != LAST) && (i != STOP)) {    /* reduction of spectral lines */
-        if (power[i].x < ltg[power[i].map].hear) {
-            power[i].type = FALSE;
-            power[i].x = DBMIN;
-            if (old == STOP)
-                *tone = power[i].next;
-            else
-                power[old].next = power[i].next;
+    FLOAT *x = mem->x;
+    int *type = mem->type;
+    int *map = mem->map;
+    int *tone = mem->tone;
+    int *noise = mem->noise;
+    g_thres *ltg = mem->ltg;
+    int i, k, n;
+
+    for (k = 0, n = 0; k < mem->ntone; k++) {   /* calculate tonal components for */
+        i = tone[k];            /* reduction of spectral lines */
+        if (x[i] < ltg[map[i]].hear) {
+            type[i] = FALSE;
+            x[i] = DBMIN;
         } else
-            old = i;
-        i = power[i].next;
+            tone[n++] = i;
     }
-    i = *noise;
-    old = STOP;                 /* calculate non-tonal components for */
-    while ((i != LAST) && (i != STOP)) {    /* reduction of spectral lines */
-        if (power[i].x < ltg[power[i].map].hear) {
-            power[i].type = FALSE;
-            power[i].x = DBMIN;
-            if (old == STOP)
-                *noise = power[i].next;
-            else
-                power[old].next = power[i].next;
+    mem->ntone = n;
+
+    for (k = 0, n = 0; k < mem->nnoise; k++) {  /* calculate non-tonal components for */
+        i = noise[k];           /* reduction of spectral lines */
+        if (x[i] < ltg[map[i]].hear) {
+            type[i] = FALSE;
+            x[i] = DBMIN;
         } else
-            old = i;
-        i = power[i].next;
+            noise[n++] = i;
     }
-    i = *tone;
-    old = STOP;
-    while ((i != LAST) && (i != STOP)) {    /* if more than one */
-        if (power[i].next == LAST)
-            break;              /* tonal component */
-        if (ltg[power[power[i].next].map].bark -    /* is less than .5 */
-                ltg[power[i].map].bark < 0.5) { /* bark, take the */
-            if (power[power[i].next].x > power[i].x) {  /* maximum */
-                if (old == STOP)
-                    *tone = power[i].next;
-                else
-                    power[old].next = power[i].next;
-                power[i].type = FALSE;
-                power[i].x = DBMIN;
-                i = power[i].next;
+    mem->nnoise = n;
+
+    if (mem->ntone == 0)
+        return;
+    i = tone[0];
+    for (k = 1, n = 0; k < mem->ntone; k++) {   /* if more than one */
+        int next = tone[k];     /* tonal component */
+        if (ltg[map[next]].bark - ltg[map[i]].bark < 0.5) { /* is less than .5 */
+            if (x[next] > x[i]) {   /* bark, take the maximum */
+                type[i] = FALSE;
+                x[i] = DBMIN;
+                i = next;
             } else {
-                power[power[i].next].type = FALSE;
-                power[power[i].next].x = DBMIN;
-                power[i].next = power[power[i].next].next;
-                old = i;
+                type[next] = FALSE;
+                x[next] = DBMIN;
             }
         } else {
-            old = i;
-            i = power[i].next;
+            tone[n++] = i;
+            i = next;
         }
     }
+    tone[n++] = i;
+    mem->ntone = n;
 }
 
 /****************************************************************
@@ -428,57 +393,69 @@ static void psycho_1_subsampling(mask power[HAN_SIZE], g_thres * ltg, int *tone,
 ****************************************************************/
 
 /* mainly just changed the way range checking was done MFC Nov 1999 */
-static void psycho_1_threshold(psycho_1_mem * mem, int *tone, int *noise, int bit_rate)
+static void psycho_1_threshold(psycho_1_mem * mem, int bit_rate)
 {
     int sub_size = mem->sub_size;
-    mask *power = mem->power;
-    g_thres *ltg = mem->ltg;
+    const g_thres *ltg = mem->ltg;
+    FLOAT *ltg_x = mem->ltg_x;
+    int ntone = mem->ntone;
+    int nnoise = mem->nnoise;
+    FLOAT tone_bark[HAN_SIZE / 2], tone_x[HAN_SIZE / 2], tone_tmps[HAN_SIZE / 2];
+    FLOAT noise_bark[SBLIMIT], noise_x[SBLIMIT], noise_tmps[SBLIMIT];
     int k, t;
-    FLOAT dz, tmps, vf;
+    FLOAT dz, vf;
+
+    /* gather the bark value, power and masking index of each component */
+    for (t = 0; t < ntone; t++) {
+        tone_bark[t] = ltg[mem->map[mem->tone[t]]].bark;
+        tone_x[t] = mem->x[mem->tone[t]];
+        tone_tmps[t] = -1.525 - 0.275 * tone_bark[t] - 4.5 + tone_x[t];
+    }
+    for (t = 0; t < nnoise; t++) {
+        noise_bark[t] = ltg[mem->map[mem->noise[t]]].bark;
+        noise_x[t] = mem->x[mem->noise[t]];
+        noise_tmps[t] = -1.525 - 0.175 * noise_bark[t] - 0.5 + noise_x[t];
+    }
 
     for (k = 1; k < sub_size; k++) {
-        ltg[k].x = DBMIN;
-        t = *tone;              /* calculate individual masking threshold for */
-        while ((t != LAST) && (t != STOP)) {    /* components in order to find the global */
-            dz = ltg[k].bark - ltg[power[t].map].bark;  /* distance of bark value */
+        ltg_x[k] = DBMIN;
+        /* calculate individual masking threshold for */
+        for (t = 0; t < ntone; t++) {   /* components in order to find the global */
+            dz = ltg[k].bark - tone_bark[t];    /* distance of bark value */
             if (dz >= -3.0 && dz < 8.0) {
-                tmps = -1.525 - 0.275 * ltg[power[t].map].bark - 4.5 + power[t].x;
                 /* masking function for lower & upper slopes */
                 if (dz < -1)
-                    vf = 17 * (dz + 1) - (0.4 * power[t].x + 6);
+                    vf = 17 * (dz + 1) - (0.4 * tone_x[t] + 6);
                 else if (dz < 0)
-                    vf = (0.4 * power[t].x + 6) * dz;
+                    vf = (0.4 * tone_x[t] + 6) * dz;
                 else if (dz < 1)
                     vf = (-17 * dz);
                 else
-                    vf = -(dz - 1) * (17 - 0.15 * power[t].x) - 17;
-                ltg[k].x = add_db(mem, ltg[k].x, tmps + vf);
+                    vf = -(dz - 1) * (17 - 0.15 * tone_x[t]) - 17;
+                ltg_x[k] = add_db(ltg_x[k], tone_tmps[t] + vf);
             }
-            t = power[t].next;
         }
 
-        t = *noise;             /* calculate individual masking threshold */
-        while ((t != LAST) && (t != STOP)) {    /* for non-tonal components to find LTG */
-            dz = ltg[k].bark - ltg[power[t].map].bark;  /* distance of bark value */
+        /* calculate individual masking threshold */
+        for (t = 0; t < nnoise; t++) {  /* for non-tonal components to find LTG */
+            dz = ltg[k].bark - noise_bark[t];   /* distance of bark value */
             if (dz >= -3.0 && dz < 8.0) {
-                tmps = -1.525 - 0.175 * ltg[power[t].map].bark - 0.5 + power[t].x;
                 /* masking function for lower & upper slopes */
                 if (dz < -1)
-                    vf = 17 * (dz + 1) - (0.4 * power[t].x + 6);
+                    vf = 17 * (dz + 1) - (0.4 * noise_x[t] + 6);
                 else if (dz < 0)
-                    vf = (0.4 * power[t].x + 6) * dz;
+                    vf = (0.4 * noise_x[t] + 6) * dz;
                 else if (dz < 1)
                     vf = (-17 * dz);
                 else
-                    vf = -(dz - 1) * (17 - 0.15 * power[t].x) - 17;
-                ltg[k].x = add_db(mem, ltg[k].x, tmps + vf);
+                    vf = -(dz - 1) * (17 - 0.15 * noise_x[t]) - 17;
+                ltg_x[k] = add_db(ltg_x[k], noise_tmps[t] + vf);
             }
-            t = power[t].next;
         }
         if (bit_rate < 96)
-            ltg[k].x = add_db(mem, ltg[k].hear, ltg[k].x);
+            ltg_x[k] = add_db(ltg[k].hear, ltg_x[k]);
         else
-            ltg[k].x = add_db(mem, ltg[k].hear - 12.0, ltg[k].x);
+            ltg_x[k] = add_db(ltg[k].hear - 12.0, ltg_x[k]);
     }
 
 }
@@ -490,7 +467,8 @@ static void psycho_1_threshold(psycho_1_mem * mem, int *tone, int *noise, int bi
 *
 ****************************************************************/
 
-static void psycho_1_minimum_mask(int sub_size, g_thres * ltg, FLOAT ltmin[SBLIMIT], int sblimit)
+static void psycho_1_minimum_mask(int sub_size, const g_thres * ltg, const FLOAT ltg_x[SUBSIZE],
+                                  FLOAT ltmin[SBLIMIT], int sblimit)
 {
     FLOAT min;
     int i, j;
@@ -500,10 +478,10 @@ static void psycho_1_minimum_mask(int sub_size, g_thres * ltg, FLOAT ltmin[SBLIM
         if (j >= sub_size - 1)  /* check subband limit, and */
             ltmin[i] = ltg[sub_size - 1].hear;  /* calculate the minimum masking */
         else {                  /* level of LTMIN for each subband */
-            min = ltg[j].x;
+            min = ltg_x[j];
             while (ltg[j].line >> 4 == i && j < sub_size) {
-                if (min > ltg[j].x)
-                    min = ltg[j].x;
+                if (min > ltg_x[j])
+                    min = ltg_x[j];
                 j++;
             }
             ltmin[i] = min;
@@ -534,67 +512,105 @@ static void psycho_1_smr(FLOAT ltmin[SBLIMIT], FLOAT spike[SBLIMIT], FLOAT scale
 
 
 /*
-static void psycho_1_dump(mask power[HAN_SIZE], int *tone, int *noise) {
+static void psycho_1_dump(psycho_1_mem * mem) {
   int t;
 
   printf("1 Ton: ");
-  t=*tone;
-  while (t!=LAST && t!=STOP) {
-    printf("[%i] %3.0f ",t, power[t].x);
-    t = power[t].next;
-  }
+  for (t = 0; t < mem->ntone; t++)
+    printf("[%i] %3.0f ", mem->tone[t], mem->x[mem->tone[t]]);
   printf("\n");
 
   printf("1 Nos: ");
-  t=*noise;
-  while (t!=LAST && t!=STOP) {
-    printf("[%i] %3.0f ",t, power[t].x);
-    t = power[t].next;
-  }
+  for (t = 0; t < mem->nnoise; t++)
+    printf("[%i] %3.0f ", mem->noise[t], mem->x[mem->noise[t]]);
   printf("\n");
 }
 */
 
 
-void twolame_psycho_1(twolame_options * glopts, short buffer[2][1152], FLOAT scale[2][SBLIMIT],
-                      FLOAT ltmin[2][SBLIMIT])
+psycho_1_mem *twolame_psycho_1_init(twolame_options * glopts)
 {
     psycho_1_mem *mem;
     frame_header *header = &glopts->header;
+    int i;
+
+    /* bands, bark values, and mapping */
+    mem = (psycho_1_mem *) TWOLAME_MALLOC(sizeof(psycho_1_mem));
+    if (mem == NULL)
+        return NULL;
+
+    if (header->version == TWOLAME_MPEG1) {
+        mem->cbound =
+            psycho_1_read_cbound(header->lay, header->samplerate_idx, &mem->crit_band);
+        psycho_1_read_freq_band(&mem->ltg, header->lay, header->samplerate_idx, &mem->sub_size);
+    } else {
+        mem->cbound =
+            psycho_1_read_cbound(header->lay, header->samplerate_idx + 4, &mem->crit_band);
+        psycho_1_read_freq_band(&mem->ltg, header->lay, header->samplerate_idx + 4,
+                                &mem->sub_size);
+    }
+    psycho_1_make_map(mem->sub_size, mem->map, mem->ltg);
+    for (i = 0; i < 1408; i++)
+        mem->fft_buf[0][i] = mem->fft_buf[1][i] = 0;
+
+    mem->off[0] = 256;
+    mem->off[1] = 256;
+
+    return mem;
+}
+
+
+/* The number of bytes twolame_psycho_1_copy() takes from an arena */
+size_t twolame_psycho_1_size(const psycho_1_mem * src, int share_tables)
+{
+    size_t size = TWOLAME_ARENA_SIZE(sizeof(psycho_1_mem));
+
+    if (!share_tables)
+        size += TWOLAME_ARENA_SIZE(sizeof(int) * src->crit_band)
+            + TWOLAME_ARENA_SIZE(sizeof(g_thres) * src->sub_size);
+    return size;
+}
+
+
+/* A new copy of the tables of mem, for another encoder, placed in arena.
+   With share_tables the read-only tables are used in place rather than
+   copied, so src has to outlive the copy */
+psycho_1_mem *twolame_psycho_1_copy(const psycho_1_mem * src, int share_tables,
+                                    twolame_arena * arena)
+{
+    psycho_1_mem *mem = (psycho_1_mem *) twolame_arena_alloc(arena, sizeof(psycho_1_mem));
+
+    if (mem == NULL)
+        return NULL;
+
+    memcpy(mem, src, sizeof(psycho_1_mem));
+    if (share_tables)
+        return mem;
+
+    mem->cbound = (int *) twolame_arena_alloc(arena, sizeof(int) * src->crit_band);
+    mem->ltg = (g_ptr) twolame_arena_alloc(arena, sizeof(g_thres) * src->sub_size);
+    if (mem->cbound == NULL || mem->ltg == NULL)
+        return NULL;
+    memcpy(mem->cbound, src->cbound, sizeof(int) * src->crit_band);
+    memcpy(mem->ltg, src->ltg, sizeof(g_thres) * src->sub_size);
+
+    return mem;
+}
+
+
+void twolame_psycho_1(twolame_options * glopts, const pcm_view * input, FLOAT scale[2][SBLIMIT],
+                      FLOAT ltmin[2][SBLIMIT])
+{
+    psycho_1_mem *mem;
     int nch = glopts->num_channels_out;
     int sblimit = glopts->sblimit;
-    int k, i, tone = 0, noise = 0;
+    int k, i;
     FLOAT sample[FFT_SIZE];
     FLOAT spike[2][SBLIMIT];
-    FLOAT *fft_buf[2];
+    HFLOAT *fft_buf[2];
     FLOAT energy[FFT_SIZE];
 
-    /* call functions for critical boundaries, freq. */
-    if (!glopts->p1mem) {       /* bands, bark values, and mapping */
-        mem = (psycho_1_mem *) TWOLAME_MALLOC(sizeof(psycho_1_mem));
-
-        mem->power = (mask_ptr) TWOLAME_MALLOC(sizeof(mask) * HAN_SIZE);
-        if (header->version == TWOLAME_MPEG1) {
-            mem->cbound =
-                psycho_1_read_cbound(header->lay, header->samplerate_idx, &mem->crit_band);
-            psycho_1_read_freq_band(&mem->ltg, header->lay, header->samplerate_idx, &mem->sub_size);
-        } else {
-            mem->cbound =
-                psycho_1_read_cbound(header->lay, header->samplerate_idx + 4, &mem->crit_band);
-            psycho_1_read_freq_band(&mem->ltg, header->lay, header->samplerate_idx + 4,
-                                    &mem->sub_size);
-        }
-        psycho_1_make_map(mem->sub_size, mem->power, mem->ltg);
-        for (i = 0; i < 1408; i++)
-            mem->fft_buf[0][i] = mem->fft_buf[1][i] = 0;
-
-        psycho_1_init_add_db(mem);  /* create the add_db table */
-
-        mem->off[0] = 256;
-        mem->off[1] = 256;
-
-        glopts->p1mem = mem;
-    }
+    /* the critical boundaries and frequencies were set up by twolame_init_params() */
     {
         mem = glopts->p1mem;
 
@@ -608,7 +624,7 @@ void twolame_psycho_1(twolame_options * glopts, short buffer[2][1152], FLOAT sca
         /* sami's speedup, added in 02j saves about 4% overall during an encode */
         int ok = mem->off[k] % 1408;
         for (i = 0; i < 1152; i++) {
-            fft_buf[k][ok++] = (FLOAT) buffer[k][i] / SCALE;
+            fft_buf[k][ok++] = PCM_VIEW_SAMPLE(input, k, i);
             if (ok >= 1408)
                 ok = 0;
         }
@@ -621,13 +637,13 @@ void twolame_psycho_1(twolame_options * glopts, short buffer[2][1152], FLOAT sca
         mem->off[k] += 1152;
         mem->off[k] %= 1408;
 
-        psycho_1_hann_fft_pickmax(sample, mem->power, &spike[k][0], energy);
-        psycho_1_tonal_label(mem, &tone);
-        psycho_1_noise_label(mem, &noise, energy);
-        // psycho_1_dump(power, &tone, &noise) ;
-        psycho_1_subsampling(mem->power, mem->ltg, &tone, &noise);
-        psycho_1_threshold(mem, &tone, &noise, glopts->bitrate / nch);
-        psycho_1_minimum_mask(mem->sub_size, mem->ltg, &ltmin[k][0], sblimit);
+        psycho_1_hann_fft_pickmax(sample, mem, &spike[k][0], energy);
+        psycho_1_tonal_label(mem);
+        psycho_1_noise_label(mem, energy);
+        // psycho_1_dump(mem);
+        psycho_1_subsampling(mem);
+        psycho_1_threshold(mem, glopts->bitrate / nch);
+        psycho_1_minimum_mask(mem->sub_size, mem->ltg, mem->ltg_x, &ltmin[k][0], sblimit);
         psycho_1_smr(&ltmin[k][0], &spike[k][0], &scale[k][0], sblimit);
     }
 
@@ -641,7 +657,6 @@ void twolame_psycho_1_deinit(psycho_1_mem ** mem)
 
     TWOLAME_FREE((*mem)->cbound);
     TWOLAME_FREE((*mem)->ltg);
-    TWOLAME_FREE((*mem)->power);
     TWOLAME_FREE((*mem));
 }
 
@@ -23,7 +23,11 @@
 #ifndef TWOLAME_PSYCHO_1_H
 #define TWOLAME_PSYCHO_1_H
 
-void twolame_psycho_1(twolame_options * glopts, short int buffer[2][1152], FLOAT scale[2][32],
+psycho_1_mem *twolame_psycho_1_init(twolame_options * glopts);
+size_t twolame_psycho_1_size(const psycho_1_mem * src, int share_tables);
+psycho_1_mem *twolame_psycho_1_copy(const psycho_1_mem * src, int share_tables,
+                                    twolame_arena * arena);
+void twolame_psycho_1(twolame_options * glopts, const pcm_view * input, FLOAT scale[2][32],
                       FLOAT ltmin[2][32]);
 void twolame_psycho_1_deinit(psycho_1_mem ** mem);
 
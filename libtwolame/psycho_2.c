@@ -33,6 +33,7 @@
 #include "mem.h"
 #include "fft.h"
 #include "psycho_2.h"
+#include "tables.h"
 
 /* The static variables "r", "phi_sav", "new", "old" and "oldest" have      */
 /* to be remembered for the unpredictability measure.  For "r" and          */
@@ -81,7 +82,6 @@ psycho_2_mem *twolame_psycho_2_init(twolame_options * glopts, int sfreq)
 {
     psycho_2_mem *mem;
     FLOAT *cbval, *rnorm;
-    FLOAT *window;
     int *numlines;
     int *partition;
     FCB *s;
@@ -118,7 +118,6 @@ psycho_2_mem *twolame_psycho_2_init(twolame_options * glopts, int sfreq)
     {
         cbval = mem->cbval;
         rnorm = mem->rnorm;
-        window = mem->window;
         numlines = mem->numlines;
         partition = mem->partition;
         s = mem->s;
@@ -146,11 +145,6 @@ psycho_2_mem *twolame_psycho_2_init(twolame_options * glopts, int sfreq)
     printf("absthr[][] sampling frequency index: %d\n", sfreq_idx);
     psycho_2_read_absthr(mem->absthr, sfreq_idx);
 
-
-    /* calculate HANN window coefficients */
-    /* for(i=0;i<BLKSIZE;i++)window[i]=0.5*(1-cos(2.0*PI*i/(BLKSIZE-1.0))); */
-    for (i = 0; i < BLKSIZE; i++)
-        window[i] = 0.5 * (1 - cos(2.0 * PI * (i - 0.5) / BLKSIZE));
     /* reset states used in unpredictability measure */
     for (i = 0; i < HBLKSIZE; i++) {
         mem->r[0][0][i] = mem->r[1][0][i] = mem->r[0][1][i] = mem->r[1][1][i] = 0;
@@ -251,8 +245,8 @@ psycho_2_mem *twolame_psycho_2_init(twolame_options * glopts, int sfreq)
     return (mem);
 }
 
-void twolame_psycho_2(twolame_options * glopts, short int buffer[2][1152],
-                      short int savebuf[2][1056], FLOAT smr[2][32])
+void twolame_psycho_2(twolame_options * glopts, const pcm_view * input,
+                      FLOAT savebuf[2][1056], FLOAT smr[2][32])
 {
     psycho_2_mem *mem;
     unsigned int i, j, k, ch;
@@ -263,7 +257,8 @@ void twolame_psycho_2(twolame_options * glopts, short int buffer[2][1152],
     FLOAT *grouped_c, *grouped_e;
     FLOAT *nb, *cb, *ecb, *bc;
     FLOAT *cbval, *rnorm;
-    FLOAT *wsamp_r, *phi, *energy, *window;
+    FLOAT *wsamp_r, *phi, *energy;
+    const FLOAT *window;
     FLOAT *c;
     FLOAT *fthr;
 
@@ -277,12 +272,8 @@ void twolame_psycho_2(twolame_options * glopts, short int buffer[2][1152],
     FLOAT *absthr;
 
     int nch = glopts->num_channels_out;
-    int sfreq = glopts->samplerate_out;
-
 
-    if (!glopts->p2mem) {
-        glopts->p2mem = twolame_psycho_2_init(glopts, sfreq);
-    }
+    // set up by twolame_init_params()
     mem = glopts->p2mem;
     {
         grouped_c = mem->grouped_c;
@@ -296,7 +287,7 @@ void twolame_psycho_2(twolame_options * glopts, short int buffer[2][1152],
         wsamp_r = mem->wsamp_r;
         phi = mem->phi;
         energy = mem->energy;
-        window = mem->window;
+        window = twolame_psycho_4_window;
         c = mem->c;
 
         snrtmp[0] = mem->snrtmp[0];
@@ -328,17 +319,16 @@ void twolame_psycho_2(twolame_options * glopts, short int buffer[2][1152],
                  BLKSIZE = 1024
              *****************************************************************************/
             {
-                short int *bufferp = buffer[ch];
                 for (j = 0; j < 480; j++) {
                     savebuf[ch][j] = savebuf[ch][j + mem->flush];
                     wsamp_r[j] = window[j] * ((FLOAT) savebuf[ch][j]);
                 }
                 for (; j < 1024; j++) {
-                    savebuf[ch][j] = *bufferp++;
+                    savebuf[ch][j] = PCM_VIEW_SAMPLE(input, ch, j - 480) * SCALE;
                     wsamp_r[j] = window[j] * ((FLOAT) savebuf[ch][j]);
                 }
                 for (; j < 1056; j++)
-                    savebuf[ch][j] = *bufferp++;
+                    savebuf[ch][j] = PCM_VIEW_SAMPLE(input, ch, j - 480) * SCALE;
             }
 
             /**Compute FFT****************************************************************/
@@ -512,6 +502,53 @@ void twolame_psycho_2(twolame_options * glopts, short int buffer[2][1152],
 
 }
 
+/* The number of bytes twolame_psycho_2_copy() takes from an arena */
+size_t twolame_psycho_2_size(const psycho_2_mem * src, int share_tables)
+{
+    size_t size = TWOLAME_ARENA_SIZE(sizeof(psycho_2_mem)) + TWOLAME_ARENA_SIZE(sizeof(F2HBLK))
+        + 2 * TWOLAME_ARENA_SIZE(sizeof(F22HBLK));
+
+    (void) src;
+    if (!share_tables)
+        size += TWOLAME_ARENA_SIZE(sizeof(DCB)) + TWOLAME_ARENA_SIZE(sizeof(FCBCB));
+    return size;
+}
+
+
+/* A new copy of the tables of mem, for another encoder, placed in arena.
+   With share_tables the read-only tables are used in place rather than
+   copied, so src has to outlive the copy */
+psycho_2_mem *twolame_psycho_2_copy(const psycho_2_mem * src, int share_tables,
+                                    twolame_arena * arena)
+{
+    psycho_2_mem *mem = (psycho_2_mem *) twolame_arena_alloc(arena, sizeof(psycho_2_mem));
+
+    if (mem == NULL)
+        return NULL;
+
+    memcpy(mem, src, sizeof(psycho_2_mem));
+    if (!share_tables) {
+        mem->tmn = (FLOAT *) twolame_arena_alloc(arena, sizeof(DCB));
+        mem->s = (FCB *) twolame_arena_alloc(arena, sizeof(FCBCB));
+    }
+    mem->lthr = (FHBLK *) twolame_arena_alloc(arena, sizeof(F2HBLK));
+    mem->r = (F2HBLK *) twolame_arena_alloc(arena, sizeof(F22HBLK));
+    mem->phi_sav = (F2HBLK *) twolame_arena_alloc(arena, sizeof(F22HBLK));
+    if (mem->tmn == NULL || mem->s == NULL || mem->lthr == NULL
+            || mem->r == NULL || mem->phi_sav == NULL)
+        return NULL;
+    if (!share_tables) {
+        memcpy(mem->tmn, src->tmn, sizeof(DCB));
+        memcpy(mem->s, src->s, sizeof(FCBCB));
+    }
+    memcpy(mem->lthr, src->lthr, sizeof(F2HBLK));
+    memcpy(mem->r, src->r, sizeof(F22HBLK));
+    memcpy(mem->phi_sav, src->phi_sav, sizeof(F22HBLK));
+
+    return mem;
+}
+
+
 void twolame_psycho_2_deinit(psycho_2_mem ** mem)
 {
 
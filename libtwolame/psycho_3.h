@@ -23,7 +23,11 @@
 #ifndef TWOLAME_PSYCHO_3_H
 #define TWOLAME_PSYCHO_3_H
 
-void twolame_psycho_3(twolame_options * glopts, short int buffer[2][1152], FLOAT scale[2][32],
+psycho_3_mem *twolame_psycho_3_init(twolame_options * glopts);
+size_t twolame_psycho_3_size(const psycho_3_mem * src, int share_tables);
+psycho_3_mem *twolame_psycho_3_copy(const psycho_3_mem * src, int share_tables,
+                                    twolame_arena * arena);
+void twolame_psycho_3(twolame_options * glopts, const pcm_view * input, FLOAT scale[2][32],
                       FLOAT ltmin[2][32], unsigned int * elapsed_time_psycho_3);
 void twolame_psycho_3_deinit(psycho_3_mem ** mem);
 
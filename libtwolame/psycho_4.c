@@ -33,6 +33,7 @@
 #include "fft.h"
 #include "ath.h"
 #include "psycho_4.h"
+#include "tables.h"
 
 /****************************************************************
 PSYCHO_4 by MFC Feb 2003
@@ -88,21 +89,12 @@ static const FLOAT minval[27] = {
 };
 
 
-/* Table covers angles from     0 to TRIGTABLESIZE/TRIGTABLESCALE (3.142) radians
+/* twolame_psycho_4_cos_table covers angles from 0 to TRIGTABLESIZE/TRIGTABLESCALE (3.142) radians
    In steps of 1/TRIGTABLESCALE (0.0005) radians.
    Largest absolute error: 0.0005
    Only create a table for cos, and then use trig to work out sin.
    sin(theta) = cos(PI/2 - theta)
    MFC March 2003 */
-static void psycho_4_trigtable_init(psycho_4_mem * p4mem)
-{
-
-    int i;
-    for (i = 0; i < TRIGTABLESIZE; i++) {
-        p4mem->cos_table[i] = cos((FLOAT) i / TRIGTABLESCALE);
-    }
-}
-
 #ifdef NEWTAN
 static inline FLOAT psycho_4_cos(psycho_4_mem * p4mem, FLOAT phi)
 {
@@ -116,7 +108,7 @@ static inline FLOAT psycho_4_cos(psycho_4_mem * p4mem, FLOAT phi)
         index -= TRIGTABLESIZE;
         sign *= -1;
     }
-    return (sign * p4mem->cos_table[index]);
+    return (sign * twolame_psycho_4_cos_table[index]);
 }
 #endif
 
@@ -164,12 +156,12 @@ static FLOAT psycho_4_spreading_function(FLOAT bark)
 /********************************
  * init psycho model 2
  ********************************/
-static psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq)
+psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq)
 {
     psycho_4_mem *mem;
     FLOAT *cbval, *rnorm;
-    FLOAT *window;
     FLOAT bark[HBLKSIZE], *ath;
+    const FLOAT *athtab = twolame_ath_table(sfreq);
     int *numlines;
     int *partition;
     FCB *s;
@@ -193,7 +185,6 @@ static psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq)
     {
         cbval = mem->cbval;
         rnorm = mem->rnorm;
-        window = mem->window;
         // bark = mem->bark;
         ath = mem->ath;
         numlines = mem->numlines;
@@ -203,13 +194,6 @@ static psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq)
     }
 
 
-    /* Set up the SIN/COS tables */
-    psycho_4_trigtable_init(mem);
-
-    /* calculate HANN window coefficients */
-    for (i = 0; i < BLKSIZE; i++)
-        window[i] = 0.5 * (1 - cos(2.0 * PI * (i - 0.5) / BLKSIZE));
-
     /* For each FFT line from 0(DC) to 512(Nyquist) calculate - bark : the bark value of this fft
        line - ath : the absolute threshold of hearing for this line [ATH]
 
@@ -222,7 +206,10 @@ static psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq)
         /* The ath tables in the dist10 code seem to be a little out of kilter. they seem to start
            with index 0 corresponding to (sampling freq)/1024. When in doubt, i'm going to assume
            that the dist10 code is wrong. MFC Feb2003 */
-        ath[i] = twolame_ath_energy(freq, glopts->athlevel);
+        if (athtab != NULL)
+            ath[i] = twolame_ath_db2energy(athtab[i] + glopts->athlevel);
+        else
+            ath[i] = twolame_ath_energy(freq, glopts->athlevel);
         // printf("%.2f ",ath[i]);
     }
 
@@ -297,7 +284,7 @@ static psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq)
 
 
 void twolame_psycho_4(twolame_options * glopts,
-                      short int buffer[2][1152], short int savebuf[2][1056], FLOAT smr[2][32])
+                      const pcm_view * input, FLOAT savebuf[2][1056], FLOAT smr[2][32])
 /* to match prototype : FLOAT args are always FLOAT */
 {
     psycho_4_mem *mem;
@@ -308,7 +295,8 @@ void twolame_psycho_4(twolame_options * glopts,
     FLOAT *grouped_c, *grouped_e;
     FLOAT *nb, *cb, *tb, *ecb, *bc;
     FLOAT *cbval, *rnorm;
-    FLOAT *wsamp_r, *phi, *energy, *window;
+    FLOAT *wsamp_r, *phi, *energy;
+    const FLOAT *window;
     FLOAT *ath, *thr, *c;
 
     FLOAT *snrtmp[2];
@@ -319,12 +307,8 @@ void twolame_psycho_4(twolame_options * glopts,
     F2HBLK *r, *phi_sav;
 
     int nch = glopts->num_channels_out;
-    int sfreq = glopts->samplerate_out;
-
-    if (!glopts->p4mem) {
-        glopts->p4mem = twolame_psycho_4_init(glopts, sfreq);
-    }
 
+    // set up by twolame_init_params()
     mem = glopts->p4mem;
     {
         grouped_c = mem->grouped_c;
@@ -339,7 +323,7 @@ void twolame_psycho_4(twolame_options * glopts,
         wsamp_r = mem->wsamp_r;
         phi = mem->phi;
         energy = mem->energy;
-        window = mem->window;
+        window = twolame_psycho_4_window;
         ath = mem->ath;
         thr = mem->thr;
         c = mem->c;
@@ -365,17 +349,16 @@ void twolame_psycho_4(twolame_options * glopts,
                flush = 384*3.0/2.0; = 576 syncsize = 1056; sync_flush = syncsize - flush; 480
                BLKSIZE = 1024 */
             {
-                short int *bufferp = buffer[ch];
                 for (j = 0; j < 480; j++) {
                     savebuf[ch][j] = savebuf[ch][j + 576];
                     wsamp_r[j] = window[j] * ((FLOAT) savebuf[ch][j]);
                 }
                 for (; j < 1024; j++) {
-                    savebuf[ch][j] = *bufferp++;
+                    savebuf[ch][j] = PCM_VIEW_SAMPLE(input, ch, j - 480) * SCALE;
                     wsamp_r[j] = window[j] * ((FLOAT) savebuf[ch][j]);
                 }
                 for (; j < 1056; j++)
-                    savebuf[ch][j] = *bufferp++;
+                    savebuf[ch][j] = PCM_VIEW_SAMPLE(input, ch, j - 480) * SCALE;
             }
 
             /* Compute FFT */
@@ -544,6 +527,53 @@ void twolame_psycho_4(twolame_options * glopts,
 }
 
 
+/* The number of bytes twolame_psycho_4_copy() takes from an arena */
+size_t twolame_psycho_4_size(const psycho_4_mem * src, int share_tables)
+{
+    size_t size = TWOLAME_ARENA_SIZE(sizeof(psycho_4_mem)) + TWOLAME_ARENA_SIZE(sizeof(F2HBLK))
+        + 2 * TWOLAME_ARENA_SIZE(sizeof(F22HBLK));
+
+    (void) src;
+    if (!share_tables)
+        size += TWOLAME_ARENA_SIZE(sizeof(DCB)) + TWOLAME_ARENA_SIZE(sizeof(FCBCB));
+    return size;
+}
+
+
+/* A new copy of the tables of mem, for another encoder, placed in arena.
+   With share_tables the read-only tables are used in place rather than
+   copied, so src has to outlive the copy */
+psycho_4_mem *twolame_psycho_4_copy(const psycho_4_mem * src, int share_tables,
+                                    twolame_arena * arena)
+{
+    psycho_4_mem *mem = (psycho_4_mem *) twolame_arena_alloc(arena, sizeof(psycho_4_mem));
+
+    if (mem == NULL)
+        return NULL;
+
+    memcpy(mem, src, sizeof(psycho_4_mem));
+    if (!share_tables) {
+        mem->tmn = (FLOAT *) twolame_arena_alloc(arena, sizeof(DCB));
+        mem->s = (FCB *) twolame_arena_alloc(arena, sizeof(FCBCB));
+    }
+    mem->lthr = (FHBLK *) twolame_arena_alloc(arena, sizeof(F2HBLK));
+    mem->r = (F2HBLK *) twolame_arena_alloc(arena, sizeof(F22HBLK));
+    mem->phi_sav = (F2HBLK *) twolame_arena_alloc(arena, sizeof(F22HBLK));
+    if (mem->tmn == NULL || mem->s == NULL || mem->lthr == NULL
+            || mem->r == NULL || mem->phi_sav == NULL)
+        return NULL;
+    if (!share_tables) {
+        memcpy(mem->tmn, src->tmn, sizeof(DCB));
+        memcpy(mem->s, src->s, sizeof(FCBCB));
+    }
+    memcpy(mem->lthr, src->lthr, sizeof(F2HBLK));
+    memcpy(mem->r, src->r, sizeof(F22HBLK));
+    memcpy(mem->phi_sav, src->phi_sav, sizeof(F22HBLK));
+
+    return mem;
+}
+
+
 void twolame_psycho_4_deinit(psycho_4_mem ** mem)
 {
 
@@ -560,5 +590,4 @@ void twolame_psycho_4_deinit(psycho_4_mem ** mem)
 }
 
 
-
 // vim:ts=4:sw=4:nowrap:
@@ -23,7 +23,11 @@
 #ifndef TWOLAME_PSYCHO_4_H
 #define TWOLAME_PSYCHO_4_H
 
-void twolame_psycho_4(twolame_options * glopts, short int buffer[2][1152], short int savebuf[2][1056],
+psycho_4_mem *twolame_psycho_4_init(twolame_options * glopts, int sfreq);
+size_t twolame_psycho_4_size(const psycho_4_mem * src, int share_tables);
+psycho_4_mem *twolame_psycho_4_copy(const psycho_4_mem * src, int share_tables,
+                                    twolame_arena * arena);
+void twolame_psycho_4(twolame_options * glopts, const pcm_view * input, FLOAT savebuf[2][1056],
                       FLOAT smr[2][32]);
 void twolame_psycho_4_deinit(psycho_4_mem ** mem);
 
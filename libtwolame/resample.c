@@ -0,0 +1,261 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *  Copyright (C) 2023 IObundle, Lda
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+//#include <stdio.h>
+#include "printf.h"
+#include <string.h>
+#include <math.h>
+
+#include "twolame.h"
+#include "common.h"
+#include "mem.h"
+#include "resample.h"
+
+
+/*
+   Polyphase sample rate converter
+
+   The ratio of the samplerates is reduced to up/down. Conceptually the input
+   is zero-stuffed up times, lowpass filtered and then every down'th sample is
+   kept, but only the filter taps that land on real input samples are worked
+   out: each output sample uses one of the up phases of the filter.
+*/
+
+
+/* Filter length (per phase, and per input sample of decimation),
+   passband edge (as a fraction of the lower Nyquist frequency)
+   and Kaiser window beta for each quality setting */
+static const int resample_taps[4] = { 8, 16, 32, 64 };
+static const FLOAT resample_rolloff[4] = { 0.80, 0.86, 0.91, 0.95 };
+static const FLOAT resample_beta[4] = { 5.0, 6.5, 8.0, 9.5 };
+
+
+static int gcd(int a, int b)
+{
+    while (b != 0) {
+        int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Modified Bessel function of the first kind, order 0 (for the Kaiser window) */
+static double bessel_i0(double x)
+{
+    double sum = 1.0, term = 1.0;
+    int k;
+
+    for (k = 1; k < 50; k++) {
+        term *= (x / (2.0 * k)) * (x / (2.0 * k));
+        sum += term;
+        if (term < sum * 1e-12)
+            break;
+    }
+    return sum;
+}
+
+
+/* Reduce the ratio of the samplerates and pick the filter length */
+static int resample_setup(int samplerate_in, int samplerate_out, int *quality,
+                          int *up, int *down, int *taps)
+{
+    if (samplerate_in <= 0 || samplerate_out <= 0)
+        return -1;
+    if (*quality < 0)
+        *quality = 0;
+    if (*quality > 3)
+        *quality = 3;
+
+    *up = samplerate_out / gcd(samplerate_in, samplerate_out);
+    *down = samplerate_in / gcd(samplerate_in, samplerate_out);
+    if (*up > RESAMPLE_MAX_PHASES || *down > 8 * *up) {
+        printf("twolame_resample_init(): can't resample from %d Hz to %d Hz.\n",
+               samplerate_in, samplerate_out);
+        return -1;
+    }
+
+    // when decimating the passband shrinks, so the filter has to get longer
+    *taps = resample_taps[*quality];
+    if (*down > *up)
+        *taps *= (*down + *up - 1) / *up;
+
+    return 0;
+}
+
+
+/* The number of bytes twolame_resample_init() takes from an arena, or 0 if
+   the samplerates can't be converted */
+size_t twolame_resample_size(int samplerate_in, int samplerate_out, int quality)
+{
+    int up, down, taps;
+
+    if (resample_setup(samplerate_in, samplerate_out, &quality, &up, &down, &taps) < 0)
+        return 0;
+    return TWOLAME_ARENA_SIZE(sizeof(resample_mem)) + TWOLAME_ARENA_SIZE(sizeof(FLOAT) * up * taps);
+}
+
+
+resample_mem *twolame_resample_init(int samplerate_in, int samplerate_out, int quality,
+                                    twolame_arena * arena)
+{
+    resample_mem *mem;
+    int up, down, taps, length, p, j;
+    double cutoff, center;
+
+    if (resample_setup(samplerate_in, samplerate_out, &quality, &up, &down, &taps) < 0)
+        return NULL;
+
+    mem = (resample_mem *) twolame_arena_alloc(arena, sizeof(resample_mem));
+    if (mem == NULL)
+        return NULL;
+    mem->filter = (FLOAT *) twolame_arena_alloc(arena, sizeof(FLOAT) * up * taps);
+    if (mem->filter == NULL)
+        return NULL;
+
+    /* Design a single lowpass filter of up*taps coefficients running at up times the
+       input samplerate, and split it into the phases. The coefficients of each phase
+       are stored in the order of the input samples they multiply, oldest first */
+    length = up * taps;
+    center = (length - 1) / 2.0;
+    cutoff = resample_rolloff[quality] / (2.0 * (up > down ? up : down));
+    for (p = 0; p < up; p++) {
+        FLOAT *coef = mem->filter + p * taps;
+        double sum = 0.0;
+
+        for (j = 0; j < taps; j++) {
+            double t = p + (taps - 1 - j) * up - center;
+            double w = t / (center + 1.0);
+            double h = 2.0 * cutoff;
+
+            if (t != 0.0)
+                h = sin(2.0 * PI * cutoff * t) / (PI * t);
+            h *= bessel_i0(resample_beta[quality] * sqrt(1.0 - w * w)) /
+                bessel_i0(resample_beta[quality]);
+
+            coef[j] = h;
+            sum += h;
+        }
+
+        // each phase passes DC at unity gain
+        for (j = 0; j < taps; j++)
+            coef[j] /= sum;
+    }
+
+    mem->up = up;
+    mem->down = down;
+    mem->taps = taps;
+    mem->phase = 0;
+    mem->pos = 0;
+    mem->flushed = FALSE;
+
+    // start half a filter into some silence, so the output isn't delayed
+    mem->length = taps / 2;
+
+    return mem;
+}
+
+
+/*
+    Make room at the end of the input buffer
+    Returns the number of input samples that can be added to each channel of x,
+    starting at x[ch][length]. Room for the silence of a flush is always kept back
+*/
+int twolame_resample_space(resample_mem * mem)
+{
+    int ch;
+
+    // move the samples that are still needed back to the start of the buffer
+    if (mem->pos > 0) {
+        for (ch = 0; ch < 2; ch++)
+            memmove(mem->x[ch], mem->x[ch] + mem->pos, (mem->length - mem->pos) * sizeof(FLOAT));
+        mem->length -= mem->pos;
+        mem->pos = 0;
+    }
+
+    return RESAMPLE_BUFFER - mem->taps - mem->length;
+}
+
+
+/*
+    Follow the end of the input with enough silence for the
+    filter to bring out the last samples (only once)
+*/
+void twolame_resample_flush(resample_mem * mem)
+{
+    int ch;
+
+    if (mem->flushed)
+        return;
+
+    twolame_resample_space(mem);
+    for (ch = 0; ch < 2; ch++)
+        memset(mem->x[ch] + mem->length, 0, (mem->taps / 2) * sizeof(FLOAT));
+    mem->length += mem->taps / 2;
+    mem->flushed = TRUE;
+}
+
+
+/*
+    Resample the input buffered so far into left (and right if nch is 2)
+    Returns the number of output samples, at most max_out
+*/
+int twolame_resample(resample_mem * mem, int nch, float *left, float *right, int max_out)
+{
+    float *out[2] = { left, right };
+    int taps = mem->taps;
+    int step = mem->down / mem->up;
+    int frac = mem->down % mem->up;
+    int n, ch, j;
+
+    for (n = 0; n < max_out && mem->pos + taps <= mem->length; n++) {
+        const FLOAT *coef = mem->filter + mem->phase * taps;
+
+        for (ch = 0; ch < nch; ch++) {
+            const FLOAT *x = mem->x[ch] + mem->pos;
+            FLOAT s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+
+            // taps is always a multiple of 4; separate sums let this vectorize
+            for (j = 0; j < taps; j += 4) {
+                s0 += coef[j] * x[j];
+                s1 += coef[j + 1] * x[j + 1];
+                s2 += coef[j + 2] * x[j + 2];
+                s3 += coef[j + 3] * x[j + 3];
+            }
+            out[ch][n] = (s0 + s1) + (s2 + s3);
+        }
+
+        // move on by down/up input samples
+        mem->pos += step;
+        mem->phase += frac;
+        if (mem->phase >= mem->up) {
+            mem->phase -= mem->up;
+            mem->pos++;
+        }
+    }
+
+    return n;
+}
+
+
+// vim:ts=4:sw=4:nowrap:
@@ -0,0 +1,37 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *  Copyright (C) 2023 IObundle, Lda
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef TWOLAME_RESAMPLE_H
+#define TWOLAME_RESAMPLE_H
+
+size_t twolame_resample_size(int samplerate_in, int samplerate_out, int quality);
+resample_mem *twolame_resample_init(int samplerate_in, int samplerate_out, int quality,
+                                    twolame_arena * arena);
+int twolame_resample_space(resample_mem * mem);
+void twolame_resample_flush(resample_mem * mem);
+int twolame_resample(resample_mem * mem, int nch, float *left, float *right, int max_out);
+
+#endif
+
+
+// vim:ts=4:sw=4:nowrap:
@@ -25,7 +25,8 @@
 #define TWOLAME_SUBBAND_H
 
 int twolame_init_subband(subband_mem * smem);
-void twolame_window_filter_subband(subband_mem * smem, short *pBuffer, int ch, FLOAT s[SBLIMIT]);
+void twolame_window_filter_subband(subband_mem * smem, const pcm_view * input, int first, int ch,
+                                   FLOAT s[SBLIMIT], FLOAT smax[SBLIMIT]);
 
 #endif
 
@@ -0,0 +1,3341 @@
+/*
+ * Constant tables of libtwolame
+ *
+ * Generated by gentables.c - don't edit, run 'make tables' instead.
+ */
+
+#include <stddef.h>
+
+#include "twolame.h"
+#include "common.h"
+#include "tables.h"
+
+#ifdef FLOAT_DOUBLE
+#error "tables.c was generated for float FLOATs, run 'make tables' again"
+#endif
+
+
+const FLOAT twolame_dct_matrix[16][32] = {
+    {
+        1.00000000f, 0.998795450f, 0.995184720f, 0.989176512f,
+        0.980785251f, 0.970031261f, 0.956940353f, 0.941544056f,
+        0.923879564f, 0.903989315f, 0.881921291f, 0.857728660f,
+        0.831469655f, 0.803207576f, 0.773010433f, 0.740951121f,
+        0.707106769f, 0.671558976f, 0.634393275f, 0.595699310f,
+        0.555570245f, 0.514102757f, 0.471396744f, 0.427555114f,
+        0.382683426f, 0.336889863f, 0.290284663f, 0.242980182f,
+        0.195090324f, 0.146730483f, 0.0980171412f, 0.0490676761f,
+    },
+    {
+        1.00000000f, 0.989176512f, 0.956940353f, 0.903989315f,
+        0.831469655f, 0.740951121f, 0.634393275f, 0.514102757f,
+        0.382683426f, 0.242980182f, 0.0980171412f, -0.0490676761f,
+        -0.195090324f, -0.336889863f, -0.471396744f, -0.595699310f,
+        -0.707106769f, -0.803207576f, -0.881921291f, -0.941544056f,
+        -0.980785251f, -0.998795450f, -0.995184720f, -0.970031261f,
+        -0.923879564f, -0.857728660f, -0.773010433f, -0.671558976f,
+        -0.555570245f, -0.427555114f, -0.290284663f, -0.146730483f,
+    },
+    {
+        1.00000000f, 0.970031261f, 0.881921291f, 0.740951121f,
+        0.555570245f, 0.336889863f, 0.0980171412f, -0.146730483f,
+        -0.382683426f, -0.595699310f, -0.773010433f, -0.903989315f,
+        -0.980785251f, -0.998795450f, -0.956940353f, -0.857728660f,
+        -0.707106769f, -0.514102757f, -0.290284663f, -0.0490676761f,
+        0.195090324f, 0.427555114f, 0.634393275f, 0.803207576f,
+        0.923879564f, 0.989176512f, 0.995184720f, 0.941544056f,
+        0.831469655f, 0.671558976f, 0.471396744f, 0.242980182f,
+    },
+    {
+        1.00000000f, 0.941544056f, 0.773010433f, 0.514102757f,
+        0.195090324f, -0.146730483f, -0.471396744f, -0.740951121f,
+        -0.923879564f, -0.998795450f, -0.956940353f, -0.803207576f,
+        -0.555570245f, -0.242980182f, 0.0980171412f, 0.427555114f,
+        0.707106769f, 0.903989315f, 0.995184720f, 0.970031261f,
+        0.831469655f, 0.595699310f, 0.290284663f, -0.0490676761f,
+        -0.382683426f, -0.671558976f, -0.881921291f, -0.989176512f,
+        -0.980785251f, -0.857728660f, -0.634393275f, -0.336889863f,
+    },
+    {
+        1.00000000f, 0.903989315f, 0.634393275f, 0.242980182f,
+        -0.195090324f, -0.595699310f, -0.881921291f, -0.998795450f,
+        -0.923879564f, -0.671558976f, -0.290284663f, 0.146730483f,
+        0.555570245f, 0.857728660f, 0.995184720f, 0.941544056f,
+        0.707106769f, 0.336889863f, -0.0980171412f, -0.514102757f,
+        -0.831469655f, -0.989176512f, -0.956940353f, -0.740951121f,
+        -0.382683426f, 0.0490676761f, 0.471396744f, 0.803207576f,
+        0.980785251f, 0.970031261f, 0.773010433f, 0.427555114f,
+    },
+    {
+        1.00000000f, 0.857728660f, 0.471396744f, -0.0490676761f,
+        -0.555570245f, -0.903989315f, -0.995184720f, -0.803207576f,
+        -0.382683426f, 0.146730483f, 0.634393275f, 0.941544056f,
+        0.980785251f, 0.740951121f, 0.290284663f, -0.242980182f,
+        -0.707106769f, -0.970031261f, -0.956940353f, -0.671558976f,
+        -0.195090324f, 0.336889863f, 0.773010433f, 0.989176512f,
+        0.923879564f, 0.595699310f, 0.0980171412f, -0.427555114f,
+        -0.831469655f, -0.998795450f, -0.881921291f, -0.514102757f,
+    },
+    {
+        1.00000000f, 0.803207576f, 0.290284663f, -0.336889863f,
+        -0.831469655f, -0.998795450f, -0.773010433f, -0.242980182f,
+        0.382683426f, 0.857728660f, 0.995184720f, 0.740951121f,
+        0.195090324f, -0.427555114f, -0.881921291f, -0.989176512f,
+        -0.707106769f, -0.146730483f, 0.471396744f, 0.903989315f,
+        0.980785251f, 0.671558976f, 0.0980171412f, -0.514102757f,
+        -0.923879564f, -0.970031261f, -0.634393275f, -0.0490676761f,
+        0.555570245f, 0.941544056f, 0.956940353f, 0.595699310f,
+    },
+    {
+        1.00000000f, 0.740951121f, 0.0980171412f, -0.595699310f,
+        -0.980785251f, -0.857728660f, -0.290284663f, 0.427555114f,
+        0.923879564f, 0.941544056f, 0.471396744f, -0.242980182f,
+        -0.831469655f, -0.989176512f, -0.634393275f, 0.0490676761f,
+        0.707106769f, 0.998795450f, 0.773010433f, 0.146730483f,
+        -0.555570245f, -0.970031261f, -0.881921291f, -0.336889863f,
+        0.382683426f, 0.903989315f, 0.956940353f, 0.514102757f,
+        -0.195090324f, -0.803207576f, -0.995184720f, -0.671558976f,
+    },
+    {
+        1.00000000f, 0.671558976f, -0.0980171412f, -0.803207576f,
+        -0.980785251f, -0.514102757f, 0.290284663f, 0.903989315f,
+        0.923879564f, 0.336889863f, -0.471396744f, -0.970031261f,
+        -0.831469655f, -0.146730483f, 0.634393275f, 0.998795450f,
+        0.707106769f, -0.0490676761f, -0.773010433f, -0.989176512f,
+        -0.555570245f, 0.242980182f, 0.881921291f, 0.941544056f,
+        0.382683426f, -0.427555114f, -0.956940353f, -0.857728660f,
+        -0.195090324f, 0.595699310f, 0.995184720f, 0.740951121f,
+    },
+    {
+        1.00000000f, 0.595699310f, -0.290284663f, -0.941544056f,
+        -0.831469655f, -0.0490676761f, 0.773010433f, 0.970031261f,
+        0.382683426f, -0.514102757f, -0.995184720f, -0.671558976f,
+        0.195090324f, 0.903989315f, 0.881921291f, 0.146730483f,
+        -0.707106769f, -0.989176512f, -0.471396744f, 0.427555114f,
+        0.980785251f, 0.740951121f, -0.0980171412f, -0.857728660f,
+        -0.923879564f, -0.242980182f, 0.634393275f, 0.998795450f,
+        0.555570245f, -0.336889863f, -0.956940353f, -0.803207576f,
+    },
+    {
+        1.00000000f, 0.514102757f, -0.471396744f, -0.998795450f,
+        -0.555570245f, 0.427555114f, 0.995184720f, 0.595699310f,
+        -0.382683426f, -0.989176512f, -0.634393275f, 0.336889863f,
+        0.980785251f, 0.671558976f, -0.290284663f, -0.970031261f,
+        -0.707106769f, 0.242980182f, 0.956940353f, 0.740951121f,
+        -0.195090324f, -0.941544056f, -0.773010433f, 0.146730483f,
+        0.923879564f, 0.803207576f, -0.0980171412f, -0.903989315f,
+        -0.831469655f, 0.0490676761f, 0.881921291f, 0.857728660f,
+    },
+    {
+        1.00000000f, 0.427555114f, -0.634393275f, -0.970031261f,
+        -0.195090324f, 0.803207576f, 0.881921291f, -0.0490676761f,
+        -0.923879564f, -0.740951121f, 0.290284663f, 0.989176512f,
+        0.555570245f, -0.514102757f, -0.995184720f, -0.336889863f,
+        0.707106769f, 0.941544056f, 0.0980171412f, -0.857728660f,
+        -0.831469655f, 0.146730483f, 0.956940353f, 0.671558976f,
+        -0.382683426f, -0.998795450f, -0.471396744f, 0.595699310f,
+        0.980785251f, 0.242980182f, -0.773010433f, -0.903989315f,
+    },
+    {
+        1.00000000f, 0.336889863f, -0.773010433f, -0.857728660f,
+        0.195090324f, 0.989176512f, 0.471396744f, -0.671558976f,
+        -0.923879564f, 0.0490676761f, 0.956940353f, 0.595699310f,
+        -0.555570245f, -0.970031261f, -0.0980171412f, 0.903989315f,
+        0.707106769f, -0.427555114f, -0.995184720f, -0.242980182f,
+        0.831469655f, 0.803207576f, -0.290284663f, -0.998795450f,
+        -0.382683426f, 0.740951121f, 0.881921291f, -0.146730483f,
+        -0.980785251f, -0.514102757f, 0.634393275f, 0.941544056f,
+    },
+    {
+        1.00000000f, 0.242980182f, -0.881921291f, -0.671558976f,
+        0.555570245f, 0.941544056f, -0.0980171412f, -0.989176512f,
+        -0.382683426f, 0.803207576f, 0.773010433f, -0.427555114f,
+        -0.980785251f, -0.0490676761f, 0.956940353f, 0.514102757f,
+        -0.707106769f, -0.857728660f, 0.290284663f, 0.998795450f,
+        0.195090324f, -0.903989315f, -0.634393275f, 0.595699310f,
+        0.923879564f, -0.146730483f, -0.995184720f, -0.336889863f,
+        0.831469655f, 0.740951121f, -0.471396744f, -0.970031261f,
+    },
+    {
+        1.00000000f, 0.146730483f, -0.956940353f, -0.427555114f,
+        0.831469655f, 0.671558976f, -0.634393275f, -0.857728660f,
+        0.382683426f, 0.970031261f, -0.0980171412f, -0.998795450f,
+        -0.195090324f, 0.941544056f, 0.471396744f, -0.803207576f,
+        -0.707106769f, 0.595699310f, 0.881921291f, -0.336889863f,
+        -0.980785251f, 0.0490676761f, 0.995184720f, 0.242980182f,
+        -0.923879564f, -0.514102757f, 0.773010433f, 0.740951121f,
+        -0.555570245f, -0.903989315f, 0.290284663f, 0.989176512f,
+    },
+    {
+        1.00000000f, 0.0490676761f, -0.995184720f, -0.146730483f,
+        0.980785251f, 0.242980182f, -0.956940353f, -0.336889863f,
+        0.923879564f, 0.427555114f, -0.881921291f, -0.514102757f,
+        0.831469655f, 0.595699310f, -0.773010433f, -0.671558976f,
+        0.707106769f, 0.740951121f, -0.634393275f, -0.803207576f,
+        0.555570245f, 0.857728660f, -0.471396744f, -0.903989315f,
+        0.382683426f, 0.941544056f, -0.290284663f, -0.970031261f,
+        0.195090324f, 0.989176512f, -0.0980171412f, -0.998795450f,
+    },
+};
+
+const FLOAT twolame_psycho_1_dbtable[DBTAB] = {
+    3.01029992f, 2.96058774f, 2.91145110f, 2.86288977f,
+    2.81490350f, 2.76749158f, 2.72065330f, 2.67438817f,
+    2.62869453f, 2.58357215f, 2.53901887f, 2.49503374f,
+    2.45161533f, 2.40876150f, 2.36647081f, 2.32474089f,
+    2.28356981f, 2.24295521f, 2.20289469f, 2.16338587f,
+    2.12442613f, 2.08601236f, 2.04814196f, 2.01081157f,
+    1.97401845f, 1.93775916f, 1.90203035f, 1.86682844f,
+    1.83215010f, 1.79799139f, 1.76434863f, 1.73121798f,
+    1.69859540f, 1.66647696f, 1.63485837f, 1.60373557f,
+    1.57310414f, 1.54295981f, 1.51329815f, 1.48411453f,
+    1.45540464f, 1.42716360f, 1.39938688f, 1.37206960f,
+    1.34520721f, 1.31879485f, 1.29282749f, 1.26730037f,
+    1.24220836f, 1.21754670f, 1.19331050f, 1.16949451f,
+    1.14609373f, 1.12310314f, 1.10051775f, 1.07833242f,
+    1.05654204f, 1.03514147f, 1.01412559f, 0.993489504f,
+    0.973227918f, 0.953335822f, 0.933808088f, 0.914639592f,
+    0.895825386f, 0.877360404f, 0.859239519f, 0.841457784f,
+    0.824010134f, 0.806891680f, 0.790097475f, 0.773622572f,
+    0.757462084f, 0.741611063f, 0.726064861f, 0.710818529f,
+    0.695867360f, 0.681206644f, 0.666831613f, 0.652737737f,
+    0.638920367f, 0.625374794f, 0.612096786f, 0.599081516f,
+    0.586324871f, 0.573822200f, 0.561569214f, 0.549561799f,
+    0.537795365f, 0.526266038f, 0.514969409f, 0.503901482f,
+    0.493058234f, 0.482435495f, 0.472029477f, 0.461836100f,
+    0.451851606f, 0.442072242f, 0.432494044f, 0.423113555f,
+    0.413926840f, 0.404930472f, 0.396120906f, 0.387494475f,
+    0.379047930f, 0.370777637f, 0.362680376f, 0.354752898f,
+    0.346991777f, 0.339393973f, 0.331956208f, 0.324675381f,
+    0.317548573f, 0.310572594f, 0.303744614f, 0.297061622f,
+    0.290520817f, 0.284119427f, 0.277854532f, 0.271723598f,
+    0.265723765f, 0.259852469f, 0.254107237f, 0.248485357f,
+    0.242984444f, 0.237601981f, 0.232335567f, 0.227182910f,
+    0.222141594f, 0.217209399f, 0.212384015f, 0.207663298f,
+    0.203045100f, 0.198527247f, 0.194107726f, 0.189784408f,
+    0.185555354f, 0.181418613f, 0.177372172f, 0.173414245f,
+    0.169542894f, 0.165756315f, 0.162052780f, 0.158430457f,
+    0.154887706f, 0.151422769f, 0.148034021f, 0.144719899f,
+    0.141478732f, 0.138309032f, 0.135209218f, 0.132177830f,
+    0.129213423f, 0.126314521f, 0.123479746f, 0.120707691f,
+    0.117997028f, 0.115346454f, 0.112754628f, 0.110220321f,
+    0.107742257f, 0.105319232f, 0.102950051f, 0.100633599f,
+    0.0983686298f, 0.0961540863f, 0.0939888507f, 0.0918718651f,
+    0.0898021087f, 0.0877784789f, 0.0857999921f, 0.0838656723f,
+    0.0819745511f, 0.0801257193f, 0.0783181712f, 0.0765510499f,
+    0.0748234466f, 0.0731345117f, 0.0714834183f, 0.0698692724f,
+    0.0682912841f, 0.0667486638f, 0.0652406290f, 0.0637664422f,
+    0.0623252988f, 0.0609164983f, 0.0595393255f, 0.0581930801f,
+    0.0568770990f, 0.0555906631f, 0.0543331429f, 0.0531038940f,
+    0.0519022904f, 0.0507277437f, 0.0495795980f, 0.0484572984f,
+    0.0473602638f, 0.0462879315f, 0.0452397764f, 0.0442152135f,
+    0.0432137363f, 0.0422348380f, 0.0412780046f, 0.0403427668f,
+    0.0394286066f, 0.0385350697f, 0.0376616903f, 0.0368080251f,
+    0.0359736457f, 0.0351580903f, 0.0343609490f, 0.0335818082f,
+    0.0328202732f, 0.0320759565f, 0.0313484445f, 0.0306373741f,
+    0.0299423784f, 0.0292630959f, 0.0285991840f, 0.0279502757f,
+    0.0273160432f, 0.0266961586f, 0.0260902997f, 0.0254981611f,
+    0.0249194112f, 0.0243537612f, 0.0238009170f, 0.0232605878f,
+    0.0227325037f, 0.0222163685f, 0.0217119213f, 0.0212189015f,
+    0.0207370501f, 0.0202661231f, 0.0198058598f, 0.0193560235f,
+    0.0189163834f, 0.0184867084f, 0.0180667788f, 0.0176563617f,
+    0.0172552504f, 0.0168632325f, 0.0164801050f, 0.0161056723f,
+    0.0157397240f, 0.0153820766f, 0.0150325419f, 0.0146909365f,
+    0.0143570872f, 0.0140308058f, 0.0137119284f, 0.0134002864f,
+    0.0130957169f, 0.0127980653f, 0.0125071639f, 0.0122228656f,
+    0.0119450204f, 0.0116734821f, 0.0114081139f, 0.0111487657f,
+    0.0108953062f, 0.0106476014f, 0.0104055218f, 0.0101689436f,
+    0.00993773434f, 0.00971177500f, 0.00949094910f, 0.00927513838f,
+    0.00906423386f, 0.00885811634f, 0.00865668058f, 0.00845982134f,
+    0.00826743525f, 0.00807942357f, 0.00789567921f, 0.00771611091f,
+    0.00754062226f, 0.00736912154f, 0.00720152166f, 0.00703772716f,
+    0.00687765516f, 0.00672122091f, 0.00656834245f, 0.00641894108f,
+    0.00627293345f, 0.00613024412f, 0.00599079812f, 0.00585452234f,
+    0.00572134694f, 0.00559119647f, 0.00546400482f, 0.00533970492f,
+    0.00521823112f, 0.00509952102f, 0.00498350803f, 0.00487013254f,
+    0.00475933496f, 0.00465105707f, 0.00454524299f, 0.00444183312f,
+    0.00434077485f, 0.00424201461f, 0.00414550025f, 0.00405118242f,
+    0.00395900803f, 0.00386892981f, 0.00378090027f, 0.00369487260f,
+    0.00361080328f, 0.00352864456f, 0.00344835431f, 0.00336989039f,
+    0.00329321111f, 0.00321827736f, 0.00314504653f, 0.00307348161f,
+    0.00300354464f, 0.00293519837f, 0.00286840834f, 0.00280313613f,
+    0.00273934891f, 0.00267701386f, 0.00261609443f, 0.00255656336f,
+    0.00249838433f, 0.00244153081f, 0.00238597090f, 0.00233167293f,
+    0.00227861246f, 0.00222675689f, 0.00217608316f, 0.00212656241f,
+    0.00207816646f, 0.00203087344f, 0.00198465446f, 0.00193948904f,
+    0.00189535122f, 0.00185221597f, 0.00181006384f, 0.00176886912f,
+    0.00172861340f, 0.00168927363f, 0.00165082747f, 0.00161325757f,
+    0.00157654122f, 0.00154066167f, 0.00150559854f, 0.00147133193f,
+    0.00143784634f, 0.00140512153f, 0.00137314259f, 0.00134189136f,
+    0.00131135015f, 0.00128150498f, 0.00125233794f, 0.00122383574f,
+    0.00119598210f, 0.00116876117f, 0.00114216085f, 0.00111616484f,
+    0.00109076139f, 0.00106593606f, 0.00104167475f, 0.00101796654f,
+    0.000994796865f, 0.000972155423f, 0.000950029236f, 0.000928405731f,
+    0.000907275185f, 0.000886624679f, 0.000866444956f, 0.000846724492f,
+    0.000827452110f, 0.000808619021f, 0.000790213875f, 0.000772228290f,
+    0.000754652021f, 0.000737475115f, 0.000720689772f, 0.000704285805f,
+    0.000688255823f, 0.000672590686f, 0.000657281431f, 0.000642321247f,
+    0.000627700938f, 0.000613413926f, 0.000599452120f, 0.000585807546f,
+    0.000572473975f, 0.000559443433f, 0.000546709925f, 0.000534266233f,
+    0.000522105314f, 0.000510221638f, 0.000498607988f, 0.000487259094f,
+    0.000476168498f, 0.000465329911f, 0.000454738416f, 0.000444387610f,
+    0.000434272777f, 0.000424388156f, 0.000414728129f, 0.000405288360f,
+    0.000396063086f, 0.000387048116f, 0.000378238328f, 0.000369628746f,
+    0.000361215469f, 0.000352993346f, 0.000344958680f, 0.000337106874f,
+    0.000329433504f, 0.000321935076f, 0.000314607023f, 0.000307446055f,
+    0.000300448097f, 0.000293609133f, 0.000286926079f, 0.000280394917f,
+    0.000274012651f, 0.000267775642f, 0.000261680369f, 0.000255724066f,
+    0.000249903125f, 0.000244214869f, 0.000238656095f, 0.000233223647f,
+    0.000227915050f, 0.000222727074f, 0.000217657391f, 0.000212703104f,
+    0.000207861391f, 0.000203130083f, 0.000198506270f, 0.000193987886f,
+    0.000189572340f, 0.000185257144f, 0.000181040334f, 0.000176919348f,
+    0.000172892309f, 0.000168956933f, 0.000165110992f, 0.000161352727f,
+    0.000157679882f, 0.000154090769f, 0.000150583350f, 0.000147155632f,
+    0.000143806057f, 0.000140532618f, 0.000137333802f, 0.000134207803f,
+    0.000131152832f, 0.000128167521f, 0.000125250051f, 0.000122399084f,
+    0.000119613025f, 0.000116890275f, 0.000114229602f, 0.000111629393f,
+    0.000109088469f, 0.000106605381f, 0.000104178725f, 0.000101807389f,
+    9.94899456e-05f, 9.72253329e-05f, 9.50122776e-05f, 9.28495065e-05f,
+    9.07360445e-05f, 8.86706184e-05f, 8.66522751e-05f, 8.46798794e-05f,
+    8.27523036e-05f, 8.08686746e-05f, 7.90278573e-05f, 7.72290077e-05f,
+    7.54711000e-05f, 7.37531445e-05f, 7.20743556e-05f, 7.04337217e-05f,
+    6.88304935e-05f, 6.72637543e-05f, 6.57326236e-05f, 6.42363957e-05f,
+    6.27741756e-05f, 6.13452939e-05f, 5.99489358e-05f, 5.85843081e-05f,
+    5.72507961e-05f, 5.59475884e-05f, 5.46740921e-05f, 5.34295832e-05f,
+    5.22133596e-05f, 5.10248610e-05f, 4.98633744e-05f, 4.87283687e-05f,
+    4.76191999e-05f, 4.65352350e-05f, 4.54759866e-05f, 4.44408070e-05f,
+    4.34292306e-05f, 4.24406826e-05f, 4.14745955e-05f, 4.05305364e-05f,
+    3.96079340e-05f, 3.87063628e-05f, 3.78253171e-05f, 3.69642912e-05f,
+    3.61228995e-05f, 3.53006253e-05f, 3.44971013e-05f, 3.37118654e-05f,
+    3.29444738e-05f, 3.21945809e-05f, 3.14617282e-05f, 3.07455848e-05f,
+    3.00457432e-05f, 2.93618068e-05f, 2.86934628e-05f, 2.80403074e-05f,
+    2.74020422e-05f, 2.67783071e-05f, 2.61687474e-05f, 2.55730847e-05f,
+    2.49909590e-05f, 2.44221046e-05f, 2.38661996e-05f, 2.33229275e-05f,
+    2.27920427e-05f, 2.22732215e-05f, 2.17662309e-05f, 2.12707801e-05f,
+    2.07865869e-05f, 2.03134350e-05f, 1.98510352e-05f, 1.93991782e-05f,
+    1.89576076e-05f, 1.85260706e-05f, 1.81043724e-05f, 1.76922586e-05f,
+    1.72895398e-05f, 1.68959887e-05f, 1.65113815e-05f, 1.61355420e-05f,
+    1.57682462e-05f, 1.54093232e-05f, 1.50585693e-05f, 1.47157871e-05f,
+    1.43808202e-05f, 1.40534667e-05f, 1.37335755e-05f, 1.34209668e-05f,
+    1.31154611e-05f, 1.28169222e-05f, 1.25251672e-05f, 1.22400643e-05f,
+    1.19614506e-05f, 1.16891697e-05f, 1.14230961e-05f, 1.11630688e-05f,
+    1.09089706e-05f, 1.06606558e-05f, 1.04179844e-05f, 1.01808464e-05f,
+    9.94909715e-06f, 9.72263115e-06f, 9.50132107e-06f, 9.28503960e-06f,
+    9.07369031e-06f, 8.86714315e-06f, 8.66530536e-06f, 8.46806233e-06f,
+    8.27530130e-06f, 8.08693585e-06f, 7.90285048e-06f, 7.72296244e-06f,
+    7.54716939e-06f, 7.37537084e-06f, 7.20748949e-06f, 7.04342347e-06f,
+    6.88309819e-06f, 6.72642227e-06f, 6.57330702e-06f, 6.42368241e-06f,
+    6.27745840e-06f, 6.13456814e-06f, 5.99493069e-06f, 5.85846647e-06f,
+    5.72511362e-06f, 5.59479122e-06f, 5.46744013e-06f, 5.34298806e-06f,
+    5.22136406e-06f, 5.10251311e-06f, 4.98636336e-06f, 4.87286161e-06f,
+    4.76194327e-06f, 4.65354606e-06f, 4.54761994e-06f, 4.44410125e-06f,
+    4.34294270e-06f, 4.24408654e-06f, 4.14747728e-06f, 4.05307082e-06f,
+    3.96080941e-06f, 3.87065211e-06f, 3.78254640e-06f, 3.69644340e-06f,
+    3.61230332e-06f, 3.53007545e-06f, 3.44972227e-06f, 3.37119832e-06f,
+    3.29445879e-06f, 3.21946891e-06f, 3.14618319e-06f, 3.07456844e-06f,
+    3.00458373e-06f, 2.93618950e-06f, 2.86935483e-06f, 2.80403879e-06f,
+    2.74021204e-06f, 2.67783821e-06f, 2.61688183e-06f, 2.55731516e-06f,
+    2.49910227e-06f, 2.44221656e-06f, 2.38662597e-06f, 2.33229844e-06f,
+    2.27920964e-06f, 2.22732729e-06f, 2.17662796e-06f, 2.12708255e-06f,
+    2.07866333e-06f, 2.03134778e-06f, 1.98510770e-06f, 1.93992173e-06f,
+    1.89576440e-06f, 1.85261058e-06f, 1.81044061e-06f, 1.76922913e-06f,
+    1.72895716e-06f, 1.68960185e-06f, 1.65114238e-06f, 1.61355558e-06f,
+    1.57682712e-06f, 1.54093470e-06f, 1.50585925e-06f, 1.47158221e-06f,
+    1.43808290e-06f, 1.40534871e-06f, 1.37335951e-06f, 1.34209847e-06f,
+    1.31154911e-06f, 1.28169279e-06f, 1.25251836e-06f, 1.22400797e-06f,
+    1.19614663e-06f, 1.16891943e-06f, 1.14230988e-06f, 1.11630811e-06f,
+    1.09089831e-06f, 1.06606683e-06f, 1.04180049e-06f, 1.01808484e-06f,
+    9.94910692e-07f, 9.72264161e-07f, 9.50133028e-07f, 9.28505699e-07f,
+    9.07369042e-07f, 8.86715100e-07f, 8.66531309e-07f, 8.46806984e-07f,
+    8.27531608e-07f, 8.08693528e-07f, 7.90285696e-07f, 7.72296858e-07f,
+    7.54717519e-07f, 7.37538301e-07f, 7.20748858e-07f, 7.04342881e-07f,
+    6.88310308e-07f, 6.72642727e-07f, 6.57331725e-07f, 6.42368150e-07f,
+    6.27746260e-07f, 6.13457246e-07f, 5.99493433e-07f, 5.85847488e-07f,
+    5.72511169e-07f, 5.59479417e-07f, 5.46744332e-07f, 5.34299090e-07f,
+    5.22137157e-07f, 5.10251141e-07f, 4.98636609e-07f, 4.87286400e-07f,
+    4.76194572e-07f, 4.65355242e-07f, 4.54761789e-07f, 4.44410318e-07f,
+    4.34294464e-07f, 4.24408853e-07f, 4.14748285e-07f, 4.05306878e-07f,
+    3.96081134e-07f, 3.87065342e-07f, 3.78254811e-07f, 3.69644795e-07f,
+    3.61230150e-07f, 3.53007664e-07f, 3.44972364e-07f, 3.37119957e-07f,
+    3.29446266e-07f, 3.21946715e-07f, 3.14618433e-07f, 3.07456958e-07f,
+    3.00458453e-07f, 2.93619280e-07f, 2.86935318e-07f, 2.80403953e-07f,
+    2.74021289e-07f, 2.67783889e-07f, 2.61688484e-07f, 2.55731379e-07f,
+    2.49910300e-07f, 2.44221724e-07f, 2.38662636e-07f, 2.33230111e-07f,
+    2.27920822e-07f, 2.22732780e-07f, 2.17662844e-07f, 2.12708301e-07f,
+    2.07866549e-07f, 2.03134647e-07f, 1.98510804e-07f, 1.93992207e-07f,
+    1.89576483e-07f, 1.85261257e-07f, 1.81043944e-07f, 1.76922939e-07f,
+    1.72895739e-07f, 1.68960213e-07f, 1.65114272e-07f, 1.61355587e-07f,
+    1.57682734e-07f, 1.54093499e-07f, 1.50585947e-07f, 1.47158261e-07f,
+    1.43808307e-07f, 1.40534894e-07f, 1.37335974e-07f, 1.34209870e-07f,
+    1.31154934e-07f, 1.28169290e-07f, 1.25251859e-07f, 1.22400806e-07f,
+    1.19614683e-07f, 1.16891954e-07f, 1.14231014e-07f, 1.11630825e-07f,
+    1.09089839e-07f, 1.06606691e-07f, 1.04180060e-07f, 1.01808496e-07f,
+    9.94910749e-08f, 9.72264331e-08f, 9.50133199e-08f, 9.28505699e-08f,
+    9.07369042e-08f, 8.86715270e-08f, 8.66531451e-08f, 8.46807069e-08f,
+    8.27531608e-08f, 8.08693557e-08f, 7.90285810e-08f, 7.72296858e-08f,
+    7.54717462e-08f, 7.37538386e-08f, 7.20748830e-08f, 7.04342966e-08f,
+    6.88310422e-08f, 6.72642813e-08f, 6.57331753e-08f, 6.42368150e-08f,
+    6.27746317e-08f, 6.13457303e-08f, 5.99493575e-08f, 5.85847602e-08f,
+    5.72511283e-08f, 5.59479503e-08f, 5.46744445e-08f, 5.34299147e-08f,
+    5.22137213e-08f, 5.10251112e-08f, 4.98636581e-08f, 4.87286371e-08f,
+    4.76194657e-08f, 4.65355185e-08f, 4.54761846e-08f, 4.44410375e-08f,
+    4.34294520e-08f, 4.24408881e-08f, 4.14748200e-08f, 4.05306935e-08f,
+    3.96081106e-08f, 3.87065313e-08f, 3.78254867e-08f, 3.69644795e-08f,
+    3.61230263e-08f, 3.53007721e-08f, 3.44972335e-08f, 3.37119985e-08f,
+    3.29446408e-08f, 3.21946629e-08f, 3.14618376e-08f, 3.07456958e-08f,
+    3.00458538e-08f, 2.93619280e-08f, 2.86935347e-08f, 2.80403896e-08f,
+    2.74021232e-08f, 2.67783946e-08f, 2.61688484e-08f, 2.55731436e-08f,
+    2.49910386e-08f, 2.44221781e-08f, 2.38662494e-08f, 2.33230111e-08f,
+    2.27920793e-08f, 2.22732695e-08f, 2.17662972e-08f, 2.12708358e-08f,
+    2.07866577e-08f, 2.03134647e-08f, 1.98510719e-08f, 1.93992094e-08f,
+    1.89576497e-08f, 1.85261229e-08f, 1.81043873e-08f, 1.76923152e-08f,
+    1.72895795e-08f, 1.68960099e-08f, 1.65114216e-08f, 1.61355587e-08f,
+    1.57682791e-08f, 1.54093414e-08f, 1.50586175e-08f, 1.47158232e-08f,
+    1.43808450e-08f, 1.40534837e-08f, 1.37335974e-08f, 1.34209728e-08f,
+    1.31154962e-08f, 1.28169262e-08f, 1.25251773e-08f, 1.22400792e-08f,
+    1.19614754e-08f, 1.16891954e-08f, 1.14230971e-08f, 1.11630811e-08f,
+    1.09089768e-08f, 1.06606564e-08f, 1.04180202e-08f, 1.01808411e-08f,
+    9.94911886e-09f, 9.72264047e-09f, 9.50132062e-09f, 9.28504562e-09f,
+    9.07368758e-09f, 8.86714702e-09f, 8.66531025e-09f, 8.46807779e-09f,
+    8.27532176e-09f, 8.08694267e-09f, 7.90285526e-09f, 7.72297426e-09f,
+    7.54717178e-09f, 7.37537675e-09f, 7.20748972e-09f, 7.04342540e-09f,
+    6.88311275e-09f, 6.72642386e-09f, 6.57331611e-09f, 6.42367581e-09f,
+    6.27747454e-09f, 6.13457019e-09f, 5.99493433e-09f, 5.85848170e-09f,
+    5.72509862e-09f, 5.59479929e-09f, 5.46745582e-09f, 5.34299716e-09f,
+    5.22136645e-09f, 5.10252107e-09f, 4.98636155e-09f, 4.87285945e-09f,
+    4.76195794e-09f, 4.65355754e-09f, 4.54761562e-09f, 4.44410375e-09f,
+    4.34295089e-09f, 4.24408597e-09f, 4.14748058e-09f, 4.05304945e-09f,
+    3.96080679e-09f, 3.87065313e-09f, 3.78256004e-09f, 3.69645647e-09f,
+    3.61231400e-09f, 3.53009000e-09f, 3.44971340e-09f, 3.37119843e-09f,
+    3.29447403e-09f, 3.21946914e-09f, 3.14618376e-09f, 3.07457526e-09f,
+    3.00458680e-09f, 2.93618996e-09f, 2.86934210e-09f, 2.80402901e-09f,
+    2.74019385e-09f, 2.67785083e-09f, 2.61690047e-09f, 2.55732857e-09f,
+    2.49910670e-09f, 2.44222065e-09f, 2.38662778e-09f, 2.33229969e-09f,
+    2.27920793e-09f, 2.22730989e-09f, 2.17663398e-09f, 2.12708073e-09f,
+    2.07865014e-09f, 2.03135642e-09f, 1.98511430e-09f, 1.93992378e-09f,
+    1.89575644e-09f, 1.85262650e-09f, 1.81043447e-09f, 1.76923720e-09f,
+    1.72896364e-09f, 1.68959957e-09f, 1.65113079e-09f, 1.61355729e-09f,
+    1.57680802e-09f, 1.54092561e-09f, 1.50586743e-09f, 1.47159085e-09f,
+    1.43809586e-09f, 1.40535406e-09f, 1.37335121e-09f, 1.34208733e-09f,
+    1.31154820e-09f, 1.28169120e-09f, 1.25251631e-09f, 1.22402355e-09f,
+    1.19615606e-09f, 1.16891385e-09f, 1.14231113e-09f, 1.11631948e-09f,
+    1.09089626e-09f, 1.06605569e-09f, 1.04179776e-09f, 1.01807984e-09f,
+    9.94930360e-10f, 9.72278258e-10f, 9.50137746e-10f, 9.28494615e-10f,
+    9.07363074e-10f, 8.86714702e-10f, 8.66521077e-10f, 8.46810622e-10f,
+    8.27540703e-10f, 8.08697109e-10f, 7.90294052e-10f, 7.72288899e-10f,
+    7.54710072e-10f, 7.37543360e-10f, 7.20746129e-10f, 7.04332592e-10f,
+    6.88316959e-10f, 6.72642386e-10f, 6.57323085e-10f, 6.42373266e-10f,
+    6.27750296e-10f, 6.13454176e-10f, 5.99470695e-10f, 5.85856696e-10f,
+    5.72512704e-10f, 5.59481350e-10f, 5.46748424e-10f, 5.34299716e-10f,
+    5.22135224e-10f, 5.10254949e-10f, 4.98630470e-10f, 4.87290208e-10f,
+    4.76191531e-10f, 4.65348649e-10f, 4.54775773e-10f, 4.44416060e-10f,
+};
+
+const FLOAT twolame_psycho_1_window[FFT_SIZE] = {
+    0.00000000f, 1.50100767e-08f, 6.00397385e-08f, 1.35087291e-07f,
+    2.40149916e-07f, 3.75223635e-07f, 5.40303404e-07f, 7.35382969e-07f,
+    9.60455054e-07f, 1.21551102e-06f, 1.50054143e-06f, 1.81553548e-06f,
+    2.16048147e-06f, 2.53536609e-06f, 2.94017536e-06f, 3.37489428e-06f,
+    3.83950601e-06f, 4.33399373e-06f, 4.85833834e-06f, 5.41251984e-06f,
+    5.99651821e-06f, 6.61031072e-06f, 7.25387417e-06f, 7.92718492e-06f,
+    8.63021796e-06f, 9.36294509e-06f, 1.01253409e-05f, 1.09173752e-05f,
+    1.17390182e-05f, 1.25902407e-05f, 1.34710081e-05f, 1.43812886e-05f,
+    1.53210476e-05f, 1.62902506e-05f, 1.72888613e-05f, 1.83168395e-05f,
+    1.93741489e-05f, 2.04607495e-05f, 2.15765995e-05f, 2.27216569e-05f,
+    2.38958783e-05f, 2.50992216e-05f, 2.63316397e-05f, 2.75930870e-05f,
+    2.88835145e-05f, 3.02028766e-05f, 3.15511206e-05f, 3.29281975e-05f,
+    3.43340544e-05f, 3.57686367e-05f, 3.72318937e-05f, 3.87237706e-05f,
+    4.02442092e-05f, 4.17931515e-05f, 4.33705427e-05f, 4.49763174e-05f,
+    4.66104211e-05f, 4.82727919e-05f, 4.99633643e-05f, 5.16820764e-05f,
+    5.34288592e-05f, 5.52036545e-05f, 5.70063894e-05f, 5.88369985e-05f,
+    6.06954127e-05f, 6.25815665e-05f, 6.44953761e-05f, 6.64367835e-05f,
+    6.84057086e-05f, 7.04020786e-05f, 7.24258134e-05f, 7.44768477e-05f,
+    7.65550940e-05f, 7.86604796e-05f, 8.07929246e-05f, 8.29523487e-05f,
+    8.51386649e-05f, 8.73518002e-05f, 8.95916673e-05f, 9.18581791e-05f,
+    9.41512553e-05f, 9.64708088e-05f, 9.88167449e-05f, 0.000101188984f,
+    0.000103587430f, 0.000106012005f, 0.000108462598f, 0.000110939131f,
+    0.000113441514f, 0.000115969640f, 0.000118523421f, 0.000121102756f,
+    0.000123707563f, 0.000126337720f, 0.000128993139f, 0.000131673733f,
+    0.000134379385f, 0.000137109993f, 0.000139865471f, 0.000142645687f,
+    0.000145450569f, 0.000148279985f, 0.000151133849f, 0.000154012028f,
+    0.000156914437f, 0.000159840958f, 0.000162791475f, 0.000165765887f,
+    0.000168764091f, 0.000171785941f, 0.000174831352f, 0.000177900205f,
+    0.000180992385f, 0.000184107761f, 0.000187246216f, 0.000190407663f,
+    0.000193591943f, 0.000196798966f, 0.000200028604f, 0.000203280710f,
+    0.000206555196f, 0.000209851933f, 0.000213170788f, 0.000216511631f,
+    0.000219874331f, 0.000223258787f, 0.000226664866f, 0.000230092410f,
+    0.000233541330f, 0.000237011467f, 0.000240502704f, 0.000244014911f,
+    0.000247547956f, 0.000251101679f, 0.000254675979f, 0.000258270709f,
+    0.000261885754f, 0.000265520939f, 0.000269176147f, 0.000272851234f,
+    0.000276546081f, 0.000280260545f, 0.000283994479f, 0.000287747709f,
+    0.000291520148f, 0.000295311649f, 0.000299122039f, 0.000302951172f,
+    0.000306798931f, 0.000310665142f, 0.000314549718f, 0.000318452425f,
+    0.000322373176f, 0.000326311827f, 0.000330268202f, 0.000334242184f,
+    0.000338233571f, 0.000342242245f, 0.000346268062f, 0.000350310875f,
+    0.000354370510f, 0.000358446821f, 0.000362539664f, 0.000366648863f,
+    0.000370774273f, 0.000374915777f, 0.000379073143f, 0.000383246283f,
+    0.000387435022f, 0.000391639187f, 0.000395858631f, 0.000400093180f,
+    0.000404342689f, 0.000408606982f, 0.000412885944f, 0.000417179341f,
+    0.000421487086f, 0.000425808976f, 0.000430144835f, 0.000434494548f,
+    0.000438857882f, 0.000443234749f, 0.000447624945f, 0.000452028296f,
+    0.000456444657f, 0.000460873853f, 0.000465315708f, 0.000469770079f,
+    0.000474236760f, 0.000478715636f, 0.000483206502f, 0.000487709185f,
+    0.000492223538f, 0.000496749359f, 0.000501286529f, 0.000505834818f,
+    0.000510394049f, 0.000514964166f, 0.000519544876f, 0.000524136005f,
+    0.000528737495f, 0.000533349055f, 0.000537970569f, 0.000542601862f,
+    0.000547242700f, 0.000551892968f, 0.000556552492f, 0.000561221095f,
+    0.000565898605f, 0.000570584787f, 0.000575279526f, 0.000579982589f,
+    0.000584693917f, 0.000589413161f, 0.000594140321f, 0.000598875049f,
+    0.000603617285f, 0.000608366856f, 0.000613123470f, 0.000617887068f,
+    0.000622657419f, 0.000627434347f, 0.000632217678f, 0.000637007179f,
+    0.000641802733f, 0.000646604167f, 0.000651411305f, 0.000656223914f,
+    0.000661041820f, 0.000665864849f, 0.000670692825f, 0.000675525633f,
+    0.000680362980f, 0.000685204694f, 0.000690050714f, 0.000694900693f,
+    0.000699754572f, 0.000704612175f, 0.000709473214f, 0.000714337570f,
+    0.000719205011f, 0.000724075420f, 0.000728948624f, 0.000733824389f,
+    0.000738702540f, 0.000743582903f, 0.000748465245f, 0.000753349508f,
+    0.000758235401f, 0.000763122749f, 0.000768011378f, 0.000772901112f,
+    0.000777791778f, 0.000782683201f, 0.000787575147f, 0.000792467443f,
+    0.000797359971f, 0.000802252500f, 0.000807144796f, 0.000812036742f,
+    0.000816928165f, 0.000821818830f, 0.000826708565f, 0.000831597194f,
+    0.000836484542f, 0.000841370435f, 0.000846254698f, 0.000851137040f,
+    0.000856017403f, 0.000860895554f, 0.000865771319f, 0.000870644522f,
+    0.000875514932f, 0.000880382373f, 0.000885246729f, 0.000890107767f,
+    0.000894965371f, 0.000899819250f, 0.000904669228f, 0.000909515249f,
+    0.000914356962f, 0.000919194310f, 0.000924027117f, 0.000928855094f,
+    0.000933678122f, 0.000938496029f, 0.000943308638f, 0.000948115776f,
+    0.000952917209f, 0.000957712764f, 0.000962502265f, 0.000967285596f,
+    0.000972062524f, 0.000976832816f, 0.000981596415f, 0.000986353145f,
+    0.000991102657f, 0.000995844835f, 0.00100057968f, 0.00100530672f,
+    0.00101002608f, 0.00101473730f, 0.00101944047f, 0.00102413516f,
+    0.00102882134f, 0.00103349879f, 0.00103816739f, 0.00104282692f,
+    0.00104747724f, 0.00105211814f, 0.00105674937f, 0.00106137083f,
+    0.00106598251f, 0.00107058394f, 0.00107517513f, 0.00107975584f,
+    0.00108432584f, 0.00108888512f, 0.00109343347f, 0.00109797064f,
+    0.00110249640f, 0.00110701076f, 0.00111151347f, 0.00111600431f,
+    0.00112048315f, 0.00112494989f, 0.00112940418f, 0.00113384612f,
+    0.00113827526f, 0.00114269170f, 0.00114709500f, 0.00115148514f,
+    0.00115586200f, 0.00116022537f, 0.00116457511f, 0.00116891100f,
+    0.00117323291f, 0.00117754063f, 0.00118183403f, 0.00118611299f,
+    0.00119037728f, 0.00119462679f, 0.00119886128f, 0.00120308076f,
+    0.00120728498f, 0.00121147360f, 0.00121564674f, 0.00121980417f,
+    0.00122394564f, 0.00122807105f, 0.00123218028f, 0.00123627309f,
+    0.00124034949f, 0.00124440913f, 0.00124845188f, 0.00125247764f,
+    0.00125648640f, 0.00126047782f, 0.00126445177f, 0.00126840814f,
+    0.00127234671f, 0.00127626746f, 0.00128017028f, 0.00128405483f,
+    0.00128792098f, 0.00129176874f, 0.00129559787f, 0.00129940826f,
+    0.00130319980f, 0.00130697223f, 0.00131072546f, 0.00131445937f,
+    0.00131817383f, 0.00132186874f, 0.00132554385f, 0.00132919906f,
+    0.00133283425f, 0.00133644918f, 0.00134004396f, 0.00134361826f,
+    0.00134717196f, 0.00135070505f, 0.00135421718f, 0.00135770848f,
+    0.00136117858f, 0.00136462750f, 0.00136805512f, 0.00137146120f,
+    0.00137484563f, 0.00137820828f, 0.00138154917f, 0.00138486805f,
+    0.00138816470f, 0.00139143923f, 0.00139469129f, 0.00139792101f,
+    0.00140112801f, 0.00140431232f, 0.00140747370f, 0.00141061214f,
+    0.00141372753f, 0.00141681975f, 0.00141988858f, 0.00142293400f,
+    0.00142595591f, 0.00142895407f, 0.00143192848f, 0.00143487903f,
+    0.00143780548f, 0.00144070794f, 0.00144358608f, 0.00144644000f,
+    0.00144926936f, 0.00145207427f, 0.00145485450f, 0.00145760993f,
+    0.00146034057f, 0.00146304618f, 0.00146572676f, 0.00146838219f,
+    0.00147101237f, 0.00147361716f, 0.00147619657f, 0.00147875026f,
+    0.00148127845f, 0.00148378080f, 0.00148625730f, 0.00148870796f,
+    0.00149113254f, 0.00149353093f, 0.00149590324f, 0.00149824913f,
+    0.00150056870f, 0.00150286173f, 0.00150512822f, 0.00150736817f,
+    0.00150958123f, 0.00151176762f, 0.00151392701f, 0.00151605951f,
+    0.00151816488f, 0.00152024312f, 0.00152229413f, 0.00152431789f,
+    0.00152631418f, 0.00152828312f, 0.00153022457f, 0.00153213833f,
+    0.00153402449f, 0.00153588294f, 0.00153771357f, 0.00153951626f,
+    0.00154129113f, 0.00154303783f, 0.00154475658f, 0.00154644717f,
+    0.00154810958f, 0.00154974358f, 0.00155134941f, 0.00155292684f,
+    0.00155447575f, 0.00155599613f, 0.00155748799f, 0.00155895134f,
+    0.00156038592f, 0.00156179175f, 0.00156316883f, 0.00156451704f,
+    0.00156583637f, 0.00156712683f, 0.00156838831f, 0.00156962068f,
+    0.00157082407f, 0.00157199823f, 0.00157314329f, 0.00157425925f,
+    0.00157534576f, 0.00157640316f, 0.00157743110f, 0.00157842971f,
+    0.00157939887f, 0.00158033869f, 0.00158124894f, 0.00158212974f,
+    0.00158298097f, 0.00158380251f, 0.00158459460f, 0.00158535701f,
+    0.00158608973f, 0.00158679276f, 0.00158746610f, 0.00158810965f,
+    0.00158872339f, 0.00158930745f, 0.00158986158f, 0.00159038592f,
+    0.00159088045f, 0.00159134506f, 0.00159177976f, 0.00159218453f,
+    0.00159255951f, 0.00159290445f, 0.00159321935f, 0.00159350445f,
+    0.00159375952f, 0.00159398455f, 0.00159417966f, 0.00159434474f,
+    0.00159447978f, 0.00159458490f, 0.00159465987f, 0.00159470493f,
+    0.00159471994f, 0.00159470493f, 0.00159465987f, 0.00159458490f,
+    0.00159447978f, 0.00159434474f, 0.00159417966f, 0.00159398455f,
+    0.00159375952f, 0.00159350445f, 0.00159321935f, 0.00159290445f,
+    0.00159255951f, 0.00159218453f, 0.00159177976f, 0.00159134506f,
+    0.00159088045f, 0.00159038592f, 0.00158986158f, 0.00158930745f,
+    0.00158872339f, 0.00158810965f, 0.00158746610f, 0.00158679276f,
+    0.00158608973f, 0.00158535701f, 0.00158459460f, 0.00158380251f,
+    0.00158298097f, 0.00158212974f, 0.00158124894f, 0.00158033869f,
+    0.00157939887f, 0.00157842971f, 0.00157743110f, 0.00157640316f,
+    0.00157534576f, 0.00157425925f, 0.00157314329f, 0.00157199823f,
+    0.00157082407f, 0.00156962068f, 0.00156838831f, 0.00156712683f,
+    0.00156583637f, 0.00156451704f, 0.00156316883f, 0.00156179175f,
+    0.00156038592f, 0.00155895134f, 0.00155748799f, 0.00155599613f,
+    0.00155447575f, 0.00155292684f, 0.00155134941f, 0.00154974358f,
+    0.00154810958f, 0.00154644717f, 0.00154475658f, 0.00154303783f,
+    0.00154129113f, 0.00153951626f, 0.00153771357f, 0.00153588294f,
+    0.00153402449f, 0.00153213833f, 0.00153022457f, 0.00152828312f,
+    0.00152631418f, 0.00152431789f, 0.00152229413f, 0.00152024312f,
+    0.00151816488f, 0.00151605951f, 0.00151392701f, 0.00151176762f,
+    0.00150958123f, 0.00150736817f, 0.00150512822f, 0.00150286173f,
+    0.00150056870f, 0.00149824913f, 0.00149590324f, 0.00149353093f,
+    0.00149113254f, 0.00148870796f, 0.00148625730f, 0.00148378080f,
+    0.00148127845f, 0.00147875026f, 0.00147619657f, 0.00147361716f,
+    0.00147101237f, 0.00146838219f, 0.00146572676f, 0.00146304618f,
+    0.00146034057f, 0.00145760993f, 0.00145485450f, 0.00145207427f,
+    0.00144926936f, 0.00144644000f, 0.00144358608f, 0.00144070794f,
+    0.00143780548f, 0.00143487903f, 0.00143192848f, 0.00142895407f,
+    0.00142595591f, 0.00142293400f, 0.00141988858f, 0.00141681975f,
+    0.00141372753f, 0.00141061214f, 0.00140747370f, 0.00140431232f,
+    0.00140112801f, 0.00139792101f, 0.00139469129f, 0.00139143923f,
+    0.00138816470f, 0.00138486805f, 0.00138154917f, 0.00137820828f,
+    0.00137484563f, 0.00137146120f, 0.00136805512f, 0.00136462750f,
+    0.00136117858f, 0.00135770848f, 0.00135421718f, 0.00135070505f,
+    0.00134717196f, 0.00134361826f, 0.00134004396f, 0.00133644918f,
+    0.00133283425f, 0.00132919906f, 0.00132554385f, 0.00132186874f,
+    0.00131817383f, 0.00131445937f, 0.00131072546f, 0.00130697223f,
+    0.00130319980f, 0.00129940826f, 0.00129559787f, 0.00129176874f,
+    0.00128792098f, 0.00128405483f, 0.00128017028f, 0.00127626746f,
+    0.00127234671f, 0.00126840814f, 0.00126445177f, 0.00126047782f,
+    0.00125648640f, 0.00125247764f, 0.00124845188f, 0.00124440913f,
+    0.00124034949f, 0.00123627309f, 0.00123218028f, 0.00122807105f,
+    0.00122394564f, 0.00121980417f, 0.00121564674f, 0.00121147360f,
+    0.00120728498f, 0.00120308076f, 0.00119886128f, 0.00119462679f,
+    0.00119037728f, 0.00118611299f, 0.00118183403f, 0.00117754063f,
+    0.00117323291f, 0.00116891100f, 0.00116457511f, 0.00116022537f,
+    0.00115586200f, 0.00115148514f, 0.00114709500f, 0.00114269170f,
+    0.00113827526f, 0.00113384612f, 0.00112940418f, 0.00112494989f,
+    0.00112048315f, 0.00111600431f, 0.00111151347f, 0.00110701076f,
+    0.00110249640f, 0.00109797064f, 0.00109343347f, 0.00108888512f,
+    0.00108432584f, 0.00107975584f, 0.00107517513f, 0.00107058394f,
+    0.00106598251f, 0.00106137083f, 0.00105674937f, 0.00105211814f,
+    0.00104747724f, 0.00104282692f, 0.00103816739f, 0.00103349879f,
+    0.00102882134f, 0.00102413516f, 0.00101944047f, 0.00101473730f,
+    0.00101002608f, 0.00100530672f, 0.00100057968f, 0.000995844835f,
+    0.000991102657f, 0.000986353145f, 0.000981596415f, 0.000976832816f,
+    0.000972062524f, 0.000967285596f, 0.000962502265f, 0.000957712764f,
+    0.000952917209f, 0.000948115776f, 0.000943308638f, 0.000938496029f,
+    0.000933678122f, 0.000928855094f, 0.000924027117f, 0.000919194310f,
+    0.000914356962f, 0.000909515249f, 0.000904669228f, 0.000899819250f,
+    0.000894965371f, 0.000890107767f, 0.000885246729f, 0.000880382373f,
+    0.000875514932f, 0.000870644522f, 0.000865771319f, 0.000860895554f,
+    0.000856017403f, 0.000851137040f, 0.000846254698f, 0.000841370435f,
+    0.000836484542f, 0.000831597194f, 0.000826708565f, 0.000821818830f,
+    0.000816928165f, 0.000812036742f, 0.000807144796f, 0.000802252500f,
+    0.000797359971f, 0.000792467443f, 0.000787575147f, 0.000782683201f,
+    0.000777791778f, 0.000772901112f, 0.000768011378f, 0.000763122749f,
+    0.000758235401f, 0.000753349508f, 0.000748465245f, 0.000743582903f,
+    0.000738702540f, 0.000733824389f, 0.000728948624f, 0.000724075420f,
+    0.000719205011f, 0.000714337570f, 0.000709473214f, 0.000704612175f,
+    0.000699754572f, 0.000694900693f, 0.000690050714f, 0.000685204694f,
+    0.000680362980f, 0.000675525633f, 0.000670692825f, 0.000665864849f,
+    0.000661041820f, 0.000656223914f, 0.000651411305f, 0.000646604167f,
+    0.000641802733f, 0.000637007179f, 0.000632217678f, 0.000627434347f,
+    0.000622657419f, 0.000617887068f, 0.000613123470f, 0.000608366856f,
+    0.000603617285f, 0.000598875049f, 0.000594140321f, 0.000589413161f,
+    0.000584693917f, 0.000579982589f, 0.000575279526f, 0.000570584787f,
+    0.000565898605f, 0.000561221095f, 0.000556552492f, 0.000551892968f,
+    0.000547242700f, 0.000542601862f, 0.000537970569f, 0.000533349055f,
+    0.000528737495f, 0.000524136005f, 0.000519544876f, 0.000514964166f,
+    0.000510394049f, 0.000505834818f, 0.000501286529f, 0.000496749359f,
+    0.000492223538f, 0.000487709185f, 0.000483206502f, 0.000478715636f,
+    0.000474236760f, 0.000469770079f, 0.000465315708f, 0.000460873853f,
+    0.000456444657f, 0.000452028296f, 0.000447624945f, 0.000443234749f,
+    0.000438857882f, 0.000434494548f, 0.000430144835f, 0.000425808976f,
+    0.000421487086f, 0.000417179341f, 0.000412885944f, 0.000408606982f,
+    0.000404342689f, 0.000400093180f, 0.000395858631f, 0.000391639187f,
+    0.000387435022f, 0.000383246283f, 0.000379073143f, 0.000374915777f,
+    0.000370774273f, 0.000366648863f, 0.000362539664f, 0.000358446821f,
+    0.000354370510f, 0.000350310875f, 0.000346268062f, 0.000342242245f,
+    0.000338233571f, 0.000334242184f, 0.000330268202f, 0.000326311827f,
+    0.000322373176f, 0.000318452425f, 0.000314549718f, 0.000310665142f,
+    0.000306798931f, 0.000302951172f, 0.000299122039f, 0.000295311649f,
+    0.000291520148f, 0.000287747709f, 0.000283994479f, 0.000280260545f,
+    0.000276546081f, 0.000272851234f, 0.000269176147f, 0.000265520939f,
+    0.000261885754f, 0.000258270709f, 0.000254675979f, 0.000251101679f,
+    0.000247547956f, 0.000244014911f, 0.000240502704f, 0.000237011467f,
+    0.000233541330f, 0.000230092410f, 0.000226664866f, 0.000223258787f,
+    0.000219874331f, 0.000216511631f, 0.000213170788f, 0.000209851933f,
+    0.000206555196f, 0.000203280710f, 0.000200028604f, 0.000196798966f,
+    0.000193591943f, 0.000190407663f, 0.000187246216f, 0.000184107761f,
+    0.000180992385f, 0.000177900205f, 0.000174831352f, 0.000171785941f,
+    0.000168764091f, 0.000165765887f, 0.000162791475f, 0.000159840958f,
+    0.000156914437f, 0.000154012028f, 0.000151133849f, 0.000148279985f,
+    0.000145450569f, 0.000142645687f, 0.000139865471f, 0.000137109993f,
+    0.000134379385f, 0.000131673733f, 0.000128993139f, 0.000126337720f,
+    0.000123707563f, 0.000121102756f, 0.000118523421f, 0.000115969640f,
+    0.000113441514f, 0.000110939131f, 0.000108462598f, 0.000106012005f,
+    0.000103587430f, 0.000101188984f, 9.88167449e-05f, 9.64708088e-05f,
+    9.41512553e-05f, 9.18581791e-05f, 8.95916673e-05f, 8.73518002e-05f,
+    8.51386649e-05f, 8.29523487e-05f, 8.07929246e-05f, 7.86604796e-05f,
+    7.65550940e-05f, 7.44768477e-05f, 7.24258134e-05f, 7.04020786e-05f,
+    6.84057086e-05f, 6.64367835e-05f, 6.44953761e-05f, 6.25815665e-05f,
+    6.06954127e-05f, 5.88369985e-05f, 5.70063894e-05f, 5.52036545e-05f,
+    5.34288592e-05f, 5.16820764e-05f, 4.99633643e-05f, 4.82727919e-05f,
+    4.66104211e-05f, 4.49763174e-05f, 4.33705427e-05f, 4.17931515e-05f,
+    4.02442092e-05f, 3.87237706e-05f, 3.72318937e-05f, 3.57686367e-05f,
+    3.43340544e-05f, 3.29281975e-05f, 3.15511206e-05f, 3.02028766e-05f,
+    2.88835145e-05f, 2.75930870e-05f, 2.63316397e-05f, 2.50992216e-05f,
+    2.38958783e-05f, 2.27216569e-05f, 2.15765995e-05f, 2.04607495e-05f,
+    1.93741489e-05f, 1.83168395e-05f, 1.72888613e-05f, 1.62902506e-05f,
+    1.53210476e-05f, 1.43812886e-05f, 1.34710081e-05f, 1.25902407e-05f,
+    1.17390182e-05f, 1.09173752e-05f, 1.01253409e-05f, 9.36294509e-06f,
+    8.63021796e-06f, 7.92718492e-06f, 7.25387417e-06f, 6.61031072e-06f,
+    5.99651821e-06f, 5.41251984e-06f, 4.85833834e-06f, 4.33399373e-06f,
+    3.83950601e-06f, 3.37489428e-06f, 2.94017536e-06f, 2.53536609e-06f,
+    2.16048147e-06f, 1.81553548e-06f, 1.50054143e-06f, 1.21551102e-06f,
+    9.60455054e-07f, 7.35382969e-07f, 5.40303404e-07f, 3.75223635e-07f,
+    2.40149916e-07f, 1.35087291e-07f, 6.00397385e-08f, 1.50100767e-08f,
+};
+
+const FLOAT twolame_psycho_4_window[BLKSIZE] = {
+    2.35309517e-06f, 2.35309517e-06f, 2.11777242e-05f, 5.88262737e-05f,
+    0.000115297327f, 0.000190588748f, 0.000284697715f, 0.000397620694f,
+    0.000529353390f, 0.000679890916f, 0.000849227537f, 0.00103735691f,
+    0.00124427187f, 0.00146996486f, 0.00171442714f, 0.00197764952f,
+    0.00225962233f, 0.00256033451f, 0.00287977536f, 0.00321793230f,
+    0.00357479276f, 0.00395034347f, 0.00434456998f, 0.00475745788f,
+    0.00518899132f, 0.00563915400f, 0.00610792916f, 0.00659529911f,
+    0.00710124522f, 0.00762574887f, 0.00816879049f, 0.00873034913f,
+    0.00931040291f, 0.00990893226f, 0.0105259120f, 0.0111613208f,
+    0.0118151344f, 0.0124873277f, 0.0131778754f, 0.0138867516f,
+    0.0146139292f, 0.0153593821f, 0.0161230806f, 0.0169049986f,
+    0.0177051034f, 0.0185233671f, 0.0193597563f, 0.0202142429f,
+    0.0210867934f, 0.0219773743f, 0.0228859521f, 0.0238124933f,
+    0.0247569624f, 0.0257193241f, 0.0266995430f, 0.0276975818f,
+    0.0287134014f, 0.0297469646f, 0.0307982322f, 0.0318671651f,
+    0.0329537243f, 0.0340578668f, 0.0351795517f, 0.0363187380f,
+    0.0374753810f, 0.0386494361f, 0.0398408622f, 0.0410496108f,
+    0.0422756411f, 0.0435189046f, 0.0447793528f, 0.0460569412f,
+    0.0473516211f, 0.0486633405f, 0.0499920547f, 0.0513377078f,
+    0.0527002588f, 0.0540796444f, 0.0554758236f, 0.0568887368f,
+    0.0583183318f, 0.0597645566f, 0.0612273552f, 0.0627066717f,
+    0.0642024577f, 0.0657146499f, 0.0672431886f, 0.0687880218f,
+    0.0703490898f, 0.0719263330f, 0.0735196993f, 0.0751291141f,
+    0.0767545328f, 0.0783958808f, 0.0800531060f, 0.0817261338f,
+    0.0834149197f, 0.0851193815f, 0.0868394673f, 0.0885751098f,
+    0.0903262421f, 0.0920927972f, 0.0938747078f, 0.0956719071f,
+    0.0974843353f, 0.0993119106f, 0.101154581f, 0.103012264f,
+    0.104884893f, 0.106772393f, 0.108674705f, 0.110591747f,
+    0.112523444f, 0.114469737f, 0.116430543f, 0.118405789f,
+    0.120395407f, 0.122399315f, 0.124417432f, 0.126449704f,
+    0.128496021f, 0.130556345f, 0.132630557f, 0.134718612f,
+    0.136820421f, 0.138935909f, 0.141064972f, 0.143207565f,
+    0.145363584f, 0.147532955f, 0.149715602f, 0.151911438f,
+    0.154120371f, 0.156342328f, 0.158577234f, 0.160824984f,
+    0.163085505f, 0.165358707f, 0.167644516f, 0.169942826f,
+    0.172253579f, 0.174576655f, 0.176911995f, 0.179259494f,
+    0.181619063f, 0.183990628f, 0.186374098f, 0.188769355f,
+    0.191176340f, 0.193594962f, 0.196025103f, 0.198466703f,
+    0.200919643f, 0.203383848f, 0.205859229f, 0.208345667f,
+    0.210843101f, 0.213351414f, 0.215870529f, 0.218400329f,
+    0.220940739f, 0.223491654f, 0.226052970f, 0.228624612f,
+    0.231206462f, 0.233798429f, 0.236400425f, 0.239012361f,
+    0.241634101f, 0.244265571f, 0.246906683f, 0.249557301f,
+    0.252217382f, 0.254886746f, 0.257565379f, 0.260253131f,
+    0.262949884f, 0.265655577f, 0.268370122f, 0.271093339f,
+    0.273825198f, 0.276565582f, 0.279314369f, 0.282071471f,
+    0.284836769f, 0.287610173f, 0.290391564f, 0.293180853f,
+    0.295977920f, 0.298782676f, 0.301595002f, 0.304414809f,
+    0.307241976f, 0.310076386f, 0.312917978f, 0.315766573f,
+    0.318622142f, 0.321484506f, 0.324353635f, 0.327229351f,
+    0.330111563f, 0.333000183f, 0.335895091f, 0.338796169f,
+    0.341703326f, 0.344616413f, 0.347535372f, 0.350460082f,
+    0.353390425f, 0.356326282f, 0.359267533f, 0.362214088f,
+    0.365165830f, 0.368122667f, 0.371084452f, 0.374051094f,
+    0.377022475f, 0.379998475f, 0.382979035f, 0.385963947f,
+    0.388953179f, 0.391946614f, 0.394944072f, 0.397945523f,
+    0.400950789f, 0.403959811f, 0.406972438f, 0.409988552f,
+    0.413008064f, 0.416030854f, 0.419056803f, 0.422085792f,
+    0.425117731f, 0.428152472f, 0.431189924f, 0.434230000f,
+    0.437272519f, 0.440317392f, 0.443364531f, 0.446413785f,
+    0.449465066f, 0.452518255f, 0.455573231f, 0.458629876f,
+    0.461688071f, 0.464747727f, 0.467808694f, 0.470870882f,
+    0.473934144f, 0.476998419f, 0.480063528f, 0.483129412f,
+    0.486195922f, 0.489262968f, 0.492330402f, 0.495398134f,
+    0.498466015f, 0.501533985f, 0.504601896f, 0.507669628f,
+    0.510737062f, 0.513804078f, 0.516870558f, 0.519936442f,
+    0.523001611f, 0.526065826f, 0.529129148f, 0.532191336f,
+    0.535252273f, 0.538311958f, 0.541370153f, 0.544426799f,
+    0.547481775f, 0.550534904f, 0.553586185f, 0.556635499f,
+    0.559682608f, 0.562727511f, 0.565770030f, 0.568810046f,
+    0.571847498f, 0.574882269f, 0.577914178f, 0.580943167f,
+    0.583969176f, 0.586991966f, 0.590011477f, 0.593027592f,
+    0.596040189f, 0.599049211f, 0.602054477f, 0.605055928f,
+    0.608053386f, 0.611046791f, 0.614036024f, 0.617020965f,
+    0.620001495f, 0.622977555f, 0.625948906f, 0.628915548f,
+    0.631877363f, 0.634834170f, 0.637785912f, 0.640732467f,
+    0.643673718f, 0.646609604f, 0.649539888f, 0.652464628f,
+    0.655383587f, 0.658296704f, 0.661203861f, 0.664104939f,
+    0.666999817f, 0.669888437f, 0.672770679f, 0.675646365f,
+    0.678515494f, 0.681377888f, 0.684233427f, 0.687082052f,
+    0.689923584f, 0.692758024f, 0.695585191f, 0.698404968f,
+    0.701217353f, 0.704022110f, 0.706819177f, 0.709608436f,
+    0.712389827f, 0.715163231f, 0.717928529f, 0.720685661f,
+    0.723434448f, 0.726174772f, 0.728906631f, 0.731629908f,
+    0.734344423f, 0.737050116f, 0.739746869f, 0.742434621f,
+    0.745113254f, 0.747782648f, 0.750442684f, 0.753093302f,
+    0.755734444f, 0.758365929f, 0.760987639f, 0.763599575f,
+    0.766201556f, 0.768793523f, 0.771375418f, 0.773947001f,
+    0.776508331f, 0.779059291f, 0.781599700f, 0.784129500f,
+    0.786648571f, 0.789156914f, 0.791654348f, 0.794140756f,
+    0.796616137f, 0.799080372f, 0.801533282f, 0.803974867f,
+    0.806405067f, 0.808823645f, 0.811230659f, 0.813625932f,
+    0.816009343f, 0.818380952f, 0.820740521f, 0.823087990f,
+    0.825423360f, 0.827746451f, 0.830057144f, 0.832355499f,
+    0.834641278f, 0.836914480f, 0.839175045f, 0.841422796f,
+    0.843657672f, 0.845879614f, 0.848088562f, 0.850284398f,
+    0.852467060f, 0.854636431f, 0.856792450f, 0.858934999f,
+    0.861064076f, 0.863179564f, 0.865281403f, 0.867369413f,
+    0.869443655f, 0.871503949f, 0.873550296f, 0.875582576f,
+    0.877600670f, 0.879604578f, 0.881594181f, 0.883569479f,
+    0.885530233f, 0.887476563f, 0.889408231f, 0.891325295f,
+    0.893227577f, 0.895115137f, 0.896987736f, 0.898845434f,
+    0.900688112f, 0.902515650f, 0.904328108f, 0.906125307f,
+    0.907907188f, 0.909673750f, 0.911424875f, 0.913160503f,
+    0.914880633f, 0.916585088f, 0.918273866f, 0.919946909f,
+    0.921604097f, 0.923245490f, 0.924870908f, 0.926480293f,
+    0.928073645f, 0.929650903f, 0.931211948f, 0.932756841f,
+    0.934285343f, 0.935797572f, 0.937293351f, 0.938772619f,
+    0.940235436f, 0.941681683f, 0.943111241f, 0.944524169f,
+    0.945920348f, 0.947299719f, 0.948662281f, 0.950007975f,
+    0.951336682f, 0.952648401f, 0.953943074f, 0.955220640f,
+    0.956481099f, 0.957724333f, 0.958950400f, 0.960159123f,
+    0.961350560f, 0.962524593f, 0.963681281f, 0.964820445f,
+    0.965942144f, 0.967046261f, 0.968132854f, 0.969201744f,
+    0.970253050f, 0.971286595f, 0.972302437f, 0.973300457f,
+    0.974280655f, 0.975243032f, 0.976187527f, 0.977114022f,
+    0.978022635f, 0.978913188f, 0.979785740f, 0.980640233f,
+    0.981476605f, 0.982294917f, 0.983094990f, 0.983876944f,
+    0.984640598f, 0.985386074f, 0.986113250f, 0.986822128f,
+    0.987512648f, 0.988184869f, 0.988838673f, 0.989474058f,
+    0.990091085f, 0.990689576f, 0.991269648f, 0.991831183f,
+    0.992374241f, 0.992898762f, 0.993404686f, 0.993892074f,
+    0.994360864f, 0.994810998f, 0.995242536f, 0.995655417f,
+    0.996049643f, 0.996425211f, 0.996782064f, 0.997120202f,
+    0.997439682f, 0.997740388f, 0.998022377f, 0.998285592f,
+    0.998530030f, 0.998755753f, 0.998962641f, 0.999150753f,
+    0.999320090f, 0.999470651f, 0.999602377f, 0.999715328f,
+    0.999809384f, 0.999884725f, 0.999941170f, 0.999978840f,
+    0.999997675f, 0.999997675f, 0.999978840f, 0.999941170f,
+    0.999884725f, 0.999809384f, 0.999715328f, 0.999602377f,
+    0.999470651f, 0.999320090f, 0.999150753f, 0.998962641f,
+    0.998755753f, 0.998530030f, 0.998285592f, 0.998022377f,
+    0.997740388f, 0.997439682f, 0.997120202f, 0.996782064f,
+    0.996425211f, 0.996049643f, 0.995655417f, 0.995242536f,
+    0.994810998f, 0.994360864f, 0.993892074f, 0.993404686f,
+    0.992898762f, 0.992374241f, 0.991831183f, 0.991269648f,
+    0.990689576f, 0.990091085f, 0.989474058f, 0.988838673f,
+    0.988184869f, 0.987512648f, 0.986822128f, 0.986113250f,
+    0.985386074f, 0.984640598f, 0.983876944f, 0.983094990f,
+    0.982294917f, 0.981476605f, 0.980640233f, 0.979785740f,
+    0.978913188f, 0.978022635f, 0.977114022f, 0.976187527f,
+    0.975243032f, 0.974280655f, 0.973300457f, 0.972302437f,
+    0.971286595f, 0.970253050f, 0.969201744f, 0.968132854f,
+    0.967046261f, 0.965942144f, 0.964820445f, 0.963681281f,
+    0.962524593f, 0.961350560f, 0.960159123f, 0.958950400f,
+    0.957724333f, 0.956481099f, 0.955220640f, 0.953943074f,
+    0.952648401f, 0.951336682f, 0.950007975f, 0.948662281f,
+    0.947299719f, 0.945920348f, 0.944524169f, 0.943111241f,
+    0.941681683f, 0.940235436f, 0.938772619f, 0.937293351f,
+    0.935797572f, 0.934285343f, 0.932756841f, 0.931211948f,
+    0.929650903f, 0.928073645f, 0.926480293f, 0.924870908f,
+    0.923245490f, 0.921604097f, 0.919946909f, 0.918273866f,
+    0.916585088f, 0.914880633f, 0.913160503f, 0.911424875f,
+    0.909673750f, 0.907907188f, 0.906125307f, 0.904328108f,
+    0.902515650f, 0.900688112f, 0.898845434f, 0.896987736f,
+    0.895115137f, 0.893227577f, 0.891325295f, 0.889408231f,
+    0.887476563f, 0.885530233f, 0.883569479f, 0.881594181f,
+    0.879604578f, 0.877600670f, 0.875582576f, 0.873550296f,
+    0.871503949f, 0.869443655f, 0.867369413f, 0.865281403f,
+    0.863179564f, 0.861064076f, 0.858934999f, 0.856792450f,
+    0.854636431f, 0.852467060f, 0.850284398f, 0.848088562f,
+    0.845879614f, 0.843657672f, 0.841422796f, 0.839175045f,
+    0.836914480f, 0.834641278f, 0.832355499f, 0.830057144f,
+    0.827746451f, 0.825423360f, 0.823087990f, 0.820740521f,
+    0.818380952f, 0.816009343f, 0.813625932f, 0.811230659f,
+    0.808823645f, 0.806405067f, 0.803974867f, 0.801533282f,
+    0.799080372f, 0.796616137f, 0.794140756f, 0.791654348f,
+    0.789156914f, 0.786648571f, 0.784129500f, 0.781599700f,
+    0.779059291f, 0.776508331f, 0.773947001f, 0.771375418f,
+    0.768793523f, 0.766201556f, 0.763599575f, 0.760987639f,
+    0.758365929f, 0.755734444f, 0.753093302f, 0.750442684f,
+    0.747782648f, 0.745113254f, 0.742434621f, 0.739746869f,
+    0.737050116f, 0.734344423f, 0.731629908f, 0.728906631f,
+    0.726174772f, 0.723434448f, 0.720685661f, 0.717928529f,
+    0.715163231f, 0.712389827f, 0.709608436f, 0.706819177f,
+    0.704022110f, 0.701217353f, 0.698404968f, 0.695585191f,
+    0.692758024f, 0.689923584f, 0.687082052f, 0.684233427f,
+    0.681377888f, 0.678515494f, 0.675646365f, 0.672770679f,
+    0.669888437f, 0.666999817f, 0.664104939f, 0.661203861f,
+    0.658296704f, 0.655383587f, 0.652464628f, 0.649539888f,
+    0.646609604f, 0.643673718f, 0.640732467f, 0.637785912f,
+    0.634834170f, 0.631877363f, 0.628915548f, 0.625948906f,
+    0.622977555f, 0.620001495f, 0.617020965f, 0.614036024f,
+    0.611046791f, 0.608053386f, 0.605055928f, 0.602054477f,
+    0.599049211f, 0.596040189f, 0.593027592f, 0.590011477f,
+    0.586991966f, 0.583969176f, 0.580943167f, 0.577914178f,
+    0.574882269f, 0.571847498f, 0.568810046f, 0.565770030f,
+    0.562727511f, 0.559682608f, 0.556635499f, 0.553586185f,
+    0.550534904f, 0.547481775f, 0.544426799f, 0.541370153f,
+    0.538311958f, 0.535252273f, 0.532191336f, 0.529129148f,
+    0.526065826f, 0.523001611f, 0.519936442f, 0.516870558f,
+    0.513804078f, 0.510737062f, 0.507669628f, 0.504601896f,
+    0.501533985f, 0.498466015f, 0.495398134f, 0.492330402f,
+    0.489262968f, 0.486195922f, 0.483129412f, 0.480063528f,
+    0.476998419f, 0.473934144f, 0.470870882f, 0.467808694f,
+    0.464747727f, 0.461688071f, 0.458629876f, 0.455573231f,
+    0.452518255f, 0.449465066f, 0.446413785f, 0.443364531f,
+    0.440317392f, 0.437272519f, 0.434230000f, 0.431189924f,
+    0.428152472f, 0.425117731f, 0.422085792f, 0.419056803f,
+    0.416030854f, 0.413008064f, 0.409988552f, 0.406972438f,
+    0.403959811f, 0.400950789f, 0.397945523f, 0.394944072f,
+    0.391946614f, 0.388953179f, 0.385963947f, 0.382979035f,
+    0.379998475f, 0.377022475f, 0.374051094f, 0.371084452f,
+    0.368122667f, 0.365165830f, 0.362214088f, 0.359267533f,
+    0.356326282f, 0.353390425f, 0.350460082f, 0.347535372f,
+    0.344616413f, 0.341703326f, 0.338796169f, 0.335895091f,
+    0.333000183f, 0.330111563f, 0.327229351f, 0.324353635f,
+    0.321484506f, 0.318622142f, 0.315766573f, 0.312917978f,
+    0.310076386f, 0.307241976f, 0.304414809f, 0.301595002f,
+    0.298782676f, 0.295977920f, 0.293180853f, 0.290391564f,
+    0.287610173f, 0.284836769f, 0.282071471f, 0.279314369f,
+    0.276565582f, 0.273825198f, 0.271093339f, 0.268370122f,
+    0.265655577f, 0.262949884f, 0.260253131f, 0.257565379f,
+    0.254886746f, 0.252217382f, 0.249557301f, 0.246906683f,
+    0.244265571f, 0.241634101f, 0.239012361f, 0.236400425f,
+    0.233798429f, 0.231206462f, 0.228624612f, 0.226052970f,
+    0.223491654f, 0.220940739f, 0.218400329f, 0.215870529f,
+    0.213351414f, 0.210843101f, 0.208345667f, 0.205859229f,
+    0.203383848f, 0.200919643f, 0.198466703f, 0.196025103f,
+    0.193594962f, 0.191176340f, 0.188769355f, 0.186374098f,
+    0.183990628f, 0.181619063f, 0.179259494f, 0.176911995f,
+    0.174576655f, 0.172253579f, 0.169942826f, 0.167644516f,
+    0.165358707f, 0.163085505f, 0.160824984f, 0.158577234f,
+    0.156342328f, 0.154120371f, 0.151911438f, 0.149715602f,
+    0.147532955f, 0.145363584f, 0.143207565f, 0.141064972f,
+    0.138935909f, 0.136820421f, 0.134718612f, 0.132630557f,
+    0.130556345f, 0.128496021f, 0.126449704f, 0.124417432f,
+    0.122399315f, 0.120395407f, 0.118405789f, 0.116430543f,
+    0.114469737f, 0.112523444f, 0.110591747f, 0.108674705f,
+    0.106772393f, 0.104884893f, 0.103012264f, 0.101154581f,
+    0.0993119106f, 0.0974843353f, 0.0956719071f, 0.0938747078f,
+    0.0920927972f, 0.0903262421f, 0.0885751098f, 0.0868394673f,
+    0.0851193815f, 0.0834149197f, 0.0817261338f, 0.0800531060f,
+    0.0783958808f, 0.0767545328f, 0.0751291141f, 0.0735196993f,
+    0.0719263330f, 0.0703490898f, 0.0687880218f, 0.0672431886f,
+    0.0657146499f, 0.0642024577f, 0.0627066717f, 0.0612273552f,
+    0.0597645566f, 0.0583183318f, 0.0568887368f, 0.0554758236f,
+    0.0540796444f, 0.0527002588f, 0.0513377078f, 0.0499920547f,
+    0.0486633405f, 0.0473516211f, 0.0460569412f, 0.0447793528f,
+    0.0435189046f, 0.0422756411f, 0.0410496108f, 0.0398408622f,
+    0.0386494361f, 0.0374753810f, 0.0363187380f, 0.0351795517f,
+    0.0340578668f, 0.0329537243f, 0.0318671651f, 0.0307982322f,
+    0.0297469646f, 0.0287134014f, 0.0276975818f, 0.0266995430f,
+    0.0257193241f, 0.0247569624f, 0.0238124933f, 0.0228859521f,
+    0.0219773743f, 0.0210867934f, 0.0202142429f, 0.0193597563f,
+    0.0185233671f, 0.0177051034f, 0.0169049986f, 0.0161230806f,
+    0.0153593821f, 0.0146139292f, 0.0138867516f, 0.0131778754f,
+    0.0124873277f, 0.0118151344f, 0.0111613208f, 0.0105259120f,
+    0.00990893226f, 0.00931040291f, 0.00873034913f, 0.00816879049f,
+    0.00762574887f, 0.00710124522f, 0.00659529911f, 0.00610792916f,
+    0.00563915400f, 0.00518899132f, 0.00475745788f, 0.00434456998f,
+    0.00395034347f, 0.00357479276f, 0.00321793230f, 0.00287977536f,
+    0.00256033451f, 0.00225962233f, 0.00197764952f, 0.00171442714f,
+    0.00146996486f, 0.00124427187f, 0.00103735691f, 0.000849227537f,
+    0.000679890916f, 0.000529353390f, 0.000397620694f, 0.000284697715f,
+    0.000190588748f, 0.000115297327f, 5.88262737e-05f, 2.11777242e-05f,
+};
+
+#ifdef NEWTAN
+const FLOAT twolame_psycho_4_cos_table[TRIGTABLESIZE] = {
+    1.00000000f, 0.999999881f, 0.999999523f, 0.999998868f,
+    0.999997973f, 0.999996901f, 0.999995530f, 0.999993861f,
+    0.999992013f, 0.999989867f, 0.999987483f, 0.999984860f,
+    0.999981999f, 0.999978900f, 0.999975502f, 0.999971867f,
+    0.999967992f, 0.999963880f, 0.999959528f, 0.999954879f,
+    0.999949992f, 0.999944866f, 0.999939501f, 0.999933898f,
+    0.999927998f, 0.999921858f, 0.999915481f, 0.999908864f,
+    0.999902010f, 0.999894857f, 0.999887526f, 0.999879897f,
+    0.999872029f, 0.999863863f, 0.999855518f, 0.999846876f,
+    0.999837995f, 0.999828875f, 0.999819517f, 0.999809861f,
+    0.999800026f, 0.999789894f, 0.999779522f, 0.999768913f,
+    0.999758005f, 0.999746859f, 0.999735534f, 0.999723911f,
+    0.999711990f, 0.999699891f, 0.999687493f, 0.999674916f,
+    0.999662042f, 0.999648869f, 0.999635518f, 0.999621928f,
+    0.999608040f, 0.999593914f, 0.999579549f, 0.999564886f,
+    0.999550045f, 0.999534905f, 0.999519527f, 0.999503911f,
+    0.999488056f, 0.999471903f, 0.999455571f, 0.999438941f,
+    0.999422073f, 0.999404907f, 0.999387562f, 0.999369919f,
+    0.999352098f, 0.999333978f, 0.999315560f, 0.999296963f,
+    0.999278069f, 0.999258995f, 0.999239624f, 0.999219954f,
+    0.999200106f, 0.999179959f, 0.999159634f, 0.999139011f,
+    0.999118149f, 0.999096990f, 0.999075651f, 0.999054015f,
+    0.999032140f, 0.999010026f, 0.998987675f, 0.998965025f,
+    0.998942196f, 0.998919070f, 0.998895705f, 0.998872101f,
+    0.998848200f, 0.998824120f, 0.998799741f, 0.998775125f,
+    0.998750269f, 0.998725116f, 0.998699784f, 0.998674154f,
+    0.998648286f, 0.998622179f, 0.998595834f, 0.998569191f,
+    0.998542368f, 0.998515248f, 0.998487890f, 0.998460293f,
+    0.998432398f, 0.998404324f, 0.998375952f, 0.998347342f,
+    0.998318493f, 0.998289347f, 0.998260021f, 0.998230398f,
+    0.998200536f, 0.998170435f, 0.998140097f, 0.998109460f,
+    0.998078644f, 0.998047531f, 0.998016179f, 0.997984529f,
+    0.997952700f, 0.997920573f, 0.997888267f, 0.997855663f,
+    0.997822762f, 0.997789681f, 0.997756362f, 0.997722745f,
+    0.997688890f, 0.997654796f, 0.997620463f, 0.997585833f,
+    0.997551024f, 0.997515917f, 0.997480571f, 0.997444987f,
+    0.997409105f, 0.997373044f, 0.997336686f, 0.997300088f,
+    0.997263253f, 0.997226179f, 0.997188807f, 0.997151256f,
+    0.997113407f, 0.997075319f, 0.997036994f, 0.996998370f,
+    0.996959567f, 0.996920466f, 0.996881127f, 0.996841550f,
+    0.996801734f, 0.996761620f, 0.996721268f, 0.996680737f,
+    0.996639907f, 0.996598780f, 0.996557474f, 0.996515930f,
+    0.996474087f, 0.996432006f, 0.996389687f, 0.996347129f,
+    0.996304274f, 0.996261179f, 0.996217906f, 0.996174335f,
+    0.996130526f, 0.996086419f, 0.996042132f, 0.995997548f,
+    0.995952725f, 0.995907664f, 0.995862365f, 0.995816767f,
+    0.995770991f, 0.995724916f, 0.995678604f, 0.995632052f,
+    0.995585263f, 0.995538175f, 0.995490909f, 0.995443344f,
+    0.995395541f, 0.995347500f, 0.995299160f, 0.995250642f,
+    0.995201826f, 0.995152771f, 0.995103478f, 0.995053947f,
+    0.995004177f, 0.994954109f, 0.994903862f, 0.994853318f,
+    0.994802535f, 0.994751453f, 0.994700193f, 0.994648635f,
+    0.994596899f, 0.994544864f, 0.994492590f, 0.994440019f,
+    0.994387269f, 0.994334221f, 0.994280934f, 0.994227409f,
+    0.994173646f, 0.994119644f, 0.994065404f, 0.994010866f,
+    0.993956089f, 0.993901074f, 0.993845820f, 0.993790329f,
+    0.993734539f, 0.993678570f, 0.993622303f, 0.993565798f,
+    0.993509054f, 0.993452013f, 0.993394792f, 0.993337274f,
+    0.993279517f, 0.993221521f, 0.993163288f, 0.993104815f,
+    0.993046045f, 0.992987096f, 0.992927849f, 0.992868364f,
+    0.992808640f, 0.992748678f, 0.992688417f, 0.992627978f,
+    0.992567241f, 0.992506266f, 0.992445052f, 0.992383540f,
+    0.992321849f, 0.992259860f, 0.992197692f, 0.992135227f,
+    0.992072523f, 0.992009521f, 0.991946340f, 0.991882861f,
+    0.991819203f, 0.991755247f, 0.991691053f, 0.991626561f,
+    0.991561890f, 0.991496980f, 0.991431773f, 0.991366327f,
+    0.991300642f, 0.991234720f, 0.991168559f, 0.991102099f,
+    0.991035402f, 0.990968525f, 0.990901351f, 0.990833938f,
+    0.990766227f, 0.990698338f, 0.990630150f, 0.990561783f,
+    0.990493119f, 0.990424216f, 0.990355015f, 0.990285635f,
+    0.990216017f, 0.990146101f, 0.990075946f, 0.990005553f,
+    0.989934921f, 0.989864051f, 0.989792883f, 0.989721537f,
+    0.989649892f, 0.989578009f, 0.989505887f, 0.989433527f,
+    0.989360929f, 0.989288032f, 0.989214957f, 0.989141583f,
+    0.989067972f, 0.988994122f, 0.988920033f, 0.988845646f,
+    0.988771081f, 0.988696218f, 0.988621116f, 0.988545835f,
+    0.988470197f, 0.988394380f, 0.988318324f, 0.988241971f,
+    0.988165438f, 0.988088608f, 0.988011539f, 0.987934232f,
+    0.987856686f, 0.987778842f, 0.987700820f, 0.987622499f,
+    0.987543941f, 0.987465143f, 0.987386107f, 0.987306833f,
+    0.987227261f, 0.987147510f, 0.987067461f, 0.986987174f,
+    0.986906648f, 0.986825883f, 0.986744881f, 0.986663640f,
+    0.986582100f, 0.986500382f, 0.986418366f, 0.986336112f,
+    0.986253619f, 0.986170888f, 0.986087859f, 0.986004651f,
+    0.985921144f, 0.985837460f, 0.985753477f, 0.985669255f,
+    0.985584795f, 0.985500038f, 0.985415101f, 0.985329866f,
+    0.985244453f, 0.985158741f, 0.985072792f, 0.984986603f,
+    0.984900177f, 0.984813452f, 0.984726548f, 0.984639347f,
+    0.984551966f, 0.984464288f, 0.984376371f, 0.984288216f,
+    0.984199762f, 0.984111130f, 0.984022260f, 0.983933091f,
+    0.983843684f, 0.983754039f, 0.983664155f, 0.983574033f,
+    0.983483672f, 0.983393073f, 0.983302176f, 0.983211040f,
+    0.983119726f, 0.983028114f, 0.982936263f, 0.982844174f,
+    0.982751787f, 0.982659221f, 0.982566416f, 0.982473314f,
+    0.982379973f, 0.982286394f, 0.982192576f, 0.982098520f,
+    0.982004225f, 0.981909692f, 0.981814861f, 0.981719851f,
+    0.981624544f, 0.981528997f, 0.981433213f, 0.981337190f,
+    0.981240928f, 0.981144428f, 0.981047690f, 0.980950654f,
+    0.980853438f, 0.980755925f, 0.980658174f, 0.980560184f,
+    0.980461955f, 0.980363488f, 0.980264783f, 0.980165780f,
+    0.980066597f, 0.979967117f, 0.979867399f, 0.979767442f,
+    0.979667306f, 0.979566872f, 0.979466140f, 0.979365230f,
+    0.979264081f, 0.979162633f, 0.979061007f, 0.978959084f,
+    0.978856921f, 0.978754520f, 0.978651881f, 0.978549004f,
+    0.978445888f, 0.978342533f, 0.978238881f, 0.978135049f,
+    0.978030920f, 0.977926552f, 0.977821946f, 0.977717102f,
+    0.977612019f, 0.977506697f, 0.977401137f, 0.977295339f,
+    0.977189243f, 0.977082968f, 0.976976395f, 0.976869583f,
+    0.976762533f, 0.976655245f, 0.976547718f, 0.976439953f,
+    0.976331949f, 0.976223707f, 0.976115167f, 0.976006448f,
+    0.975897431f, 0.975788236f, 0.975678742f, 0.975569010f,
+    0.975459039f, 0.975348830f, 0.975238383f, 0.975127697f,
+    0.975016713f, 0.974905550f, 0.974794090f, 0.974682450f,
+    0.974570513f, 0.974458337f, 0.974345922f, 0.974233270f,
+    0.974120378f, 0.974007249f, 0.973893881f, 0.973780274f,
+    0.973666370f, 0.973552287f, 0.973437905f, 0.973323345f,
+    0.973208487f, 0.973093390f, 0.972978055f, 0.972862482f,
+    0.972746670f, 0.972630620f, 0.972514331f, 0.972397804f,
+    0.972281039f, 0.972163975f, 0.972046733f, 0.971929193f,
+    0.971811414f, 0.971693456f, 0.971575201f, 0.971456707f,
+    0.971337974f, 0.971219003f, 0.971099794f, 0.970980346f,
+    0.970860600f, 0.970740676f, 0.970620513f, 0.970500052f,
+    0.970379412f, 0.970258474f, 0.970137298f, 0.970015943f,
+    0.969894290f, 0.969772398f, 0.969650269f, 0.969527900f,
+    0.969405293f, 0.969282448f, 0.969159365f, 0.969035983f,
+    0.968912423f, 0.968788624f, 0.968664527f, 0.968540251f,
+    0.968415678f, 0.968290865f, 0.968165874f, 0.968040586f,
+    0.967915058f, 0.967789292f, 0.967663288f, 0.967537045f,
+    0.967410564f, 0.967283845f, 0.967156887f, 0.967029631f,
+    0.966902196f, 0.966774523f, 0.966646552f, 0.966518402f,
+    0.966389954f, 0.966261327f, 0.966132402f, 0.966003299f,
+    0.965873897f, 0.965744257f, 0.965614378f, 0.965484262f,
+    0.965353906f, 0.965223312f, 0.965092480f, 0.964961410f,
+    0.964830101f, 0.964698553f, 0.964566767f, 0.964434683f,
+    0.964302421f, 0.964169919f, 0.964037120f, 0.963904142f,
+    0.963770926f, 0.963637412f, 0.963503659f, 0.963369727f,
+    0.963235497f, 0.963101029f, 0.962966383f, 0.962831438f,
+    0.962696254f, 0.962560833f, 0.962425172f, 0.962289333f,
+    0.962153196f, 0.962016821f, 0.961880207f, 0.961743295f,
+    0.961606205f, 0.961468875f, 0.961331308f, 0.961193502f,
+    0.961055458f, 0.960917115f, 0.960778594f, 0.960639834f,
+    0.960500777f, 0.960361540f, 0.960222065f, 0.960082293f,
+    0.959942341f, 0.959802091f, 0.959661663f, 0.959520936f,
+    0.959380031f, 0.959238827f, 0.959097445f, 0.958955765f,
+    0.958813846f, 0.958671749f, 0.958529353f, 0.958386719f,
+    0.958243847f, 0.958100796f, 0.957957447f, 0.957813859f,
+    0.957670033f, 0.957526028f, 0.957381725f, 0.957237184f,
+    0.957092404f, 0.956947386f, 0.956802130f, 0.956656635f,
+    0.956510901f, 0.956364930f, 0.956218779f, 0.956072330f,
+    0.955925643f, 0.955778718f, 0.955631554f, 0.955484152f,
+    0.955336511f, 0.955188632f, 0.955040514f, 0.954892159f,
+    0.954743564f, 0.954594731f, 0.954445660f, 0.954296291f,
+    0.954146743f, 0.953996956f, 0.953846931f, 0.953696668f,
+    0.953546166f, 0.953395426f, 0.953244448f, 0.953093231f,
+    0.952941775f, 0.952790082f, 0.952638149f, 0.952485979f,
+    0.952333570f, 0.952180922f, 0.952028036f, 0.951874912f,
+    0.951721549f, 0.951567948f, 0.951414108f, 0.951260030f,
+    0.951105714f, 0.950951159f, 0.950796366f, 0.950641334f,
+    0.950486064f, 0.950330555f, 0.950174868f, 0.950018883f,
+    0.949862659f, 0.949706197f, 0.949549496f, 0.949392557f,
+    0.949235439f, 0.949078023f, 0.948920369f, 0.948762476f,
+    0.948604405f, 0.948446035f, 0.948287427f, 0.948128641f,
+    0.947969556f, 0.947810233f, 0.947650731f, 0.947490931f,
+    0.947330952f, 0.947170675f, 0.947010219f, 0.946849465f,
+    0.946688533f, 0.946527362f, 0.946365893f, 0.946204245f,
+    0.946042359f, 0.945880175f, 0.945717812f, 0.945555210f,
+    0.945392370f, 0.945229292f, 0.945065975f, 0.944902420f,
+    0.944738626f, 0.944574594f, 0.944410324f, 0.944245815f,
+    0.944081068f, 0.943916082f, 0.943750858f, 0.943585455f,
+    0.943419755f, 0.943253815f, 0.943087697f, 0.942921281f,
+    0.942754686f, 0.942587793f, 0.942420721f, 0.942253351f,
+    0.942085803f, 0.941918015f, 0.941749990f, 0.941581666f,
+    0.941413164f, 0.941244423f, 0.941075444f, 0.940906227f,
+    0.940736771f, 0.940567076f, 0.940397203f, 0.940227032f,
+    0.940056622f, 0.939885974f, 0.939715147f, 0.939544022f,
+    0.939372718f, 0.939201176f, 0.939029336f, 0.938857317f,
+    0.938685060f, 0.938512504f, 0.938339770f, 0.938166797f,
+    0.937993586f, 0.937820196f, 0.937646508f, 0.937472582f,
+    0.937298417f, 0.937124074f, 0.936949432f, 0.936774611f,
+    0.936599493f, 0.936424196f, 0.936248600f, 0.936072826f,
+    0.935896814f, 0.935720563f, 0.935544074f, 0.935367346f,
+    0.935190380f, 0.935013235f, 0.934835792f, 0.934658110f,
+    0.934480250f, 0.934302092f, 0.934123755f, 0.933945179f,
+    0.933766365f, 0.933587313f, 0.933408022f, 0.933228493f,
+    0.933048725f, 0.932868719f, 0.932688475f, 0.932508051f,
+    0.932327330f, 0.932146430f, 0.931965292f, 0.931783855f,
+    0.931602240f, 0.931420386f, 0.931238294f, 0.931055963f,
+    0.930873454f, 0.930690646f, 0.930507600f, 0.930324376f,
+    0.930140913f, 0.929957151f, 0.929773211f, 0.929589033f,
+    0.929404616f, 0.929219961f, 0.929035068f, 0.928849995f,
+    0.928664625f, 0.928479075f, 0.928293228f, 0.928107202f,
+    0.927920938f, 0.927734435f, 0.927547693f, 0.927360713f,
+    0.927173555f, 0.926986098f, 0.926798403f, 0.926610529f,
+    0.926422417f, 0.926234066f, 0.926045477f, 0.925856650f,
+    0.925667584f, 0.925478280f, 0.925288796f, 0.925099015f,
+    0.924909055f, 0.924718857f, 0.924528420f, 0.924337745f,
+    0.924146831f, 0.923955679f, 0.923764348f, 0.923572719f,
+    0.923380911f, 0.923188865f, 0.922996581f, 0.922804058f,
+    0.922611296f, 0.922418296f, 0.922225118f, 0.922031641f,
+    0.921837986f, 0.921644092f, 0.921449959f, 0.921255589f,
+    0.921060979f, 0.920866191f, 0.920671105f, 0.920475841f,
+    0.920280337f, 0.920084596f, 0.919888616f, 0.919692397f,
+    0.919495940f, 0.919299304f, 0.919102371f, 0.918905258f,
+    0.918707907f, 0.918510318f, 0.918312550f, 0.918114483f,
+    0.917916179f, 0.917717695f, 0.917518973f, 0.917320013f,
+    0.917120814f, 0.916921377f, 0.916721761f, 0.916521907f,
+    0.916321754f, 0.916121423f, 0.915920854f, 0.915720105f,
+    0.915519059f, 0.915317774f, 0.915116310f, 0.914914608f,
+    0.914712667f, 0.914510489f, 0.914308131f, 0.914105475f,
+    0.913902640f, 0.913699567f, 0.913496256f, 0.913292706f,
+    0.913088918f, 0.912884951f, 0.912680745f, 0.912476301f,
+    0.912271619f, 0.912066698f, 0.911861539f, 0.911656201f,
+    0.911450624f, 0.911244750f, 0.911038756f, 0.910832465f,
+    0.910625935f, 0.910419226f, 0.910212278f, 0.910005093f,
+    0.909797668f, 0.909590006f, 0.909382164f, 0.909174085f,
+    0.908965766f, 0.908757210f, 0.908548415f, 0.908339441f,
+    0.908130169f, 0.907920718f, 0.907711029f, 0.907501161f,
+    0.907290995f, 0.907080650f, 0.906870067f, 0.906659245f,
+    0.906448185f, 0.906236887f, 0.906025410f, 0.905813694f,
+    0.905601740f, 0.905389547f, 0.905177176f, 0.904964507f,
+    0.904751658f, 0.904538572f, 0.904325247f, 0.904111743f,
+    0.903898001f, 0.903683960f, 0.903469801f, 0.903255343f,
+    0.903040648f, 0.902825773f, 0.902610660f, 0.902395308f,
+    0.902179778f, 0.901963949f, 0.901747942f, 0.901531696f,
+    0.901315212f, 0.901098549f, 0.900881588f, 0.900664449f,
+    0.900447130f, 0.900229514f, 0.900011659f, 0.899793625f,
+    0.899575353f, 0.899356902f, 0.899138153f, 0.898919225f,
+    0.898700058f, 0.898480654f, 0.898261011f, 0.898041189f,
+    0.897821128f, 0.897600830f, 0.897380292f, 0.897159576f,
+    0.896938622f, 0.896717429f, 0.896495998f, 0.896274388f,
+    0.896052480f, 0.895830393f, 0.895608127f, 0.895385563f,
+    0.895162821f, 0.894939840f, 0.894716620f, 0.894493222f,
+    0.894269526f, 0.894045651f, 0.893821537f, 0.893597245f,
+    0.893372715f, 0.893147945f, 0.892922938f, 0.892697692f,
+    0.892472267f, 0.892246604f, 0.892020702f, 0.891794622f,
+    0.891568303f, 0.891341746f, 0.891114950f, 0.890887976f,
+    0.890660763f, 0.890433311f, 0.890205622f, 0.889977753f,
+    0.889749587f, 0.889521301f, 0.889292717f, 0.889063954f,
+    0.888834953f, 0.888605714f, 0.888376296f, 0.888146579f,
+    0.887916684f, 0.887686610f, 0.887456238f, 0.887225688f,
+    0.886994898f, 0.886763930f, 0.886532724f, 0.886301279f,
+    0.886069596f, 0.885837734f, 0.885605574f, 0.885373294f,
+    0.885140717f, 0.884907961f, 0.884674966f, 0.884441733f,
+    0.884208322f, 0.883974671f, 0.883740783f, 0.883506656f,
+    0.883272350f, 0.883037806f, 0.882803023f, 0.882568061f,
+    0.882332861f, 0.882097423f, 0.881861806f, 0.881625950f,
+    0.881389856f, 0.881153524f, 0.880917013f, 0.880680263f,
+    0.880443275f, 0.880206108f, 0.879968703f, 0.879731059f,
+    0.879493237f, 0.879255176f, 0.879016876f, 0.878778398f,
+    0.878539681f, 0.878300726f, 0.878061533f, 0.877822161f,
+    0.877582550f, 0.877342761f, 0.877102673f, 0.876862466f,
+    0.876621962f, 0.876381278f, 0.876140356f, 0.875899196f,
+    0.875657856f, 0.875416279f, 0.875174463f, 0.874932468f,
+    0.874690235f, 0.874447763f, 0.874205112f, 0.873962224f,
+    0.873719096f, 0.873475790f, 0.873232245f, 0.872988462f,
+    0.872744501f, 0.872500300f, 0.872255921f, 0.872011244f,
+    0.871766388f, 0.871521354f, 0.871276021f, 0.871030569f,
+    0.870784819f, 0.870538890f, 0.870292723f, 0.870046318f,
+    0.869799733f, 0.869552970f, 0.869305909f, 0.869058669f,
+    0.868811190f, 0.868563533f, 0.868315637f, 0.868067503f,
+    0.867819190f, 0.867570639f, 0.867321849f, 0.867072880f,
+    0.866823673f, 0.866574287f, 0.866324663f, 0.866074800f,
+    0.865824699f, 0.865574419f, 0.865323961f, 0.865073204f,
+    0.864822268f, 0.864571154f, 0.864319801f, 0.864068210f,
+    0.863816440f, 0.863564372f, 0.863312185f, 0.863059700f,
+    0.862807095f, 0.862554193f, 0.862301111f, 0.862047791f,
+    0.861794293f, 0.861540556f, 0.861286581f, 0.861032426f,
+    0.860778034f, 0.860523462f, 0.860268652f, 0.860013604f,
+    0.859758377f, 0.859502912f, 0.859247208f, 0.858991325f,
+    0.858735263f, 0.858478904f, 0.858222365f, 0.857965648f,
+    0.857708693f, 0.857451499f, 0.857194126f, 0.856936514f,
+    0.856678724f, 0.856420636f, 0.856162429f, 0.855903983f,
+    0.855645299f, 0.855386376f, 0.855127275f, 0.854867995f,
+    0.854608417f, 0.854348719f, 0.854088724f, 0.853828549f,
+    0.853568196f, 0.853307605f, 0.853046775f, 0.852785766f,
+    0.852524519f, 0.852263093f, 0.852001429f, 0.851739526f,
+    0.851477444f, 0.851215124f, 0.850952625f, 0.850689888f,
+    0.850426972f, 0.850163817f, 0.849900424f, 0.849636853f,
+    0.849373043f, 0.849109054f, 0.848844826f, 0.848580420f,
+    0.848315775f, 0.848050952f, 0.847785890f, 0.847520590f,
+    0.847255111f, 0.846989393f, 0.846723497f, 0.846457362f,
+    0.846191049f, 0.845924497f, 0.845657766f, 0.845390797f,
+    0.845123589f, 0.844856203f, 0.844588578f, 0.844320774f,
+    0.844052792f, 0.843784511f, 0.843516052f, 0.843247414f,
+    0.842978537f, 0.842709482f, 0.842440188f, 0.842170715f,
+    0.841901004f, 0.841631055f, 0.841360927f, 0.841090560f,
+    0.840820014f, 0.840549290f, 0.840278268f, 0.840007126f,
+    0.839735746f, 0.839464128f, 0.839192331f, 0.838920295f,
+    0.838648021f, 0.838375628f, 0.838102937f, 0.837830067f,
+    0.837557018f, 0.837283731f, 0.837010264f, 0.836736560f,
+    0.836462677f, 0.836188555f, 0.835914195f, 0.835639656f,
+    0.835364938f, 0.835089982f, 0.834814787f, 0.834539473f,
+    0.834263861f, 0.833988070f, 0.833712101f, 0.833435893f,
+    0.833159447f, 0.832882822f, 0.832606018f, 0.832328975f,
+    0.832051754f, 0.831774294f, 0.831496596f, 0.831218779f,
+    0.830940664f, 0.830662370f, 0.830383897f, 0.830105186f,
+    0.829826295f, 0.829547167f, 0.829267859f, 0.828988314f,
+    0.828708589f, 0.828428626f, 0.828148484f, 0.827868164f,
+    0.827587605f, 0.827306807f, 0.827025831f, 0.826744616f,
+    0.826463223f, 0.826181650f, 0.825899839f, 0.825617850f,
+    0.825335622f, 0.825053215f, 0.824770570f, 0.824487746f,
+    0.824204683f, 0.823921442f, 0.823637962f, 0.823354304f,
+    0.823070467f, 0.822786391f, 0.822502077f, 0.822217643f,
+    0.821932912f, 0.821648002f, 0.821362913f, 0.821077645f,
+    0.820792139f, 0.820506394f, 0.820220470f, 0.819934368f,
+    0.819648027f, 0.819361508f, 0.819074750f, 0.818787813f,
+    0.818500638f, 0.818213284f, 0.817925751f, 0.817637980f,
+    0.817349970f, 0.817061841f, 0.816773474f, 0.816484869f,
+    0.816196084f, 0.815907061f, 0.815617919f, 0.815328479f,
+    0.815038919f, 0.814749122f, 0.814459085f, 0.814168870f,
+    0.813878477f, 0.813587844f, 0.813297033f, 0.813005984f,
+    0.812714756f, 0.812423348f, 0.812131703f, 0.811839879f,
+    0.811547816f, 0.811255574f, 0.810963094f, 0.810670495f,
+    0.810377598f, 0.810084581f, 0.809791327f, 0.809497833f,
+    0.809204161f, 0.808910310f, 0.808616221f, 0.808321953f,
+    0.808027506f, 0.807732821f, 0.807437956f, 0.807142854f,
+    0.806847632f, 0.806552112f, 0.806256413f, 0.805960536f,
+    0.805664480f, 0.805368185f, 0.805071712f, 0.804775000f,
+    0.804478109f, 0.804181039f, 0.803883731f, 0.803586245f,
+    0.803288519f, 0.802990675f, 0.802692533f, 0.802394271f,
+    0.802095771f, 0.801797032f, 0.801498175f, 0.801199079f,
+    0.800899744f, 0.800600290f, 0.800300539f, 0.800000668f,
+    0.799700558f, 0.799400270f, 0.799099743f, 0.798799098f,
+    0.798498154f, 0.798197091f, 0.797895789f, 0.797594249f,
+    0.797292590f, 0.796990693f, 0.796688616f, 0.796386302f,
+    0.796083808f, 0.795781136f, 0.795478225f, 0.795175135f,
+    0.794871807f, 0.794568360f, 0.794264674f, 0.793960750f,
+    0.793656707f, 0.793352425f, 0.793047905f, 0.792743266f,
+    0.792438388f, 0.792133272f, 0.791828036f, 0.791522563f,
+    0.791216910f, 0.790911019f, 0.790604949f, 0.790298700f,
+    0.789992213f, 0.789685547f, 0.789378703f, 0.789071679f,
+    0.788764417f, 0.788456976f, 0.788149357f, 0.787841499f,
+    0.787533462f, 0.787225187f, 0.786916792f, 0.786608160f,
+    0.786299348f, 0.785990298f, 0.785681069f, 0.785371661f,
+    0.785062075f, 0.784752250f, 0.784442246f, 0.784132063f,
+    0.783821642f, 0.783511102f, 0.783200264f, 0.782889307f,
+    0.782578111f, 0.782266736f, 0.781955183f, 0.781643391f,
+    0.781331480f, 0.781019330f, 0.780706942f, 0.780394375f,
+    0.780081689f, 0.779768705f, 0.779455602f, 0.779142261f,
+    0.778828740f, 0.778515041f, 0.778201103f, 0.777887046f,
+    0.777572691f, 0.777258217f, 0.776943564f, 0.776628673f,
+    0.776313603f, 0.775998294f, 0.775682867f, 0.775367200f,
+    0.775051355f, 0.774735272f, 0.774419069f, 0.774102628f,
+    0.773786008f, 0.773469150f, 0.773152173f, 0.772834957f,
+    0.772517562f, 0.772199929f, 0.771882176f, 0.771564186f,
+    0.771246016f, 0.770927668f, 0.770609081f, 0.770290315f,
+    0.769971371f, 0.769652247f, 0.769332945f, 0.769013405f,
+    0.768693686f, 0.768373787f, 0.768053710f, 0.767733395f,
+    0.767412961f, 0.767092288f, 0.766771376f, 0.766450346f,
+    0.766129076f, 0.765807629f, 0.765486002f, 0.765164196f,
+    0.764842212f, 0.764519989f, 0.764197588f, 0.763875008f,
+    0.763552248f, 0.763229251f, 0.762906075f, 0.762582719f,
+    0.762259185f, 0.761935472f, 0.761611581f, 0.761287451f,
+    0.760963142f, 0.760638654f, 0.760313988f, 0.759989083f,
+    0.759663999f, 0.759338796f, 0.759013355f, 0.758687675f,
+    0.758361876f, 0.758035839f, 0.757709682f, 0.757383287f,
+    0.757056713f, 0.756729901f, 0.756402969f, 0.756075799f,
+    0.755748510f, 0.755420983f, 0.755093217f, 0.754765332f,
+    0.754437268f, 0.754108965f, 0.753780484f, 0.753451824f,
+    0.753122985f, 0.752793968f, 0.752464712f, 0.752135336f,
+    0.751805723f, 0.751475930f, 0.751145959f, 0.750815809f,
+    0.750485480f, 0.750154912f, 0.749824166f, 0.749493301f,
+    0.749162197f, 0.748830914f, 0.748499393f, 0.748167753f,
+    0.747835934f, 0.747503877f, 0.747171640f, 0.746839225f,
+    0.746506631f, 0.746173859f, 0.745840907f, 0.745507717f,
+    0.745174408f, 0.744840860f, 0.744507134f, 0.744173288f,
+    0.743839145f, 0.743504882f, 0.743170440f, 0.742835820f,
+    0.742500961f, 0.742165983f, 0.741830766f, 0.741495371f,
+    0.741159797f, 0.740824044f, 0.740488112f, 0.740151942f,
+    0.739815652f, 0.739479184f, 0.739142478f, 0.738805592f,
+    0.738468587f, 0.738131344f, 0.737793922f, 0.737456322f,
+    0.737118483f, 0.736780524f, 0.736442387f, 0.736104012f,
+    0.735765517f, 0.735426784f, 0.735087931f, 0.734748840f,
+    0.734409571f, 0.734070122f, 0.733730495f, 0.733390689f,
+    0.733050704f, 0.732710481f, 0.732370138f, 0.732029617f,
+    0.731688857f, 0.731347978f, 0.731006861f, 0.730665565f,
+    0.730324149f, 0.729982495f, 0.729640663f, 0.729298651f,
+    0.728956461f, 0.728614092f, 0.728271544f, 0.727928817f,
+    0.727585912f, 0.727242768f, 0.726899505f, 0.726556063f,
+    0.726212382f, 0.725868583f, 0.725524545f, 0.725180387f,
+    0.724835992f, 0.724491477f, 0.724146724f, 0.723801792f,
+    0.723456740f, 0.723111451f, 0.722765982f, 0.722420335f,
+    0.722074509f, 0.721728563f, 0.721382380f, 0.721036017f,
+    0.720689476f, 0.720342755f, 0.719995856f, 0.719648778f,
+    0.719301522f, 0.718954086f, 0.718606472f, 0.718258619f,
+    0.717910647f, 0.717562497f, 0.717214167f, 0.716865659f,
+    0.716516972f, 0.716168106f, 0.715819061f, 0.715469778f,
+    0.715120375f, 0.714770794f, 0.714421034f, 0.714071095f,
+    0.713720977f, 0.713370681f, 0.713020146f, 0.712669492f,
+    0.712318659f, 0.711967647f, 0.711616457f, 0.711265087f,
+    0.710913539f, 0.710561812f, 0.710209906f, 0.709857821f,
+    0.709505558f, 0.709153116f, 0.708800495f, 0.708447695f,
+    0.708094716f, 0.707741618f, 0.707388282f, 0.707034767f,
+    0.706681073f, 0.706327260f, 0.705973208f, 0.705618978f,
+    0.705264628f, 0.704910040f, 0.704555333f, 0.704200387f,
+    0.703845322f, 0.703490078f, 0.703134596f, 0.702778995f,
+    0.702423215f, 0.702067256f, 0.701711118f, 0.701354802f,
+    0.700998306f, 0.700641632f, 0.700284779f, 0.699927747f,
+    0.699570537f, 0.699213207f, 0.698855639f, 0.698497891f,
+    0.698140025f, 0.697781980f, 0.697423697f, 0.697065294f,
+    0.696706712f, 0.696347952f, 0.695989013f, 0.695629895f,
+    0.695270598f, 0.694911122f, 0.694551528f, 0.694191694f,
+    0.693831742f, 0.693471551f, 0.693111241f, 0.692750752f,
+    0.692390084f, 0.692029238f, 0.691668212f, 0.691307008f,
+    0.690945625f, 0.690584064f, 0.690222383f, 0.689860463f,
+    0.689498425f, 0.689136207f, 0.688773811f, 0.688411236f,
+    0.688048482f, 0.687685549f, 0.687322497f, 0.686959207f,
+    0.686595798f, 0.686232150f, 0.685868382f, 0.685504436f,
+    0.685140312f, 0.684776008f, 0.684411585f, 0.684046924f,
+    0.683682144f, 0.683317184f, 0.682951987f, 0.682586670f,
+    0.682221234f, 0.681855559f, 0.681489706f, 0.681123734f,
+    0.680757523f, 0.680391192f, 0.680024683f, 0.679657996f,
+    0.679291189f, 0.678924143f, 0.678556979f, 0.678189635f,
+    0.677822053f, 0.677454352f, 0.677086532f, 0.676718473f,
+    0.676350296f, 0.675981879f, 0.675613344f, 0.675244629f,
+    0.674875736f, 0.674506724f, 0.674137473f, 0.673768103f,
+    0.673398554f, 0.673028827f, 0.672658920f, 0.672288895f,
+    0.671918631f, 0.671548247f, 0.671177685f, 0.670806944f,
+    0.670436025f, 0.670064986f, 0.669693768f, 0.669322371f,
+    0.668950796f, 0.668579042f, 0.668207109f, 0.667835057f,
+    0.667462826f, 0.667090416f, 0.666717827f, 0.666345119f,
+    0.665972233f, 0.665599108f, 0.665225923f, 0.664852500f,
+    0.664478898f, 0.664105177f, 0.663731277f, 0.663357198f,
+    0.662983000f, 0.662608564f, 0.662234008f, 0.661859274f,
+    0.661484361f, 0.661109328f, 0.660734117f, 0.660358727f,
+    0.659983158f, 0.659607410f, 0.659231544f, 0.658855498f,
+    0.658479273f, 0.658102870f, 0.657726347f, 0.657349646f,
+    0.656972766f, 0.656595707f, 0.656218529f, 0.655841172f,
+    0.655463636f, 0.655085921f, 0.654708028f, 0.654330015f,
+    0.653951824f, 0.653573513f, 0.653194964f, 0.652816296f,
+    0.652437449f, 0.652058482f, 0.651679277f, 0.651299953f,
+    0.650920451f, 0.650540829f, 0.650161028f, 0.649781048f,
+    0.649400890f, 0.649020553f, 0.648640096f, 0.648259461f,
+    0.647878706f, 0.647497773f, 0.647116601f, 0.646735370f,
+    0.646353900f, 0.645972311f, 0.645590544f, 0.645208657f,
+    0.644826531f, 0.644444287f, 0.644061923f, 0.643679321f,
+    0.643296599f, 0.642913699f, 0.642530680f, 0.642147481f,
+    0.641764104f, 0.641380548f, 0.640996873f, 0.640613019f,
+    0.640228987f, 0.639844835f, 0.639460504f, 0.639075994f,
+    0.638691366f, 0.638306558f, 0.637921572f, 0.637536407f,
+    0.637151122f, 0.636765718f, 0.636380076f, 0.635994315f,
+    0.635608375f, 0.635222316f, 0.634836078f, 0.634449661f,
+    0.634063125f, 0.633676350f, 0.633289516f, 0.632902443f,
+    0.632515252f, 0.632127941f, 0.631740391f, 0.631352723f,
+    0.630964935f, 0.630576909f, 0.630188763f, 0.629800498f,
+    0.629412055f, 0.629023433f, 0.628634632f, 0.628245711f,
+    0.627856612f, 0.627467394f, 0.627077997f, 0.626688421f,
+    0.626298726f, 0.625908852f, 0.625518799f, 0.625128627f,
+    0.624738276f, 0.624347806f, 0.623957157f, 0.623566329f,
+    0.623175383f, 0.622784257f, 0.622393012f, 0.622001529f,
+    0.621609986f, 0.621218204f, 0.620826304f, 0.620434284f,
+    0.620042086f, 0.619649708f, 0.619257212f, 0.618864536f,
+    0.618471682f, 0.618078709f, 0.617685556f, 0.617292285f,
+    0.616898835f, 0.616505265f, 0.616111517f, 0.615717590f,
+    0.615323544f, 0.614929318f, 0.614534974f, 0.614140451f,
+    0.613745749f, 0.613350928f, 0.612955928f, 0.612560809f,
+    0.612165511f, 0.611770093f, 0.611374497f, 0.610978723f,
+    0.610582829f, 0.610186756f, 0.609790564f, 0.609394193f,
+    0.608997703f, 0.608601034f, 0.608204246f, 0.607807279f,
+    0.607410133f, 0.607012868f, 0.606615484f, 0.606217861f,
+    0.605820179f, 0.605422258f, 0.605024278f, 0.604626060f,
+    0.604227722f, 0.603829265f, 0.603430629f, 0.603031874f,
+    0.602632940f, 0.602233827f, 0.601834595f, 0.601435184f,
+    0.601035655f, 0.600636005f, 0.600236177f, 0.599836171f,
+    0.599436045f, 0.599035740f, 0.598635316f, 0.598234713f,
+    0.597833991f, 0.597433090f, 0.597032070f, 0.596630871f,
+    0.596229553f, 0.595828056f, 0.595426440f, 0.595024645f,
+    0.594622731f, 0.594220638f, 0.593818426f, 0.593416035f,
+    0.593013525f, 0.592610836f, 0.592208028f, 0.591805100f,
+    0.591401935f, 0.590998709f, 0.590595305f, 0.590191722f,
+    0.589788020f, 0.589384198f, 0.588980198f, 0.588576019f,
+    0.588171721f, 0.587767303f, 0.587362707f, 0.586957991f,
+    0.586553097f, 0.586148083f, 0.585742891f, 0.585337579f,
+    0.584932089f, 0.584526479f, 0.584120691f, 0.583714783f,
+    0.583308756f, 0.582902551f, 0.582496226f, 0.582089722f,
+    0.581683099f, 0.581276298f, 0.580869377f, 0.580462337f,
+    0.580055118f, 0.579647720f, 0.579240203f, 0.578832567f,
+    0.578424811f, 0.578016818f, 0.577608764f, 0.577200532f,
+    0.576792181f, 0.576383650f, 0.575975001f, 0.575566173f,
+    0.575157225f, 0.574748099f, 0.574338913f, 0.573929489f,
+    0.573520005f, 0.573110342f, 0.572700500f, 0.572290540f,
+    0.571880460f, 0.571470201f, 0.571059823f, 0.570649326f,
+    0.570238650f, 0.569827855f, 0.569416881f, 0.569005787f,
+    0.568594515f, 0.568183184f, 0.567771614f, 0.567359984f,
+    0.566948175f, 0.566536248f, 0.566124141f, 0.565711915f,
+    0.565299511f, 0.564887047f, 0.564474344f, 0.564061582f,
+    0.563648641f, 0.563235581f, 0.562822342f, 0.562408984f,
+    0.561995447f, 0.561581850f, 0.561168075f, 0.560754120f,
+    0.560340047f, 0.559925854f, 0.559511542f, 0.559097052f,
+    0.558682442f, 0.558267653f, 0.557852745f, 0.557437718f,
+    0.557022572f, 0.556607246f, 0.556191742f, 0.555776179f,
+    0.555360436f, 0.554944575f, 0.554528534f, 0.554112375f,
+    0.553696096f, 0.553279698f, 0.552863121f, 0.552446425f,
+    0.552029550f, 0.551612556f, 0.551195443f, 0.550778210f,
+    0.550360799f, 0.549943268f, 0.549525619f, 0.549107790f,
+    0.548689842f, 0.548271775f, 0.547853589f, 0.547435224f,
+    0.547016740f, 0.546598077f, 0.546179295f, 0.545760393f,
+    0.545341372f, 0.544922173f, 0.544502914f, 0.544083416f,
+    0.543663859f, 0.543244123f, 0.542824268f, 0.542404294f,
+    0.541984141f, 0.541563928f, 0.541143477f, 0.540722966f,
+    0.540302277f, 0.539881527f, 0.539460540f, 0.539039493f,
+    0.538618267f, 0.538196921f, 0.537775457f, 0.537353873f,
+    0.536932111f, 0.536510229f, 0.536088228f, 0.535666049f,
+    0.535243809f, 0.534821391f, 0.534398794f, 0.533976138f,
+    0.533553302f, 0.533130348f, 0.532707274f, 0.532284081f,
+    0.531860709f, 0.531437218f, 0.531013608f, 0.530589879f,
+    0.530165970f, 0.529742002f, 0.529317856f, 0.528893530f,
+    0.528469145f, 0.528044581f, 0.527619958f, 0.527195096f,
+    0.526770175f, 0.526345134f, 0.525919914f, 0.525494576f,
+    0.525069118f, 0.524643540f, 0.524217784f, 0.523791969f,
+    0.523365974f, 0.522939861f, 0.522513568f, 0.522087216f,
+    0.521660686f, 0.521234035f, 0.520807266f, 0.520380378f,
+    0.519953370f, 0.519526184f, 0.519098878f, 0.518671453f,
+    0.518243909f, 0.517816246f, 0.517388403f, 0.516960502f,
+    0.516532421f, 0.516104221f, 0.515675902f, 0.515247405f,
+    0.514818847f, 0.514390111f, 0.513961315f, 0.513532341f,
+    0.513103247f, 0.512673974f, 0.512244642f, 0.511815131f,
+    0.511385560f, 0.510955811f, 0.510525942f, 0.510095954f,
+    0.509665787f, 0.509235561f, 0.508805215f, 0.508374691f,
+    0.507944047f, 0.507513285f, 0.507082403f, 0.506651402f,
+    0.506220281f, 0.505788982f, 0.505357623f, 0.504926085f,
+    0.504494429f, 0.504062653f, 0.503630757f, 0.503198743f,
+    0.502766609f, 0.502334297f, 0.501901925f, 0.501469374f,
+    0.501036763f, 0.500603974f, 0.500171065f, 0.499738038f,
+    0.499304891f, 0.498871624f, 0.498438209f, 0.498004705f,
+    0.497571051f, 0.497137278f, 0.496703386f, 0.496269345f,
+    0.495835215f, 0.495400935f, 0.494966537f, 0.494532019f,
+    0.494097382f, 0.493662626f, 0.493227720f, 0.492792726f,
+    0.492357582f, 0.491922319f, 0.491486937f, 0.491051435f,
+    0.490615815f, 0.490180075f, 0.489744186f, 0.489308208f,
+    0.488872081f, 0.488435835f, 0.487999469f, 0.487563014f,
+    0.487126380f, 0.486689657f, 0.486252815f, 0.485815853f,
+    0.485378772f, 0.484941542f, 0.484504223f, 0.484066755f,
+    0.483629167f, 0.483191490f, 0.482753664f, 0.482315719f,
+    0.481877655f, 0.481439501f, 0.481001198f, 0.480562776f,
+    0.480124235f, 0.479685575f, 0.479246795f, 0.478807896f,
+    0.478368878f, 0.477929741f, 0.477490485f, 0.477051079f,
+    0.476611584f, 0.476171970f, 0.475732237f, 0.475292385f,
+    0.474852413f, 0.474412322f, 0.473972112f, 0.473531783f,
+    0.473091334f, 0.472650766f, 0.472210079f, 0.471769273f,
+    0.471328378f, 0.470887333f, 0.470446169f, 0.470004886f,
+    0.469563514f, 0.469121993f, 0.468680382f, 0.468238622f,
+    0.467796773f, 0.467354804f, 0.466912717f, 0.466470480f,
+    0.466028154f, 0.465585709f, 0.465143174f, 0.464700490f,
+    0.464257687f, 0.463814795f, 0.463371754f, 0.462928623f,
+    0.462485373f, 0.462042004f, 0.461598516f, 0.461154908f,
+    0.460711181f, 0.460267365f, 0.459823400f, 0.459379345f,
+    0.458935171f, 0.458490878f, 0.458046466f, 0.457601935f,
+    0.457157314f, 0.456712574f, 0.456267685f, 0.455822706f,
+    0.455377638f, 0.454932421f, 0.454487115f, 0.454041660f,
+    0.453596115f, 0.453150451f, 0.452704698f, 0.452258795f,
+    0.451812804f, 0.451366693f, 0.450920463f, 0.450474113f,
+    0.450027674f, 0.449581116f, 0.449134439f, 0.448687643f,
+    0.448240757f, 0.447793722f, 0.447346598f, 0.446899384f,
+    0.446452022f, 0.446004570f, 0.445556998f, 0.445109308f,
+    0.444661528f, 0.444213599f, 0.443765610f, 0.443317473f,
+    0.442869246f, 0.442420870f, 0.441972435f, 0.441523850f,
+    0.441075176f, 0.440626383f, 0.440177470f, 0.439728469f,
+    0.439279348f, 0.438830137f, 0.438380778f, 0.437931329f,
+    0.437481761f, 0.437032104f, 0.436582327f, 0.436132431f,
+    0.435682446f, 0.435232341f, 0.434782118f, 0.434331805f,
+    0.433881372f, 0.433430851f, 0.432980180f, 0.432529420f,
+    0.432078570f, 0.431627601f, 0.431176513f, 0.430725336f,
+    0.430274040f, 0.429822624f, 0.429371119f, 0.428919494f,
+    0.428467780f, 0.428015947f, 0.427563995f, 0.427111953f,
+    0.426659822f, 0.426207542f, 0.425755173f, 0.425302714f,
+    0.424850136f, 0.424397439f, 0.423944652f, 0.423491746f,
+    0.423038751f, 0.422585636f, 0.422132432f, 0.421679109f,
+    0.421225697f, 0.420772165f, 0.420318514f, 0.419864774f,
+    0.419410944f, 0.418956995f, 0.418502927f, 0.418048769f,
+    0.417594492f, 0.417140126f, 0.416685671f, 0.416231096f,
+    0.415776402f, 0.415321618f, 0.414866716f, 0.414411724f,
+    0.413956642f, 0.413501441f, 0.413046122f, 0.412590742f,
+    0.412135214f, 0.411679596f, 0.411223888f, 0.410768062f,
+    0.410312146f, 0.409856141f, 0.409399986f, 0.408943772f,
+    0.408487439f, 0.408031017f, 0.407574475f, 0.407117844f,
+    0.406661093f, 0.406204253f, 0.405747324f, 0.405290276f,
+    0.404833138f, 0.404375881f, 0.403918535f, 0.403461099f,
+    0.403003544f, 0.402545899f, 0.402088135f, 0.401630282f,
+    0.401172340f, 0.400714278f, 0.400256127f, 0.399797887f,
+    0.399339527f, 0.398881078f, 0.398422539f, 0.397963881f,
+    0.397505134f, 0.397046268f, 0.396587342f, 0.396128267f,
+    0.395669132f, 0.395209879f, 0.394750535f, 0.394291103f,
+    0.393831551f, 0.393371910f, 0.392912179f, 0.392452329f,
+    0.391992390f, 0.391532362f, 0.391072243f, 0.390612006f,
+    0.390151680f, 0.389691263f, 0.389230728f, 0.388770133f,
+    0.388309389f, 0.387848586f, 0.387387693f, 0.386926681f,
+    0.386465579f, 0.386004359f, 0.385543078f, 0.385081679f,
+    0.384620190f, 0.384158611f, 0.383696914f, 0.383235157f,
+    0.382773280f, 0.382311314f, 0.381849229f, 0.381387085f,
+    0.380924821f, 0.380462468f, 0.380000025f, 0.379537493f,
+    0.379074842f, 0.378612131f, 0.378149301f, 0.377686381f,
+    0.377223372f, 0.376760244f, 0.376297057f, 0.375833750f,
+    0.375370353f, 0.374906868f, 0.374443293f, 0.373979628f,
+    0.373515874f, 0.373052001f, 0.372588068f, 0.372124016f,
+    0.371659875f, 0.371195644f, 0.370731324f, 0.370266914f,
+    0.369802386f, 0.369337797f, 0.368873090f, 0.368408322f,
+    0.367943436f, 0.367478460f, 0.367013395f, 0.366548240f,
+    0.366082996f, 0.365617663f, 0.365152240f, 0.364686728f,
+    0.364221096f, 0.363755405f, 0.363289624f, 0.362823725f,
+    0.362357765f, 0.361891687f, 0.361425549f, 0.360959291f,
+    0.360492945f, 0.360026538f, 0.359560013f, 0.359093398f,
+    0.358626723f, 0.358159930f, 0.357693046f, 0.357226074f,
+    0.356759042f, 0.356291890f, 0.355824649f, 0.355357349f,
+    0.354889929f, 0.354422420f, 0.353954852f, 0.353487164f,
+    0.353019387f, 0.352551550f, 0.352083623f, 0.351615578f,
+    0.351147473f, 0.350679249f, 0.350210965f, 0.349742591f,
+    0.349274129f, 0.348805577f, 0.348336935f, 0.347868204f,
+    0.347399384f, 0.346930474f, 0.346461505f, 0.345992416f,
+    0.345523268f, 0.345054001f, 0.344584674f, 0.344115257f,
+    0.343645751f, 0.343176156f, 0.342706472f, 0.342236698f,
+    0.341766864f, 0.341296941f, 0.340826899f, 0.340356797f,
+    0.339886606f, 0.339416325f, 0.338945985f, 0.338475525f,
+    0.338005006f, 0.337534398f, 0.337063700f, 0.336592913f,
+    0.336122036f, 0.335651070f, 0.335180044f, 0.334708929f,
+    0.334237725f, 0.333766431f, 0.333295077f, 0.332823604f,
+    0.332352072f, 0.331880450f, 0.331408769f, 0.330936968f,
+    0.330465108f, 0.329993159f, 0.329521120f, 0.329049021f,
+    0.328576803f, 0.328104526f, 0.327632159f, 0.327159733f,
+    0.326687187f, 0.326214582f, 0.325741917f, 0.325269133f,
+    0.324796289f, 0.324323356f, 0.323850334f, 0.323377252f,
+    0.322904080f, 0.322430819f, 0.321957469f, 0.321484059f,
+    0.321010560f, 0.320536971f, 0.320063323f, 0.319589585f,
+    0.319115758f, 0.318641871f, 0.318167895f, 0.317693830f,
+    0.317219704f, 0.316745490f, 0.316271186f, 0.315796822f,
+    0.315322369f, 0.314847827f, 0.314373225f, 0.313898534f,
+    0.313423753f, 0.312948912f, 0.312473983f, 0.311998993f,
+    0.311523914f, 0.311048746f, 0.310573518f, 0.310098201f,
+    0.309622824f, 0.309147358f, 0.308671802f, 0.308196187f,
+    0.307720482f, 0.307244688f, 0.306768835f, 0.306292921f,
+    0.305816919f, 0.305340827f, 0.304864675f, 0.304388434f,
+    0.303912103f, 0.303435743f, 0.302959263f, 0.302482724f,
+    0.302006125f, 0.301529408f, 0.301052660f, 0.300575823f,
+    0.300098896f, 0.299621910f, 0.299144834f, 0.298667699f,
+    0.298190475f, 0.297713190f, 0.297235817f, 0.296758384f,
+    0.296280861f, 0.295803279f, 0.295325637f, 0.294847876f,
+    0.294370085f, 0.293892205f, 0.293414235f, 0.292936206f,
+    0.292458117f, 0.291979939f, 0.291501671f, 0.291023374f,
+    0.290544957f, 0.290066510f, 0.289587975f, 0.289109349f,
+    0.288630664f, 0.288151920f, 0.287673086f, 0.287194192f,
+    0.286715209f, 0.286236167f, 0.285757065f, 0.285277873f,
+    0.284798592f, 0.284319282f, 0.283839881f, 0.283360392f,
+    0.282880872f, 0.282401264f, 0.281921566f, 0.281441808f,
+    0.280961990f, 0.280482084f, 0.280002117f, 0.279522091f,
+    0.279041976f, 0.278561801f, 0.278081566f, 0.277601272f,
+    0.277120888f, 0.276640415f, 0.276159912f, 0.275679320f,
+    0.275198638f, 0.274717927f, 0.274237126f, 0.273756266f,
+    0.273275316f, 0.272794336f, 0.272313267f, 0.271832108f,
+    0.271350920f, 0.270869642f, 0.270388305f, 0.269906878f,
+    0.269425422f, 0.268943876f, 0.268462241f, 0.267980576f,
+    0.267498821f, 0.267017007f, 0.266535133f, 0.266053200f,
+    0.265571177f, 0.265089095f, 0.264606953f, 0.264124751f,
+    0.263642460f, 0.263160110f, 0.262677699f, 0.262195230f,
+    0.261712700f, 0.261230081f, 0.260747433f, 0.260264695f,
+    0.259781897f, 0.259299010f, 0.258816093f, 0.258333087f,
+    0.257850021f, 0.257366896f, 0.256883711f, 0.256400466f,
+    0.255917162f, 0.255433768f, 0.254950315f, 0.254466802f,
+    0.253983229f, 0.253499597f, 0.253015906f, 0.252532154f,
+    0.252048314f, 0.251564413f, 0.251080483f, 0.250596464f,
+    0.250112385f, 0.249628246f, 0.249144047f, 0.248659775f,
+    0.248175457f, 0.247691065f, 0.247206613f, 0.246722102f,
+    0.246237531f, 0.245752886f, 0.245268196f, 0.244783431f,
+    0.244298622f, 0.243813738f, 0.243328795f, 0.242843792f,
+    0.242358729f, 0.241873607f, 0.241388425f, 0.240903184f,
+    0.240417868f, 0.239932507f, 0.239447087f, 0.238961592f,
+    0.238476053f, 0.237990454f, 0.237504780f, 0.237019062f,
+    0.236533284f, 0.236047447f, 0.235561535f, 0.235075578f,
+    0.234589562f, 0.234103486f, 0.233617350f, 0.233131155f,
+    0.232644901f, 0.232158601f, 0.231672227f, 0.231185809f,
+    0.230699316f, 0.230212778f, 0.229726180f, 0.229239523f,
+    0.228752807f, 0.228266031f, 0.227779210f, 0.227292329f,
+    0.226805389f, 0.226318389f, 0.225831330f, 0.225344211f,
+    0.224857047f, 0.224369824f, 0.223882541f, 0.223395213f,
+    0.222907811f, 0.222420365f, 0.221932873f, 0.221445307f,
+    0.220957696f, 0.220470026f, 0.219982296f, 0.219494522f,
+    0.219006687f, 0.218518794f, 0.218030855f, 0.217542857f,
+    0.217054799f, 0.216566697f, 0.216078535f, 0.215590328f,
+    0.215102047f, 0.214613736f, 0.214125350f, 0.213636920f,
+    0.213148445f, 0.212659910f, 0.212171316f, 0.211682677f,
+    0.211193979f, 0.210705221f, 0.210216433f, 0.209727570f,
+    0.209238663f, 0.208749712f, 0.208260700f, 0.207771629f,
+    0.207282513f, 0.206793353f, 0.206304133f, 0.205814868f,
+    0.205325544f, 0.204836175f, 0.204346746f, 0.203857273f,
+    0.203367740f, 0.202878177f, 0.202388540f, 0.201898858f,
+    0.201409131f, 0.200919360f, 0.200429529f, 0.199939653f,
+    0.199449718f, 0.198959738f, 0.198469713f, 0.197979629f,
+    0.197489500f, 0.196999326f, 0.196509108f, 0.196018830f,
+    0.195528507f, 0.195038125f, 0.194547713f, 0.194057241f,
+    0.193566725f, 0.193076149f, 0.192585528f, 0.192094877f,
+    0.191604152f, 0.191113397f, 0.190622583f, 0.190131739f,
+    0.189640835f, 0.189149886f, 0.188658878f, 0.188167840f,
+    0.187676743f, 0.187185600f, 0.186694428f, 0.186203197f,
+    0.185711905f, 0.185220584f, 0.184729218f, 0.184237793f,
+    0.183746338f, 0.183254823f, 0.182763264f, 0.182271659f,
+    0.181780025f, 0.181288332f, 0.180796593f, 0.180304810f,
+    0.179812983f, 0.179321110f, 0.178829193f, 0.178337231f,
+    0.177845225f, 0.177353173f, 0.176861078f, 0.176368937f,
+    0.175876752f, 0.175384521f, 0.174892247f, 0.174399927f,
+    0.173907578f, 0.173415169f, 0.172922716f, 0.172430232f,
+    0.171937704f, 0.171445131f, 0.170952514f, 0.170459852f,
+    0.169967145f, 0.169474393f, 0.168981612f, 0.168488771f,
+    0.167995900f, 0.167502984f, 0.167010039f, 0.166517034f,
+    0.166023999f, 0.165530920f, 0.165037796f, 0.164544627f,
+    0.164051414f, 0.163558170f, 0.163064882f, 0.162571564f,
+    0.162078187f, 0.161584780f, 0.161091328f, 0.160597846f,
+    0.160104305f, 0.159610748f, 0.159117132f, 0.158623487f,
+    0.158129796f, 0.157636061f, 0.157142296f, 0.156648487f,
+    0.156154647f, 0.155660748f, 0.155166835f, 0.154672861f,
+    0.154178858f, 0.153684825f, 0.153190747f, 0.152696624f,
+    0.152202472f, 0.151708275f, 0.151214048f, 0.150719777f,
+    0.150225475f, 0.149731129f, 0.149236739f, 0.148742318f,
+    0.148247868f, 0.147753373f, 0.147258848f, 0.146764278f,
+    0.146269664f, 0.145775035f, 0.145280361f, 0.144785643f,
+    0.144290894f, 0.143796101f, 0.143301278f, 0.142806426f,
+    0.142311528f, 0.141816601f, 0.141321644f, 0.140826643f,
+    0.140331611f, 0.139836535f, 0.139341429f, 0.138846293f,
+    0.138351113f, 0.137855902f, 0.137360662f, 0.136865392f,
+    0.136370078f, 0.135874733f, 0.135379344f, 0.134883940f,
+    0.134388492f, 0.133893013f, 0.133397490f, 0.132901952f,
+    0.132406369f, 0.131910756f, 0.131415099f, 0.130919427f,
+    0.130423710f, 0.129927963f, 0.129432186f, 0.128936380f,
+    0.128440529f, 0.127944663f, 0.127448753f, 0.126952812f,
+    0.126456842f, 0.125960842f, 0.125464812f, 0.124968745f,
+    0.124472648f, 0.123976521f, 0.123480365f, 0.122984171f,
+    0.122487955f, 0.121991701f, 0.121495418f, 0.120999113f,
+    0.120502770f, 0.120006397f, 0.119509995f, 0.119013563f,
+    0.118517101f, 0.118020616f, 0.117524095f, 0.117027543f,
+    0.116530962f, 0.116034359f, 0.115537718f, 0.115041055f,
+    0.114544362f, 0.114047632f, 0.113550887f, 0.113054104f,
+    0.112557292f, 0.112060457f, 0.111563593f, 0.111066699f,
+    0.110569783f, 0.110072829f, 0.109575853f, 0.109078854f,
+    0.108581826f, 0.108084768f, 0.107587680f, 0.107090570f,
+    0.106593430f, 0.106096268f, 0.105599076f, 0.105101861f,
+    0.104604617f, 0.104107343f, 0.103610046f, 0.103112727f,
+    0.102615379f, 0.102118008f, 0.101620607f, 0.101123184f,
+    0.100625731f, 0.100128256f, 0.0996307582f, 0.0991332307f,
+    0.0986356884f, 0.0981381088f, 0.0976405144f, 0.0971428901f,
+    0.0966452435f, 0.0961475670f, 0.0956498757f, 0.0951521546f,
+    0.0946544111f, 0.0941566452f, 0.0936588570f, 0.0931610391f,
+    0.0926632062f, 0.0921653435f, 0.0916674584f, 0.0911695510f,
+    0.0906716213f, 0.0901736692f, 0.0896757022f, 0.0891777053f,
+    0.0886796862f, 0.0881816447f, 0.0876835808f, 0.0871854946f,
+    0.0866873860f, 0.0861892551f, 0.0856911093f, 0.0851929337f,
+    0.0846947432f, 0.0841965303f, 0.0836982951f, 0.0832000375f,
+    0.0827017576f, 0.0822034627f, 0.0817051455f, 0.0812068060f,
+    0.0807084516f, 0.0802100673f, 0.0797116682f, 0.0792132542f,
+    0.0787148103f, 0.0782163516f, 0.0777178779f, 0.0772193819f,
+    0.0767208636f, 0.0762223229f, 0.0757237747f, 0.0752251968f,
+    0.0747266039f, 0.0742279962f, 0.0737293661f, 0.0732307136f,
+    0.0727320462f, 0.0722333640f, 0.0717346594f, 0.0712359399f,
+    0.0707371980f, 0.0702384487f, 0.0697396696f, 0.0692408830f,
+    0.0687420741f, 0.0682432428f, 0.0677444041f, 0.0672455430f,
+    0.0667466670f, 0.0662477762f, 0.0657488629f, 0.0652499348f,
+    0.0647509918f, 0.0642520338f, 0.0637530610f, 0.0632540733f,
+    0.0627550632f, 0.0622560419f, 0.0617570020f, 0.0612579510f,
+    0.0607588813f, 0.0602597967f, 0.0597606972f, 0.0592615865f,
+    0.0587624572f, 0.0582633130f, 0.0577641539f, 0.0572649837f,
+    0.0567657948f, 0.0562665947f, 0.0557673797f, 0.0552681498f,
+    0.0547689088f, 0.0542696528f, 0.0537703820f, 0.0532710999f,
+    0.0527718030f, 0.0522724912f, 0.0517731681f, 0.0512738340f,
+    0.0507744849f, 0.0502751246f, 0.0497757494f, 0.0492763631f,
+    0.0487769656f, 0.0482775532f, 0.0477781296f, 0.0472786948f,
+    0.0467792489f, 0.0462797917f, 0.0457803197f, 0.0452808402f,
+    0.0447813459f, 0.0442818403f, 0.0437823273f, 0.0432827994f,
+    0.0427832641f, 0.0422837175f, 0.0417841598f, 0.0412845910f,
+    0.0407850109f, 0.0402854234f, 0.0397858247f, 0.0392862149f,
+    0.0387865938f, 0.0382869653f, 0.0377873294f, 0.0372876823f,
+    0.0367880240f, 0.0362883583f, 0.0357886814f, 0.0352889970f,
+    0.0347893052f, 0.0342896022f, 0.0337898917f, 0.0332901739f,
+    0.0327904485f, 0.0322907120f, 0.0317909680f, 0.0312912166f,
+    0.0307914596f, 0.0302916914f, 0.0297919177f, 0.0292921364f,
+    0.0287923478f, 0.0282925516f, 0.0277927481f, 0.0272929370f,
+    0.0267931204f, 0.0262932964f, 0.0257934667f, 0.0252936296f,
+    0.0247937851f, 0.0242939368f, 0.0237940811f, 0.0232942197f,
+    0.0227943528f, 0.0222944804f, 0.0217946004f, 0.0212947167f,
+    0.0207948275f, 0.0202949326f, 0.0197950341f, 0.0192951299f,
+    0.0187952202f, 0.0182953067f, 0.0177953877f, 0.0172954649f,
+    0.0167955365f, 0.0162956063f, 0.0157956704f, 0.0152957300f,
+    0.0147957867f, 0.0142958397f, 0.0137958890f, 0.0132959355f,
+    0.0127959773f, 0.0122960173f, 0.0117960535f, 0.0112960869f,
+    0.0107961167f, 0.0102961445f, 0.00979617052f, 0.00929619279f,
+    0.00879621319f, 0.00829623174f, 0.00779624796f, 0.00729626184f,
+    0.00679627433f, 0.00629628496f, 0.00579629419f, 0.00529630203f,
+    0.00479630847f, 0.00429631351f, 0.00379631761f, 0.00329632079f,
+    0.00279632304f, 0.00229632482f, 0.00179632579f, 0.00129632640f,
+    0.000796326727f, 0.000296326791f, -0.000203673204f, -0.000703673169f,
+    -0.00120367296f, -0.00170367234f, -0.00220367149f, -0.00270366995f,
+    -0.00320366770f, -0.00370366476f, -0.00420366088f, -0.00470365584f,
+    -0.00520364987f, -0.00570364250f, -0.00620363327f, -0.00670362310f,
+    -0.00720361108f, -0.00770359719f, -0.00820358098f, -0.00870356336f,
+    -0.00920354296f, -0.00970352069f, -0.0102034966f, -0.0107034687f,
+    -0.0112034390f, -0.0117034065f, -0.0122033702f, -0.0127033312f,
+    -0.0132032894f, -0.0137032447f, -0.0142031955f, -0.0147031434f,
+    -0.0152030876f, -0.0157030281f, -0.0162029639f, -0.0167028960f,
+    -0.0172028244f, -0.0177027490f, -0.0182026681f, -0.0187025834f,
+    -0.0192024931f, -0.0197023991f, -0.0202022996f, -0.0207021944f,
+    -0.0212020837f, -0.0217019692f, -0.0222018491f, -0.0227017235f,
+    -0.0232015904f, -0.0237014536f, -0.0242013093f, -0.0247011613f,
+    -0.0252010059f, -0.0257008430f, -0.0262006745f, -0.0267005004f,
+    -0.0272003189f, -0.0277001299f, -0.0281999335f, -0.0286997315f,
+    -0.0291995220f, -0.0296993051f, -0.0301990807f, -0.0306988489f,
+    -0.0311986096f, -0.0316983610f, -0.0321981087f, -0.0326978453f,
+    -0.0331975743f, -0.0336972922f, -0.0341970026f, -0.0346967094f,
+    -0.0351964012f, -0.0356960893f, -0.0361957662f, -0.0366954319f,
+    -0.0371950902f, -0.0376947410f, -0.0381943807f, -0.0386940129f,
+    -0.0391936302f, -0.0396932438f, -0.0401928425f, -0.0406924337f,
+    -0.0411920138f, -0.0416915864f, -0.0421911441f, -0.0426906943f,
+    -0.0431902334f, -0.0436897613f, -0.0441892780f, -0.0446887836f,
+    -0.0451882817f, -0.0456877649f, -0.0461872369f, -0.0466866978f,
+    -0.0471861437f, -0.0476855822f, -0.0481850095f, -0.0486844219f,
+    -0.0491838232f, -0.0496832095f, -0.0501825884f, -0.0506819524f,
+    -0.0511813015f, -0.0516806394f, -0.0521799661f, -0.0526792780f,
+    -0.0531785786f, -0.0536778644f, -0.0541771352f, -0.0546763949f,
+    -0.0551756397f, -0.0556748696f, -0.0561740883f, -0.0566732921f,
+    -0.0571724810f, -0.0576716550f, -0.0581708178f, -0.0586699620f,
+    -0.0591690950f, -0.0596682094f, -0.0601673126f, -0.0606663972f,
+    -0.0611654706f, -0.0616645254f, -0.0621635653f, -0.0626625940f,
+    -0.0631616041f, -0.0636605918f, -0.0641595721f, -0.0646585375f,
+    -0.0651574805f, -0.0656564087f, -0.0661553219f, -0.0666542202f,
+    -0.0671530962f, -0.0676519647f, -0.0681508109f, -0.0686496347f,
+    -0.0691484511f, -0.0696472451f, -0.0701460168f, -0.0706447810f,
+    -0.0711435229f, -0.0716422424f, -0.0721409544f, -0.0726396367f,
+    -0.0731383115f, -0.0736369640f, -0.0741355941f, -0.0746342093f,
+    -0.0751328096f, -0.0756313801f, -0.0761299431f, -0.0766284838f,
+    -0.0771270022f, -0.0776255056f, -0.0781239867f, -0.0786224455f,
+    -0.0791208893f, -0.0796193108f, -0.0801177174f, -0.0806160942f,
+    -0.0811144561f, -0.0816128030f, -0.0821111202f, -0.0826094225f,
+    -0.0831077024f, -0.0836059675f, -0.0841042027f, -0.0846024230f,
+    -0.0851006210f, -0.0855987966f, -0.0860969499f, -0.0865950808f,
+    -0.0870931894f, -0.0875912830f, -0.0880893469f, -0.0885873958f,
+    -0.0890854150f, -0.0895834193f, -0.0900813937f, -0.0905793533f,
+    -0.0910772830f, -0.0915751979f, -0.0920730829f, -0.0925709456f,
+    -0.0930687860f, -0.0935666114f, -0.0940643996f, -0.0945621729f,
+    -0.0950599238f, -0.0955576450f, -0.0960553437f, -0.0965530202f,
+    -0.0970506743f, -0.0975482985f, -0.0980459005f, -0.0985434800f,
+    -0.0990410373f, -0.0995385647f, -0.100036070f, -0.100533552f,
+    -0.101031005f, -0.101528436f, -0.102025837f, -0.102523215f,
+    -0.103020564f, -0.103517897f, -0.104015194f, -0.104512468f,
+    -0.105009720f, -0.105506942f, -0.106004134f, -0.106501304f,
+    -0.106998451f, -0.107495569f, -0.107992657f, -0.108489715f,
+    -0.108986750f, -0.109483764f, -0.109980740f, -0.110477693f,
+    -0.110974617f, -0.111471519f, -0.111968391f, -0.112465225f,
+    -0.112962045f, -0.113458827f, -0.113955587f, -0.114452317f,
+    -0.114949010f, -0.115445688f, -0.115942329f, -0.116438940f,
+    -0.116935529f, -0.117432080f, -0.117928609f, -0.118425101f,
+    -0.118921570f, -0.119418003f, -0.119914412f, -0.120410793f,
+    -0.120907135f, -0.121403456f, -0.121899739f, -0.122396000f,
+    -0.122892223f, -0.123388417f, -0.123884581f, -0.124380715f,
+    -0.124876812f, -0.125372887f, -0.125868931f, -0.126364931f,
+    -0.126860902f, -0.127356857f, -0.127852768f, -0.128348649f,
+    -0.128844500f, -0.129340306f, -0.129836097f, -0.130331844f,
+    -0.130827561f, -0.131323248f, -0.131818905f, -0.132314518f,
+    -0.132810116f, -0.133305669f, -0.133801192f, -0.134296671f,
+    -0.134792134f, -0.135287553f, -0.135782927f, -0.136278287f,
+    -0.136773601f, -0.137268886f, -0.137764141f, -0.138259351f,
+    -0.138754532f, -0.139249682f, -0.139744788f, -0.140239865f,
+    -0.140734911f, -0.141229913f, -0.141724885f, -0.142219827f,
+    -0.142714724f, -0.143209592f, -0.143704414f, -0.144199207f,
+    -0.144693956f, -0.145188689f, -0.145683363f, -0.146178007f,
+    -0.146672621f, -0.147167206f, -0.147661731f, -0.148156241f,
+    -0.148650706f, -0.149145126f, -0.149639517f, -0.150133863f,
+    -0.150628179f, -0.151122451f, -0.151616693f, -0.152110890f,
+    -0.152605057f, -0.153099179f, -0.153593272f, -0.154087320f,
+    -0.154581323f, -0.155075297f, -0.155569226f, -0.156063125f,
+    -0.156556979f, -0.157050788f, -0.157544568f, -0.158038303f,
+    -0.158531994f, -0.159025654f, -0.159519270f, -0.160012856f,
+    -0.160506383f, -0.160999894f, -0.161493346f, -0.161986768f,
+    -0.162480131f, -0.162973478f, -0.163466766f, -0.163960025f,
+    -0.164453238f, -0.164946407f, -0.165439531f, -0.165932626f,
+    -0.166425675f, -0.166918680f, -0.167411640f, -0.167904571f,
+    -0.168397442f, -0.168890283f, -0.169383079f, -0.169875830f,
+    -0.170368552f, -0.170861214f, -0.171353847f, -0.171846420f,
+    -0.172338963f, -0.172831461f, -0.173323914f, -0.173816323f,
+    -0.174308702f, -0.174801022f, -0.175293297f, -0.175785542f,
+    -0.176277727f, -0.176769882f, -0.177261978f, -0.177754045f,
+    -0.178246051f, -0.178738028f, -0.179229945f, -0.179721832f,
+    -0.180213675f, -0.180705458f, -0.181197211f, -0.181688905f,
+    -0.182180569f, -0.182672173f, -0.183163732f, -0.183655262f,
+    -0.184146732f, -0.184638157f, -0.185129538f, -0.185620874f,
+    -0.186112151f, -0.186603397f, -0.187094584f, -0.187585741f,
+    -0.188076839f, -0.188567892f, -0.189058900f, -0.189549863f,
+    -0.190040767f, -0.190531641f, -0.191022456f, -0.191513225f,
+    -0.192003936f, -0.192494616f, -0.192985237f, -0.193475813f,
+    -0.193966344f, -0.194456831f, -0.194947258f, -0.195437640f,
+    -0.195927978f, -0.196418256f, -0.196908489f, -0.197398677f,
+    -0.197888821f, -0.198378906f, -0.198868945f, -0.199358925f,
+    -0.199848861f, -0.200338751f, -0.200828597f, -0.201318383f,
+    -0.201808125f, -0.202297807f, -0.202787444f, -0.203277022f,
+    -0.203766569f, -0.204256043f, -0.204745486f, -0.205234870f,
+    -0.205724195f, -0.206213474f, -0.206702694f, -0.207191885f,
+    -0.207681000f, -0.208170071f, -0.208659098f, -0.209148064f,
+    -0.209636971f, -0.210125849f, -0.210614651f, -0.211103410f,
+    -0.211592123f, -0.212080762f, -0.212569371f, -0.213057920f,
+    -0.213546410f, -0.214034840f, -0.214523241f, -0.215011567f,
+    -0.215499848f, -0.215988070f, -0.216476247f, -0.216964364f,
+    -0.217452422f, -0.217940435f, -0.218428388f, -0.218916282f,
+    -0.219404131f, -0.219891921f, -0.220379651f, -0.220867336f,
+    -0.221354961f, -0.221842527f, -0.222330034f, -0.222817495f,
+    -0.223304898f, -0.223792240f, -0.224279538f, -0.224766761f,
+    -0.225253940f, -0.225741073f, -0.226228133f, -0.226715147f,
+    -0.227202088f, -0.227688983f, -0.228175834f, -0.228662610f,
+    -0.229149342f, -0.229635999f, -0.230122611f, -0.230609164f,
+    -0.231095657f, -0.231582090f, -0.232068479f, -0.232554793f,
+    -0.233041063f, -0.233527258f, -0.234013408f, -0.234499499f,
+    -0.234985515f, -0.235471487f, -0.235957399f, -0.236443251f,
+    -0.236929044f, -0.237414777f, -0.237900451f, -0.238386065f,
+    -0.238871634f, -0.239357129f, -0.239842564f, -0.240327939f,
+    -0.240813255f, -0.241298512f, -0.241783708f, -0.242268831f,
+    -0.242753908f, -0.243238926f, -0.243723884f, -0.244208768f,
+    -0.244693607f, -0.245178372f, -0.245663077f, -0.246147722f,
+    -0.246632308f, -0.247116834f, -0.247601300f, -0.248085693f,
+    -0.248570040f, -0.249054313f, -0.249538526f, -0.250022680f,
+    -0.250506759f, -0.250990778f, -0.251474738f, -0.251958638f,
+    -0.252442479f, -0.252926260f, -0.253409982f, -0.253893614f,
+    -0.254377216f, -0.254860729f, -0.255344182f, -0.255827576f,
+    -0.256310910f, -0.256794184f, -0.257277369f, -0.257760525f,
+    -0.258243591f, -0.258726597f, -0.259209543f, -0.259692401f,
+    -0.260175228f, -0.260657966f, -0.261140645f, -0.261623263f,
+    -0.262105823f, -0.262588322f, -0.263070732f, -0.263553083f,
+    -0.264035374f, -0.264517605f, -0.264999747f, -0.265481859f,
+    -0.265963882f, -0.266445845f, -0.266927719f, -0.267409563f,
+    -0.267891318f, -0.268373013f, -0.268854618f, -0.269336194f,
+    -0.269817680f, -0.270299077f, -0.270780444f, -0.271261722f,
+    -0.271742940f, -0.272224098f, -0.272705197f, -0.273186207f,
+    -0.273667157f, -0.274148017f, -0.274628848f, -0.275109589f,
+    -0.275590241f, -0.276070863f, -0.276551396f, -0.277031839f,
+    -0.277512252f, -0.277992576f, -0.278472841f, -0.278953016f,
+    -0.279433131f, -0.279913187f, -0.280393153f, -0.280873060f,
+    -0.281352907f, -0.281832665f, -0.282312363f, -0.282792002f,
+    -0.283271551f, -0.283751041f, -0.284230441f, -0.284709781f,
+    -0.285189062f, -0.285668254f, -0.286147386f, -0.286626458f,
+    -0.287105441f, -0.287584335f, -0.288063198f, -0.288541943f,
+    -0.289020658f, -0.289499283f, -0.289977819f, -0.290456325f,
+    -0.290934712f, -0.291413069f, -0.291891307f, -0.292369515f,
+    -0.292847633f, -0.293325663f, -0.293803632f, -0.294281542f,
+    -0.294759363f, -0.295237094f, -0.295714766f, -0.296192378f,
+    -0.296669900f, -0.297147363f, -0.297624737f, -0.298102051f,
+    -0.298579276f, -0.299056441f, -0.299533516f, -0.300010502f,
+    -0.300487429f, -0.300964296f, -0.301441073f, -0.301917791f,
+    -0.302394420f, -0.302870959f, -0.303347439f, -0.303823858f,
+    -0.304300159f, -0.304776430f, -0.305252582f, -0.305728704f,
+    -0.306204706f, -0.306680650f, -0.307156533f, -0.307632327f,
+    -0.308108032f, -0.308583677f, -0.309059232f, -0.309534699f,
+    -0.310010105f, -0.310485452f, -0.310960680f, -0.311435878f,
+    -0.311910957f, -0.312385976f, -0.312860906f, -0.313335776f,
+    -0.313810557f, -0.314285249f, -0.314759880f, -0.315234423f,
+    -0.315708905f, -0.316183299f, -0.316657603f, -0.317131817f,
+    -0.317605972f, -0.318080068f, -0.318554044f, -0.319027960f,
+    -0.319501787f, -0.319975555f, -0.320449203f, -0.320922822f,
+    -0.321396321f, -0.321869761f, -0.322343111f, -0.322816372f,
+    -0.323289573f, -0.323762685f, -0.324235708f, -0.324708641f,
+    -0.325181514f, -0.325654298f, -0.326127023f, -0.326599628f,
+    -0.327072173f, -0.327544630f, -0.328016996f, -0.328489304f,
+    -0.328961521f, -0.329433650f, -0.329905689f, -0.330377668f,
+    -0.330849528f, -0.331321329f, -0.331793070f, -0.332264692f,
+    -0.332736254f, -0.333207726f, -0.333679110f, -0.334150404f,
+    -0.334621608f, -0.335092753f, -0.335563809f, -0.336034775f,
+    -0.336505651f, -0.336976439f, -0.337447166f, -0.337917805f,
+    -0.338388354f, -0.338858813f, -0.339329183f, -0.339799464f,
+    -0.340269685f, -0.340739787f, -0.341209829f, -0.341679782f,
+    -0.342149645f, -0.342619419f, -0.343089134f, -0.343558729f,
+    -0.344028264f, -0.344497681f, -0.344967037f, -0.345436305f,
+    -0.345905483f, -0.346374571f, -0.346843570f, -0.347312510f,
+    -0.347781330f, -0.348250061f, -0.348718733f, -0.349187315f,
+    -0.349655777f, -0.350124180f, -0.350592494f, -0.351060718f,
+    -0.351528853f, -0.351996899f, -0.352464855f, -0.352932721f,
+    -0.353400499f, -0.353868186f, -0.354335785f, -0.354803294f,
+    -0.355270714f, -0.355738074f, -0.356205314f, -0.356672466f,
+    -0.357139558f, -0.357606530f, -0.358073413f, -0.358540207f,
+    -0.359006941f, -0.359473556f, -0.359940082f, -0.360406518f,
+    -0.360872895f, -0.361339152f, -0.361805320f, -0.362271398f,
+    -0.362737387f, -0.363203287f, -0.363669097f, -0.364134818f,
+    -0.364600450f, -0.365065992f, -0.365531415f, -0.365996778f,
+    -0.366462052f, -0.366927207f, -0.367392302f, -0.367857277f,
+    -0.368322164f, -0.368786991f, -0.369251698f, -0.369716316f,
+    -0.370180845f, -0.370645255f, -0.371109605f, -0.371573865f,
+    -0.372038007f, -0.372502059f, -0.372966051f, -0.373429924f,
+    -0.373893708f, -0.374357402f, -0.374820977f, -0.375284493f,
+    -0.375747889f, -0.376211196f, -0.376674414f, -0.377137542f,
+    -0.377600580f, -0.378063530f, -0.378526360f, -0.378989100f,
+    -0.379451752f, -0.379914314f, -0.380376786f, -0.380839169f,
+    -0.381301433f, -0.381763607f, -0.382225692f, -0.382687688f,
+    -0.383149564f, -0.383611351f, -0.384073049f, -0.384534657f,
+    -0.384996176f, -0.385457575f, -0.385918885f, -0.386380106f,
+    -0.386841238f, -0.387302250f, -0.387763202f, -0.388224006f,
+    -0.388684750f, -0.389145404f, -0.389605939f, -0.390066385f,
+    -0.390526712f, -0.390986949f, -0.391447127f, -0.391907156f,
+    -0.392367125f, -0.392826974f, -0.393286735f, -0.393746376f,
+    -0.394205958f, -0.394665420f, -0.395124763f, -0.395584047f,
+    -0.396043211f, -0.396502256f, -0.396961242f, -0.397420108f,
+    -0.397878885f, -0.398337543f, -0.398796111f, -0.399254590f,
+    -0.399712950f, -0.400171220f, -0.400629401f, -0.401087463f,
+    -0.401545435f, -0.402003288f, -0.402461082f, -0.402918726f,
+    -0.403376311f, -0.403833777f, -0.404291153f, -0.404748410f,
+    -0.405205578f, -0.405662626f, -0.406119585f, -0.406576455f,
+    -0.407033205f, -0.407489866f, -0.407946408f, -0.408402860f,
+    -0.408859223f, -0.409315467f, -0.409771621f, -0.410227656f,
+    -0.410683602f, -0.411139429f, -0.411595166f, -0.412050784f,
+    -0.412506342f, -0.412961751f, -0.413417071f, -0.413872302f,
+    -0.414327413f, -0.414782435f, -0.415237337f, -0.415692151f,
+    -0.416146845f, -0.416601419f, -0.417055935f, -0.417510301f,
+    -0.417964607f, -0.418418765f, -0.418872863f, -0.419326812f,
+    -0.419780701f, -0.420234442f, -0.420688093f, -0.421141654f,
+    -0.421595097f, -0.422048450f, -0.422501683f, -0.422954798f,
+    -0.423407823f, -0.423860729f, -0.424313545f, -0.424766243f,
+    -0.425218850f, -0.425671339f, -0.426123738f, -0.426576018f,
+    -0.427028179f, -0.427480251f, -0.427932203f, -0.428384066f,
+    -0.428835809f, -0.429287434f, -0.429738969f, -0.430190384f,
+    -0.430641711f, -0.431092918f, -0.431544006f, -0.431995004f,
+    -0.432445884f, -0.432896674f, -0.433347344f, -0.433797896f,
+    -0.434248358f, -0.434698701f, -0.435148925f, -0.435599059f,
+    -0.436049074f, -0.436498970f, -0.436948776f, -0.437398463f,
+    -0.437848032f, -0.438297510f, -0.438746870f, -0.439196110f,
+    -0.439645261f, -0.440094292f, -0.440543205f, -0.440992028f,
+    -0.441440731f, -0.441889316f, -0.442337781f, -0.442786157f,
+    -0.443234414f, -0.443682551f, -0.444130599f, -0.444578528f,
+    -0.445026338f, -0.445474029f, -0.445921630f, -0.446369112f,
+    -0.446816474f, -0.447263747f, -0.447710872f, -0.448157907f,
+    -0.448604852f, -0.449051648f, -0.449498355f, -0.449944943f,
+    -0.450391412f, -0.450837761f, -0.451284021f, -0.451730132f,
+    -0.452176154f, -0.452622056f, -0.453067869f, -0.453513533f,
+    -0.453959107f, -0.454404563f, -0.454849899f, -0.455295146f,
+    -0.455740243f, -0.456185251f, -0.456630141f, -0.457074910f,
+    -0.457519561f, -0.457964092f, -0.458408535f, -0.458852857f,
+    -0.459297031f, -0.459741116f, -0.460185111f, -0.460628957f,
+    -0.461072683f, -0.461516321f, -0.461959809f, -0.462403208f,
+    -0.462846488f, -0.463289648f, -0.463732690f, -0.464175642f,
+    -0.464618444f, -0.465061128f, -0.465503722f, -0.465946198f,
+    -0.466388524f, -0.466830760f, -0.467272878f, -0.467714876f,
+    -0.468156755f, -0.468598515f, -0.469040185f, -0.469481707f,
+    -0.469923109f, -0.470364422f, -0.470805585f, -0.471246660f,
+    -0.471687585f, -0.472128421f, -0.472569108f, -0.473009706f,
+    -0.473450184f, -0.473890513f, -0.474330753f, -0.474770874f,
+    -0.475210875f, -0.475650758f, -0.476090491f, -0.476530135f,
+    -0.476969659f, -0.477409065f, -0.477848351f, -0.478287488f,
+    -0.478726536f, -0.479165465f, -0.479604274f, -0.480042964f,
+    -0.480481505f, -0.480919957f, -0.481358290f, -0.481796473f,
+    -0.482234567f, -0.482672513f, -0.483110368f, -0.483548075f,
+    -0.483985692f, -0.484423161f, -0.484860510f, -0.485297740f,
+    -0.485734850f, -0.486171842f, -0.486608714f, -0.487045467f,
+    -0.487482101f, -0.487918615f, -0.488354981f, -0.488791257f,
+    -0.489227384f, -0.489663422f, -0.490099311f, -0.490535080f,
+    -0.490970731f, -0.491406262f, -0.491841644f, -0.492276937f,
+    -0.492712080f, -0.493147135f, -0.493582040f, -0.494016826f,
+    -0.494451493f, -0.494886041f, -0.495320439f, -0.495754749f,
+    -0.496188909f, -0.496622950f, -0.497056872f, -0.497490674f,
+    -0.497924358f, -0.498357892f, -0.498791307f, -0.499224633f,
+    -0.499657780f, -0.500090837f, -0.500523746f, -0.500956535f,
+    -0.501389265f, -0.501821756f, -0.502254188f, -0.502686501f,
+    -0.503118694f, -0.503550708f, -0.503982663f, -0.504414439f,
+    -0.504846096f, -0.505277634f, -0.505709052f, -0.506140351f,
+    -0.506571531f, -0.507002532f, -0.507433474f, -0.507864237f,
+    -0.508294880f, -0.508725405f, -0.509155810f, -0.509586096f,
+    -0.510016263f, -0.510446250f, -0.510876179f, -0.511305928f,
+    -0.511735559f, -0.512165070f, -0.512594461f, -0.513023674f,
+    -0.513452828f, -0.513881803f, -0.514310658f, -0.514739394f,
+    -0.515168011f, -0.515596509f, -0.516024828f, -0.516453087f,
+    -0.516881168f, -0.517309129f, -0.517736971f, -0.518164694f,
+    -0.518592238f, -0.519019663f, -0.519447029f, -0.519874215f,
+    -0.520301223f, -0.520728171f, -0.521155000f, -0.521581650f,
+    -0.522008181f, -0.522434592f, -0.522860825f, -0.523286998f,
+    -0.523712993f, -0.524138868f, -0.524564624f, -0.524990261f,
+    -0.525415778f, -0.525841117f, -0.526266336f, -0.526691437f,
+    -0.527116418f, -0.527541220f, -0.527965903f, -0.528390467f,
+    -0.528814912f, -0.529239237f, -0.529663384f, -0.530087411f,
+    -0.530511320f, -0.530935109f, -0.531358778f, -0.531782269f,
+    -0.532205641f, -0.532628894f, -0.533051968f, -0.533474982f,
+    -0.533897817f, -0.534320533f, -0.534743071f, -0.535165489f,
+    -0.535587847f, -0.536010027f, -0.536432028f, -0.536853969f,
+    -0.537275732f, -0.537697375f, -0.538118839f, -0.538540244f,
+    -0.538961470f, -0.539382577f, -0.539803505f, -0.540224314f,
+    -0.540645003f, -0.541065574f, -0.541486025f, -0.541906297f,
+    -0.542326450f, -0.542746484f, -0.543166339f, -0.543586075f,
+    -0.544005692f, -0.544425189f, -0.544844508f, -0.545263708f,
+    -0.545682788f, -0.546101689f, -0.546520472f, -0.546939135f,
+    -0.547357678f, -0.547776043f, -0.548194289f, -0.548612416f,
+    -0.549030364f, -0.549448192f, -0.549865901f, -0.550283432f,
+    -0.550700843f, -0.551118135f, -0.551535308f, -0.551952302f,
+    -0.552369177f, -0.552785933f, -0.553202510f, -0.553618968f,
+    -0.554035246f, -0.554451466f, -0.554867506f, -0.555283368f,
+    -0.555699170f, -0.556114793f, -0.556530237f, -0.556945622f,
+    -0.557360828f, -0.557775855f, -0.558190763f, -0.558605552f,
+    -0.559020221f, -0.559434712f, -0.559849083f, -0.560263336f,
+    -0.560677409f, -0.561091363f, -0.561505139f, -0.561918855f,
+    -0.562332332f, -0.562745750f, -0.563158989f, -0.563572109f,
+    -0.563985050f, -0.564397871f, -0.564810574f, -0.565223098f,
+    -0.565635502f, -0.566047728f, -0.566459894f, -0.566871822f,
+    -0.567283690f, -0.567695379f, -0.568106890f, -0.568518341f,
+    -0.568929613f, -0.569340706f, -0.569751680f, -0.570162535f,
+    -0.570573211f, -0.570983768f, -0.571394205f, -0.571804464f,
+    -0.572214544f, -0.572624564f, -0.573034406f, -0.573444068f,
+    -0.573853612f, -0.574263036f, -0.574672282f, -0.575081408f,
+    -0.575490415f, -0.575899243f, -0.576307893f, -0.576716483f,
+    -0.577124894f, -0.577533126f, -0.577941239f, -0.578349173f,
+    -0.578757048f, -0.579164684f, -0.579572260f, -0.579979599f,
+    -0.580386877f, -0.580793977f, -0.581200898f, -0.581607699f,
+    -0.582014382f, -0.582420886f, -0.582827270f, -0.583233476f,
+    -0.583639562f, -0.584045529f, -0.584451318f, -0.584856927f,
+    -0.585262418f, -0.585667789f, -0.586072981f, -0.586478055f,
+    -0.586882949f, -0.587287724f, -0.587692320f, -0.588096797f,
+    -0.588501096f, -0.588905275f, -0.589309335f, -0.589713216f,
+    -0.590116918f, -0.590520501f, -0.590923965f, -0.591327250f,
+    -0.591730416f, -0.592133403f, -0.592536211f, -0.592938900f,
+    -0.593341470f, -0.593743861f, -0.594146132f, -0.594548225f,
+    -0.594950199f, -0.595351994f, -0.595753670f, -0.596155167f,
+    -0.596556544f, -0.596957743f, -0.597358823f, -0.597759724f,
+    -0.598160446f, -0.598561108f, -0.598961532f, -0.599361837f,
+    -0.599762022f, -0.600162029f, -0.600561917f, -0.600961626f,
+    -0.601361156f, -0.601760566f, -0.602159858f, -0.602558970f,
+    -0.602957904f, -0.603356719f, -0.603755414f, -0.604153931f,
+    -0.604552269f, -0.604950488f, -0.605348527f, -0.605746448f,
+    -0.606144190f, -0.606541812f, -0.606939256f, -0.607336521f,
+    -0.607733667f, -0.608130693f, -0.608527541f, -0.608924210f,
+    -0.609320760f, -0.609717131f, -0.610113382f, -0.610509455f,
+    -0.610905409f, -0.611301184f, -0.611696780f, -0.612092257f,
+    -0.612487555f, -0.612882733f, -0.613277733f, -0.613672614f,
+    -0.614067316f, -0.614461839f, -0.614856243f, -0.615250468f,
+    -0.615644574f, -0.616038501f, -0.616432309f, -0.616825938f,
+    -0.617219388f, -0.617612720f, -0.618005872f, -0.618398905f,
+    -0.618791759f, -0.619184434f, -0.619576991f, -0.619969368f,
+    -0.620361626f, -0.620753706f, -0.621145606f, -0.621537387f,
+    -0.621928990f, -0.622320473f, -0.622711778f, -0.623102903f,
+    -0.623493910f, -0.623884737f, -0.624275446f, -0.624665916f,
+    -0.625056326f, -0.625446498f, -0.625836551f, -0.626226485f,
+    -0.626616240f, -0.627005816f, -0.627395213f, -0.627784491f,
+    -0.628173649f, -0.628562570f, -0.628951371f, -0.629340053f,
+    -0.629728496f, -0.630116820f, -0.630505025f, -0.630893052f,
+    -0.631280899f, -0.631668568f, -0.632056117f, -0.632443488f,
+    -0.632830739f, -0.633217812f, -0.633604705f, -0.633991420f,
+    -0.634378016f, -0.634764493f, -0.635150731f, -0.635536849f,
+    -0.635922790f, -0.636308610f, -0.636694252f, -0.637079716f,
+    -0.637465060f, -0.637850225f, -0.638235211f, -0.638620079f,
+    -0.639004707f, -0.639389277f, -0.639773607f, -0.640157819f,
+    -0.640541852f, -0.640925765f, -0.641309440f, -0.641692996f,
+    -0.642076433f, -0.642459691f, -0.642842770f, -0.643225670f,
+    -0.643608391f, -0.643990993f, -0.644373477f, -0.644755721f,
+    -0.645137846f, -0.645519793f, -0.645901561f, -0.646283209f,
+    -0.646664679f, -0.647045970f, -0.647427142f, -0.647808135f,
+    -0.648188949f, -0.648569584f, -0.648950100f, -0.649330437f,
+    -0.649710596f, -0.650090635f, -0.650470436f, -0.650850117f,
+    -0.651229680f, -0.651609004f, -0.651988208f, -0.652367234f,
+    -0.652746141f, -0.653124809f, -0.653503358f, -0.653881729f,
+    -0.654259980f, -0.654637992f, -0.655015886f, -0.655393660f,
+    -0.655771196f, -0.656148612f, -0.656525850f, -0.656902909f,
+    -0.657279789f, -0.657656550f, -0.658033133f, -0.658409536f,
+    -0.658785760f, -0.659161866f, -0.659537792f, -0.659913540f,
+    -0.660289109f, -0.660664558f, -0.661039829f, -0.661414921f,
+    -0.661789834f, -0.662164569f, -0.662539184f, -0.662913620f,
+    -0.663287878f, -0.663661957f, -0.664035916f, -0.664409697f,
+    -0.664783299f, -0.665156722f, -0.665529966f, -0.665903091f,
+    -0.666276038f, -0.666648805f, -0.667021394f, -0.667393804f,
+    -0.667766094f, -0.668138206f, -0.668510139f, -0.668881893f,
+    -0.669253528f, -0.669624925f, -0.669996202f, -0.670367301f,
+    -0.670738220f, -0.671109021f, -0.671479583f, -0.671850026f,
+    -0.672220290f, -0.672590375f, -0.672960281f, -0.673330069f,
+    -0.673699617f, -0.674069047f, -0.674438298f, -0.674807370f,
+    -0.675176322f, -0.675545037f, -0.675913632f, -0.676282048f,
+    -0.676650286f, -0.677018344f, -0.677386224f, -0.677753925f,
+    -0.678121507f, -0.678488910f, -0.678856134f, -0.679223180f,
+    -0.679590046f, -0.679956794f, -0.680323303f, -0.680689692f,
+    -0.681055903f, -0.681421936f, -0.681787789f, -0.682153463f,
+    -0.682518959f, -0.682884336f, -0.683249533f, -0.683614492f,
+    -0.683979332f, -0.684343994f, -0.684708536f, -0.685072839f,
+    -0.685436964f, -0.685800970f, -0.686164796f, -0.686528385f,
+    -0.686891854f, -0.687255144f, -0.687618315f, -0.687981248f,
+    -0.688344002f, -0.688706636f, -0.689069033f, -0.689431310f,
+    -0.689793408f, -0.690155327f, -0.690517068f, -0.690878630f,
+    -0.691240072f, -0.691601276f, -0.691962302f, -0.692323208f,
+    -0.692683935f, -0.693044424f, -0.693404794f, -0.693764985f,
+    -0.694124997f, -0.694484830f, -0.694844484f, -0.695204020f,
+    -0.695563316f, -0.695922494f, -0.696281433f, -0.696640253f,
+    -0.696998835f, -0.697357297f, -0.697715580f, -0.698073685f,
+    -0.698431611f, -0.698789358f, -0.699146926f, -0.699504316f,
+    -0.699861586f, -0.700218618f, -0.700575471f, -0.700932205f,
+    -0.701288700f, -0.701645076f, -0.702001274f, -0.702357233f,
+    -0.702713072f, -0.703068733f, -0.703424215f, -0.703779519f,
+    -0.704134643f, -0.704489589f, -0.704844356f, -0.705198944f,
+    -0.705553353f, -0.705907583f, -0.706261635f, -0.706615508f,
+    -0.706969261f, -0.707322776f, -0.707676113f, -0.708029330f,
+    -0.708382308f, -0.708735168f, -0.709087789f, -0.709440291f,
+    -0.709792554f, -0.710144699f, -0.710496604f, -0.710848391f,
+    -0.711199939f, -0.711551368f, -0.711902618f, -0.712253630f,
+    -0.712604523f, -0.712955236f, -0.713305712f, -0.713656068f,
+    -0.714006245f, -0.714356184f, -0.714706004f, -0.715055645f,
+    -0.715405047f, -0.715754330f, -0.716103435f, -0.716452301f,
+    -0.716801047f, -0.717149615f, -0.717498004f, -0.717846155f,
+    -0.718194187f, -0.718542039f, -0.718889654f, -0.719237149f,
+    -0.719584405f, -0.719931543f, -0.720278442f, -0.720625222f,
+    -0.720971823f, -0.721318185f, -0.721664429f, -0.722010434f,
+    -0.722356260f, -0.722701967f, -0.723047435f, -0.723392725f,
+    -0.723737895f, -0.724082828f, -0.724427581f, -0.724772155f,
+    -0.725116551f, -0.725460827f, -0.725804865f, -0.726148725f,
+    -0.726492405f, -0.726835907f, -0.727179170f, -0.727522314f,
+    -0.727865279f, -0.728208065f, -0.728550613f, -0.728893042f,
+    -0.729235232f, -0.729577303f, -0.729919136f, -0.730260849f,
+    -0.730602324f, -0.730943620f, -0.731284738f, -0.731625736f,
+    -0.731966496f, -0.732307076f, -0.732647419f, -0.732987642f,
+    -0.733327687f, -0.733667552f, -0.734007180f, -0.734346688f,
+    -0.734685957f, -0.735025108f, -0.735364020f, -0.735702753f,
+    -0.736041307f, -0.736379683f, -0.736717880f, -0.737055898f,
+    -0.737393737f, -0.737731338f, -0.738068819f, -0.738406062f,
+    -0.738743186f, -0.739080071f, -0.739416778f, -0.739753306f,
+    -0.740089655f, -0.740425825f, -0.740761817f, -0.741097569f,
+    -0.741433203f, -0.741768599f, -0.742103875f, -0.742438912f,
+    -0.742773771f, -0.743108451f, -0.743442953f, -0.743777215f,
+    -0.744111359f, -0.744445324f, -0.744779050f, -0.745112598f,
+    -0.745445967f, -0.745779157f, -0.746112168f, -0.746445000f,
+    -0.746777654f, -0.747110069f, -0.747442305f, -0.747774422f,
+    -0.748106301f, -0.748438001f, -0.748769462f, -0.749100804f,
+    -0.749431968f, -0.749762893f, -0.750093639f, -0.750424206f,
+    -0.750754595f, -0.751084805f, -0.751414835f, -0.751744628f,
+    -0.752074242f, -0.752403736f, -0.752732992f, -0.753062010f,
+    -0.753390908f, -0.753719628f, -0.754048109f, -0.754376411f,
+    -0.754704535f, -0.755032480f, -0.755360246f, -0.755687773f,
+    -0.756015182f, -0.756342351f, -0.756669343f, -0.756996155f,
+    -0.757322788f, -0.757649183f, -0.757975459f, -0.758301497f,
+    -0.758627355f, -0.758952975f, -0.759278476f, -0.759603798f,
+    -0.759928882f, -0.760253787f, -0.760578513f, -0.760903001f,
+    -0.761227369f, -0.761551499f, -0.761875451f, -0.762199223f,
+    -0.762522817f, -0.762846172f, -0.763169408f, -0.763492405f,
+    -0.763815224f, -0.764137805f, -0.764460266f, -0.764782488f,
+    -0.765104532f, -0.765426397f, -0.765748084f, -0.766069531f,
+    -0.766390800f, -0.766711891f, -0.767032802f, -0.767353535f,
+    -0.767674029f, -0.767994344f, -0.768314481f, -0.768634439f,
+    -0.768954158f, -0.769273758f, -0.769593120f, -0.769912302f,
+    -0.770231247f, -0.770550013f, -0.770868659f, -0.771187007f,
+    -0.771505237f, -0.771823227f, -0.772141099f, -0.772458732f,
+    -0.772776127f, -0.773093402f, -0.773410439f, -0.773727298f,
+    -0.774043977f, -0.774360418f, -0.774676681f, -0.774992764f,
+    -0.775308669f, -0.775624335f, -0.775939882f, -0.776255190f,
+    -0.776570261f, -0.776885211f, -0.777199924f, -0.777514458f,
+    -0.777828813f, -0.778142929f, -0.778456867f, -0.778770626f,
+    -0.779084206f, -0.779397547f, -0.779710710f, -0.780023694f,
+    -0.780336440f, -0.780649066f, -0.780961454f, -0.781273603f,
+    -0.781585634f, -0.781897426f, -0.782209039f, -0.782520413f,
+    -0.782831669f, -0.783142686f, -0.783453524f, -0.783764124f,
+    -0.784074545f, -0.784384787f, -0.784694850f, -0.785004675f,
+    -0.785314322f, -0.785623789f, -0.785933018f, -0.786242068f,
+    -0.786550939f, -0.786859632f, -0.787168086f, -0.787476361f,
+    -0.787784398f, -0.788092315f, -0.788399994f, -0.788707435f,
+    -0.789014757f, -0.789321840f, -0.789628744f, -0.789935410f,
+    -0.790241897f, -0.790548205f, -0.790854335f, -0.791160226f,
+    -0.791465938f, -0.791771412f, -0.792076766f, -0.792381883f,
+    -0.792686760f, -0.792991459f, -0.793295979f, -0.793600321f,
+    -0.793904424f, -0.794208348f, -0.794512093f, -0.794815600f,
+    -0.795118928f, -0.795422077f, -0.795724988f, -0.796027720f,
+    -0.796330273f, -0.796632588f, -0.796934724f, -0.797236621f,
+    -0.797538400f, -0.797839940f, -0.798141241f, -0.798442364f,
+    -0.798743308f, -0.799044073f, -0.799344599f, -0.799644947f,
+    -0.799945056f, -0.800244987f, -0.800544739f, -0.800844252f,
+    -0.801143587f, -0.801442742f, -0.801741660f, -0.802040398f,
+    -0.802338958f, -0.802637279f, -0.802935421f, -0.803233385f,
+    -0.803531110f, -0.803828597f, -0.804125965f, -0.804423094f,
+    -0.804719985f, -0.805016756f, -0.805313230f, -0.805609584f,
+    -0.805905700f, -0.806201637f, -0.806497335f, -0.806792855f,
+    -0.807088196f, -0.807383299f, -0.807678223f, -0.807972908f,
+    -0.808267415f, -0.808561742f, -0.808855832f, -0.809149742f,
+    -0.809443414f, -0.809736967f, -0.810030222f, -0.810323298f,
+    -0.810616195f, -0.810908914f, -0.811201394f, -0.811493695f,
+    -0.811785758f, -0.812077641f, -0.812369287f, -0.812660754f,
+    -0.812952042f, -0.813243091f, -0.813533962f, -0.813824594f,
+    -0.814115047f, -0.814405322f, -0.814695358f, -0.814985216f,
+    -0.815274835f, -0.815564275f, -0.815853536f, -0.816142559f,
+    -0.816431344f, -0.816720009f, -0.817008376f, -0.817296624f,
+    -0.817584634f, -0.817872405f, -0.818159997f, -0.818447411f,
+    -0.818734586f, -0.819021583f, -0.819308341f, -0.819594920f,
+    -0.819881320f, -0.820167482f, -0.820453405f, -0.820739210f,
+    -0.821024716f, -0.821310103f, -0.821595192f, -0.821880162f,
+    -0.822164893f, -0.822449386f, -0.822733700f, -0.823017836f,
+    -0.823301733f, -0.823585451f, -0.823868930f, -0.824152231f,
+    -0.824435294f, -0.824718177f, -0.825000823f, -0.825283289f,
+    -0.825565577f, -0.825847626f, -0.826129436f, -0.826411068f,
+    -0.826692522f, -0.826973736f, -0.827254772f, -0.827535570f,
+    -0.827816188f, -0.828096569f, -0.828376770f, -0.828656733f,
+    -0.828936517f, -0.829216063f, -0.829495430f, -0.829774618f,
+    -0.830053508f, -0.830332279f, -0.830610812f, -0.830889106f,
+    -0.831167221f, -0.831445158f, -0.831722856f, -0.832000315f,
+    -0.832277596f, -0.832554698f, -0.832831562f, -0.833108246f,
+    -0.833384693f, -0.833660901f, -0.833936930f, -0.834212780f,
+    -0.834488392f, -0.834763825f, -0.835039020f, -0.835313976f,
+    -0.835588753f, -0.835863352f, -0.836137712f, -0.836411893f,
+    -0.836685836f, -0.836959541f, -0.837233067f, -0.837506413f,
+    -0.837779522f, -0.838052392f, -0.838325083f, -0.838597596f,
+    -0.838869870f, -0.839141905f, -0.839413762f, -0.839685380f,
+    -0.839956820f, -0.840228081f, -0.840499043f, -0.840769887f,
+    -0.841040432f, -0.841310859f, -0.841580987f, -0.841850996f,
+    -0.842120707f, -0.842390239f, -0.842659593f, -0.842928708f,
+    -0.843197644f, -0.843466341f, -0.843734801f, -0.844003081f,
+    -0.844271123f, -0.844538987f, -0.844806612f, -0.845074058f,
+    -0.845341265f, -0.845608294f, -0.845875084f, -0.846141696f,
+    -0.846408069f, -0.846674204f, -0.846940160f, -0.847205877f,
+    -0.847471416f, -0.847736716f, -0.848001838f, -0.848266721f,
+    -0.848531425f, -0.848795891f, -0.849060118f, -0.849324167f,
+    -0.849587977f, -0.849851608f, -0.850115001f, -0.850378215f,
+    -0.850641191f, -0.850903928f, -0.851166487f, -0.851428866f,
+    -0.851691008f, -0.851952910f, -0.852214575f, -0.852476060f,
+    -0.852737367f, -0.852998435f, -0.853259265f, -0.853519917f,
+    -0.853780329f, -0.854040563f, -0.854300559f, -0.854560316f,
+    -0.854819894f, -0.855079234f, -0.855338395f, -0.855597317f,
+    -0.855856061f, -0.856114566f, -0.856372833f, -0.856630921f,
+    -0.856888771f, -0.857146382f, -0.857403815f, -0.857661068f,
+    -0.857918024f, -0.858174801f, -0.858431399f, -0.858687758f,
+    -0.858943880f, -0.859199822f, -0.859455526f, -0.859711051f,
+    -0.859966338f, -0.860221386f, -0.860476255f, -0.860730886f,
+    -0.860985279f, -0.861239493f, -0.861493528f, -0.861747265f,
+    -0.862000823f, -0.862254202f, -0.862507284f, -0.862760246f,
+    -0.863012910f, -0.863265395f, -0.863517702f, -0.863769710f,
+    -0.864021540f, -0.864273190f, -0.864524603f, -0.864775777f,
+    -0.865026772f, -0.865277469f, -0.865528047f, -0.865778387f,
+    -0.866028488f, -0.866278350f, -0.866528034f, -0.866777480f,
+    -0.867026746f, -0.867275715f, -0.867524564f, -0.867773116f,
+    -0.868021488f, -0.868269682f, -0.868517578f, -0.868765295f,
+    -0.869012833f, -0.869260132f, -0.869507194f, -0.869754016f,
+    -0.870000660f, -0.870247066f, -0.870493293f, -0.870739281f,
+    -0.870985031f, -0.871230602f, -0.871475875f, -0.871721029f,
+    -0.871965885f, -0.872210562f, -0.872455060f, -0.872699261f,
+    -0.872943282f, -0.873187065f, -0.873430669f, -0.873674035f,
+    -0.873917162f, -0.874160111f, -0.874402821f, -0.874645293f,
+    -0.874887586f, -0.875129640f, -0.875371456f, -0.875613093f,
+    -0.875854492f, -0.876095653f, -0.876336634f, -0.876577377f,
+    -0.876817882f, -0.877058208f, -0.877298295f, -0.877538145f,
+    -0.877777755f, -0.878017187f, -0.878256440f, -0.878495395f,
+    -0.878734171f, -0.878972709f, -0.879211009f, -0.879449129f,
+    -0.879687011f, -0.879924715f, -0.880162120f, -0.880399346f,
+    -0.880636394f, -0.880873144f, -0.881109715f, -0.881346047f,
+    -0.881582201f, -0.881818116f, -0.882053792f, -0.882289231f,
+    -0.882524490f, -0.882759511f, -0.882994294f, -0.883228898f,
+    -0.883463264f, -0.883697391f, -0.883931339f, -0.884164989f,
+    -0.884398520f, -0.884631753f, -0.884864807f, -0.885097623f,
+    -0.885330200f, -0.885562539f, -0.885794699f, -0.886026621f,
+    -0.886258364f, -0.886489809f, -0.886721075f, -0.886952162f,
+    -0.887182951f, -0.887413561f, -0.887643933f, -0.887874067f,
+    -0.888104022f, -0.888333738f, -0.888563216f, -0.888792455f,
+    -0.889021516f, -0.889250338f, -0.889478922f, -0.889707327f,
+    -0.889935493f, -0.890163422f, -0.890391111f, -0.890618622f,
+    -0.890845895f, -0.891072929f, -0.891299725f, -0.891526341f,
+    -0.891752720f, -0.891978860f, -0.892204762f, -0.892430484f,
+    -0.892655969f, -0.892881215f, -0.893106222f, -0.893331051f,
+    -0.893555641f, -0.893779993f, -0.894004166f, -0.894228101f,
+    -0.894451737f, -0.894675255f, -0.894898474f, -0.895121515f,
+    -0.895344317f, -0.895566881f, -0.895789206f, -0.896011353f,
+    -0.896233261f, -0.896454930f, -0.896676421f, -0.896897614f,
+    -0.897118628f, -0.897339404f, -0.897560000f, -0.897780299f,
+    -0.898000419f, -0.898220301f, -0.898439944f, -0.898659408f,
+    -0.898878634f, -0.899097621f, -0.899316370f, -0.899534881f,
+    -0.899753213f, -0.899971306f, -0.900189161f, -0.900406778f,
+    -0.900624216f, -0.900841415f, -0.901058376f, -0.901275098f,
+    -0.901491582f, -0.901707888f, -0.901923954f, -0.902139783f,
+    -0.902355373f, -0.902570784f, -0.902785957f, -0.903000891f,
+    -0.903215587f, -0.903430045f, -0.903644323f, -0.903858364f,
+    -0.904072165f, -0.904285729f, -0.904499054f, -0.904712200f,
+    -0.904925108f, -0.905137777f, -0.905350208f, -0.905562460f,
+    -0.905774415f, -0.905986190f, -0.906197727f, -0.906409025f,
+    -0.906620145f, -0.906830966f, -0.907041609f, -0.907252014f,
+    -0.907462239f, -0.907672167f, -0.907881916f, -0.908091366f,
+    -0.908300638f, -0.908509731f, -0.908718526f, -0.908927143f,
+    -0.909135461f, -0.909343600f, -0.909551501f, -0.909759223f,
+    -0.909966648f, -0.910173893f, -0.910380900f, -0.910587668f,
+    -0.910794199f, -0.911000550f, -0.911206603f, -0.911412477f,
+    -0.911618114f, -0.911823511f, -0.912028670f, -0.912233651f,
+    -0.912438333f, -0.912642837f, -0.912847102f, -0.913051128f,
+    -0.913254976f, -0.913458526f, -0.913661897f, -0.913865030f,
+    -0.914067924f, -0.914270580f, -0.914472997f, -0.914675236f,
+    -0.914877236f, -0.915078938f, -0.915280461f, -0.915481806f,
+    -0.915682852f, -0.915883660f, -0.916084290f, -0.916284680f,
+    -0.916484833f, -0.916684747f, -0.916884422f, -0.917083859f,
+    -0.917283118f, -0.917482138f, -0.917680919f, -0.917879462f,
+    -0.918077767f, -0.918275833f, -0.918473721f, -0.918671310f,
+    -0.918868721f, -0.919065893f, -0.919262826f, -0.919459522f,
+    -0.919655979f, -0.919852257f, -0.920048296f, -0.920244038f,
+    -0.920439601f, -0.920634925f, -0.920830071f, -0.921024919f,
+    -0.921219528f, -0.921413958f, -0.921608150f, -0.921802104f,
+    -0.921995819f, -0.922189295f, -0.922382534f, -0.922575533f,
+    -0.922768354f, -0.922960877f, -0.923153222f, -0.923345327f,
+    -0.923537195f, -0.923728824f, -0.923920274f, -0.924111426f,
+    -0.924302399f, -0.924493074f, -0.924683571f, -0.924873829f,
+    -0.925063848f, -0.925253630f, -0.925443172f, -0.925632536f,
+    -0.925821602f, -0.926010489f, -0.926199138f, -0.926387548f,
+    -0.926575720f, -0.926763654f, -0.926951349f, -0.927138805f,
+    -0.927326083f, -0.927513063f, -0.927699864f, -0.927886367f,
+    -0.928072691f, -0.928258777f, -0.928444624f, -0.928630292f,
+    -0.928815663f, -0.929000795f, -0.929185748f, -0.929370403f,
+    -0.929554880f, -0.929739118f, -0.929923117f, -0.930106878f,
+    -0.930290401f, -0.930473685f, -0.930656731f, -0.930839598f,
+    -0.931022167f, -0.931204557f, -0.931386650f, -0.931568563f,
+    -0.931750238f, -0.931931674f, -0.932112873f, -0.932293832f,
+    -0.932474554f, -0.932655096f, -0.932835340f, -0.933015347f,
+    -0.933195174f, -0.933374763f, -0.933554053f, -0.933733165f,
+    -0.933912039f, -0.934090674f, -0.934269071f, -0.934447229f,
+    -0.934625208f, -0.934802890f, -0.934980333f, -0.935157597f,
+    -0.935334563f, -0.935511351f, -0.935687900f, -0.935864151f,
+    -0.936040223f, -0.936216056f, -0.936391652f, -0.936567008f,
+    -0.936742187f, -0.936917067f, -0.937091708f, -0.937266111f,
+    -0.937440336f, -0.937614262f, -0.937788010f, -0.937961459f,
+    -0.938134730f, -0.938307762f, -0.938480556f, -0.938653111f,
+    -0.938825428f, -0.938997507f, -0.939169347f, -0.939340949f,
+    -0.939512312f, -0.939683437f, -0.939854383f, -0.940025032f,
+    -0.940195441f, -0.940365672f, -0.940535605f, -0.940705359f,
+    -0.940874875f, -0.941044092f, -0.941213131f, -0.941381931f,
+    -0.941550493f, -0.941718817f, -0.941886902f, -0.942054749f,
+    -0.942222357f, -0.942389727f, -0.942556858f, -0.942723751f,
+    -0.942890406f, -0.943056881f, -0.943223059f, -0.943388999f,
+    -0.943554759f, -0.943720222f, -0.943885505f, -0.944050491f,
+    -0.944215298f, -0.944379866f, -0.944544137f, -0.944708228f,
+    -0.944872081f, -0.945035696f, -0.945199013f, -0.945362151f,
+    -0.945525050f, -0.945687711f, -0.945850134f, -0.946012318f,
+    -0.946174264f, -0.946335971f, -0.946497440f, -0.946658671f,
+    -0.946819663f, -0.946980476f, -0.947140992f, -0.947301269f,
+    -0.947461307f, -0.947621167f, -0.947780728f, -0.947940052f,
+    -0.948099136f, -0.948258042f, -0.948416650f, -0.948575079f,
+    -0.948733211f, -0.948891163f, -0.949048817f, -0.949206293f,
+    -0.949363470f, -0.949520469f, -0.949677169f, -0.949833691f,
+    -0.949989915f, -0.950145960f, -0.950301766f, -0.950457275f,
+    -0.950612605f, -0.950767696f, -0.950922489f, -0.951077104f,
+    -0.951231480f, -0.951385558f, -0.951539457f, -0.951693118f,
+    -0.951846480f, -0.951999664f, -0.952152610f, -0.952305317f,
+    -0.952457726f, -0.952609956f, -0.952761948f, -0.952913702f,
+    -0.953065217f, -0.953216434f, -0.953367472f, -0.953518271f,
+    -0.953668833f, -0.953819096f, -0.953969181f, -0.954119027f,
+    -0.954268634f, -0.954418004f, -0.954567075f, -0.954715967f,
+    -0.954864621f, -0.955013037f, -0.955161154f, -0.955309093f,
+    -0.955456793f, -0.955604255f, -0.955751419f, -0.955898404f,
+    -0.956045151f, -0.956191659f, -0.956337869f, -0.956483901f,
+    -0.956629694f, -0.956775188f, -0.956920505f, -0.957065523f,
+    -0.957210362f, -0.957354963f, -0.957499266f, -0.957643390f,
+    -0.957787216f, -0.957930863f, -0.958074212f, -0.958217382f,
+    -0.958360255f, -0.958502948f, -0.958645344f, -0.958787560f,
+    -0.958929479f, -0.959071159f, -0.959212661f, -0.959353864f,
+    -0.959494829f, -0.959635615f, -0.959776103f, -0.959916353f,
+    -0.960056365f, -0.960196197f, -0.960335732f, -0.960475028f,
+    -0.960614085f, -0.960752904f, -0.960891485f, -0.961029828f,
+    -0.961167932f, -0.961305797f, -0.961443424f, -0.961580813f,
+    -0.961717963f, -0.961854815f, -0.961991489f, -0.962127924f,
+    -0.962264121f, -0.962400019f, -0.962535739f, -0.962671161f,
+    -0.962806404f, -0.962941408f, -0.963076115f, -0.963210583f,
+    -0.963344872f, -0.963478863f, -0.963612676f, -0.963746190f,
+    -0.963879466f, -0.964012504f, -0.964145303f, -0.964277864f,
+    -0.964410245f, -0.964542329f, -0.964674175f, -0.964805722f,
+    -0.964937091f, -0.965068221f, -0.965199113f, -0.965329766f,
+    -0.965460122f, -0.965590298f, -0.965720236f, -0.965849876f,
+    -0.965979338f, -0.966108501f, -0.966237426f, -0.966366172f,
+    -0.966494620f, -0.966622829f, -0.966750801f, -0.966878533f,
+    -0.967006087f, -0.967133343f, -0.967260301f, -0.967387080f,
+    -0.967513621f, -0.967639923f, -0.967765987f, -0.967891753f,
+    -0.968017340f, -0.968142629f, -0.968267739f, -0.968392551f,
+    -0.968517184f, -0.968641520f, -0.968765616f, -0.968889475f,
+    -0.969013095f, -0.969136477f, -0.969259620f, -0.969382524f,
+    -0.969505191f, -0.969627619f, -0.969749808f, -0.969871700f,
+    -0.969993412f, -0.970114827f, -0.970236063f, -0.970357001f,
+    -0.970477700f, -0.970598221f, -0.970718443f, -0.970838428f,
+    -0.970958173f, -0.971077681f, -0.971196949f, -0.971315920f,
+    -0.971434712f, -0.971553266f, -0.971671522f, -0.971789598f,
+    -0.971907377f, -0.972024977f, -0.972142279f, -0.972259343f,
+    -0.972376168f, -0.972492754f, -0.972609103f, -0.972725213f,
+    -0.972841084f, -0.972956657f, -0.973072052f, -0.973187208f,
+    -0.973302066f, -0.973416686f, -0.973531127f, -0.973645270f,
+    -0.973759174f, -0.973872840f, -0.973986268f, -0.974099457f,
+    -0.974212408f, -0.974325061f, -0.974437535f, -0.974549770f,
+    -0.974661708f, -0.974773407f, -0.974884927f, -0.974996150f,
+    -0.975107133f, -0.975217879f, -0.975328386f, -0.975438654f,
+    -0.975548625f, -0.975658417f, -0.975767970f, -0.975877225f,
+    -0.975986242f, -0.976095080f, -0.976203620f, -0.976311922f,
+    -0.976419985f, -0.976527810f, -0.976635396f, -0.976742685f,
+    -0.976849794f, -0.976956606f, -0.977063239f, -0.977169573f,
+    -0.977275670f, -0.977381527f, -0.977487147f, -0.977592528f,
+    -0.977697670f, -0.977802575f, -0.977907181f, -0.978011608f,
+    -0.978115737f, -0.978219628f, -0.978323340f, -0.978426754f,
+    -0.978529930f, -0.978632867f, -0.978735507f, -0.978837967f,
+    -0.978940189f, -0.979042113f, -0.979143798f, -0.979245305f,
+    -0.979346514f, -0.979447484f, -0.979548216f, -0.979648709f,
+    -0.979748905f, -0.979848921f, -0.979948640f, -0.980048180f,
+    -0.980147421f, -0.980246425f, -0.980345190f, -0.980443716f,
+    -0.980542004f, -0.980640054f, -0.980737805f, -0.980835378f,
+    -0.980932653f, -0.981029689f, -0.981126547f, -0.981223106f,
+    -0.981319368f, -0.981415451f, -0.981511295f, -0.981606841f,
+    -0.981702209f, -0.981797278f, -0.981892109f, -0.981986761f,
+    -0.982081056f, -0.982175171f, -0.982269049f, -0.982362688f,
+    -0.982456028f, -0.982549191f, -0.982642055f, -0.982734680f,
+    -0.982827067f, -0.982919216f, -0.983011127f, -0.983102739f,
+    -0.983194172f, -0.983285308f, -0.983376205f, -0.983466864f,
+    -0.983557284f, -0.983647466f, -0.983737409f, -0.983827114f,
+    -0.983916521f, -0.984005749f, -0.984094679f, -0.984183371f,
+    -0.984271824f, -0.984360039f, -0.984448016f, -0.984535694f,
+    -0.984623194f, -0.984710395f, -0.984797359f, -0.984884083f,
+    -0.984970570f, -0.985056818f, -0.985142827f, -0.985228598f,
+    -0.985314071f, -0.985399306f, -0.985484302f, -0.985569060f,
+    -0.985653579f, -0.985737860f, -0.985821903f, -0.985905647f,
+    -0.985989213f, -0.986072481f, -0.986155510f, -0.986238301f,
+    -0.986320853f, -0.986403108f, -0.986485183f, -0.986566961f,
+    -0.986648560f, -0.986729860f, -0.986810923f, -0.986891747f,
+    -0.986972272f, -0.987052619f, -0.987132668f, -0.987212539f,
+    -0.987292111f, -0.987371445f, -0.987450540f, -0.987529337f,
+    -0.987607956f, -0.987686276f, -0.987764418f, -0.987842262f,
+    -0.987919867f, -0.987997234f, -0.988074362f, -0.988151193f,
+    -0.988227844f, -0.988304198f, -0.988380313f, -0.988456190f,
+    -0.988531828f, -0.988607228f, -0.988682330f, -0.988757253f,
+    -0.988831878f, -0.988906264f, -0.988980412f, -0.989054322f,
+    -0.989127934f, -0.989201367f, -0.989274502f, -0.989347458f,
+    -0.989420116f, -0.989492536f, -0.989564657f, -0.989636600f,
+    -0.989708304f, -0.989779711f, -0.989850879f, -0.989921808f,
+    -0.989992499f, -0.990062952f, -0.990133107f, -0.990203083f,
+    -0.990272760f, -0.990342200f, -0.990411401f, -0.990480363f,
+    -0.990549028f, -0.990617514f, -0.990685701f, -0.990753651f,
+    -0.990821421f, -0.990888834f, -0.990956068f, -0.991023064f,
+    -0.991089761f, -0.991156220f, -0.991222441f, -0.991288424f,
+    -0.991354167f, -0.991419673f, -0.991484880f, -0.991549850f,
+    -0.991614640f, -0.991679132f, -0.991743326f, -0.991807342f,
+    -0.991871119f, -0.991934597f, -0.991997838f, -0.992060840f,
+    -0.992123604f, -0.992186129f, -0.992248356f, -0.992310405f,
+    -0.992372155f, -0.992433667f, -0.992494941f, -0.992555916f,
+    -0.992616713f, -0.992677212f, -0.992737532f, -0.992797554f,
+    -0.992857337f, -0.992916822f, -0.992976129f, -0.993035138f,
+    -0.993093967f, -0.993152499f, -0.993210793f, -0.993268788f,
+    -0.993326604f, -0.993384123f, -0.993441463f, -0.993498504f,
+    -0.993555307f, -0.993611813f, -0.993668139f, -0.993724167f,
+    -0.993780017f, -0.993835568f, -0.993890882f, -0.993945897f,
+    -0.994000733f, -0.994055271f, -0.994109631f, -0.994163692f,
+    -0.994217515f, -0.994271040f, -0.994324386f, -0.994377434f,
+    -0.994430244f, -0.994482875f, -0.994535148f, -0.994587243f,
+    -0.994639099f, -0.994690657f, -0.994741976f, -0.994793057f,
+    -0.994843900f, -0.994894505f, -0.994944811f, -0.994994938f,
+    -0.995044768f, -0.995094359f, -0.995143652f, -0.995192766f,
+    -0.995241642f, -0.995290220f, -0.995338559f, -0.995386660f,
+    -0.995434523f, -0.995482087f, -0.995529473f, -0.995576560f,
+    -0.995623410f, -0.995670021f, -0.995716333f, -0.995762467f,
+    -0.995808303f, -0.995853961f, -0.995899320f, -0.995944381f,
+    -0.995989263f, -0.996033847f, -0.996078253f, -0.996122360f,
+    -0.996166229f, -0.996209860f, -0.996253192f, -0.996296287f,
+    -0.996339202f, -0.996381819f, -0.996424198f, -0.996466279f,
+    -0.996508181f, -0.996549785f, -0.996591151f, -0.996632278f,
+    -0.996673167f, -0.996713817f, -0.996754169f, -0.996794283f,
+    -0.996834159f, -0.996873796f, -0.996913195f, -0.996952295f,
+    -0.996991217f, -0.997029841f, -0.997068226f, -0.997106373f,
+    -0.997144222f, -0.997181892f, -0.997219265f, -0.997256398f,
+    -0.997293293f, -0.997329950f, -0.997366309f, -0.997402430f,
+    -0.997438312f, -0.997473955f, -0.997509360f, -0.997544527f,
+    -0.997579396f, -0.997614026f, -0.997648418f, -0.997682571f,
+    -0.997716486f, -0.997750103f, -0.997783542f, -0.997816682f,
+    -0.997849584f, -0.997882247f, -0.997914612f, -0.997946739f,
+    -0.997978687f, -0.998010337f, -0.998041749f, -0.998072863f,
+    -0.998103797f, -0.998134434f, -0.998164833f, -0.998194993f,
+    -0.998224854f, -0.998254538f, -0.998283923f, -0.998313069f,
+    -0.998341978f, -0.998370647f, -0.998399079f, -0.998427212f,
+    -0.998455107f, -0.998482764f, -0.998510182f, -0.998537362f,
+    -0.998564243f, -0.998590887f, -0.998617351f, -0.998643458f,
+    -0.998669386f, -0.998695076f, -0.998720467f, -0.998745620f,
+    -0.998770535f, -0.998795211f, -0.998819590f, -0.998843789f,
+    -0.998867691f, -0.998891354f, -0.998914778f, -0.998937905f,
+    -0.998960853f, -0.998983502f, -0.999005914f, -0.999028087f,
+    -0.999049962f, -0.999071658f, -0.999093056f, -0.999114215f,
+    -0.999135137f, -0.999155819f, -0.999176204f, -0.999196410f,
+    -0.999216318f, -0.999235988f, -0.999255419f, -0.999274552f,
+    -0.999293506f, -0.999312162f, -0.999330580f, -0.999348760f,
+    -0.999366641f, -0.999384344f, -0.999401748f, -0.999418914f,
+    -0.999435842f, -0.999452472f, -0.999468923f, -0.999485075f,
+    -0.999500990f, -0.999516666f, -0.999532104f, -0.999547243f,
+    -0.999562144f, -0.999576867f, -0.999591231f, -0.999605417f,
+    -0.999619365f, -0.999633014f, -0.999646425f, -0.999659598f,
+    -0.999672532f, -0.999685168f, -0.999697626f, -0.999709785f,
+    -0.999721706f, -0.999733388f, -0.999744773f, -0.999755979f,
+    -0.999766886f, -0.999777555f, -0.999787986f, -0.999798179f,
+    -0.999808073f, -0.999817729f, -0.999827147f, -0.999836326f,
+    -0.999845266f, -0.999853909f, -0.999862373f, -0.999870539f,
+    -0.999878466f, -0.999886096f, -0.999893546f, -0.999900699f,
+    -0.999907613f, -0.999914289f, -0.999920726f, -0.999926865f,
+    -0.999932826f, -0.999938488f, -0.999943912f, -0.999949098f,
+    -0.999953985f, -0.999958634f, -0.999963105f, -0.999967277f,
+    -0.999971151f, -0.999974847f, -0.999978244f, -0.999981463f,
+    -0.999984384f, -0.999987006f, -0.999989450f, -0.999991596f,
+    -0.999993563f, -0.999995232f, -0.999996662f, -0.999997795f,
+    -0.999998748f, -0.999999404f, -0.999999821f, -1.00000000f,
+};
+
+#endif
+
+static const FLOAT ath_16000[HBLKSIZE] = {
+    144.904205f, 101.394760f, 58.2325706f, 42.0985107f,
+    33.4416695f, 27.9724216f, 24.1742401f, 21.3678322f,
+    19.2012272f, 17.4729309f, 16.0588722f, 14.8782673f,
+    13.8761454f, 13.0137367f, 12.2628765f, 11.6025839f,
+    11.0168953f, 10.4934340f, 10.0224533f, 9.59616566f,
+    9.20826912f, 8.85360813f, 8.52792072f, 8.22765255f,
+    7.94981194f, 7.69186497f, 7.45164776f, 7.22730207f,
+    7.01722145f, 6.82001162f, 6.63445282f, 6.45947552f,
+    6.29413748f, 6.13760328f, 5.98913193f, 5.84806061f,
+    5.71379805f, 5.58581161f, 5.46362209f, 5.34679556f,
+    5.23493958f, 5.12769747f, 5.02474260f, 4.92577887f,
+    4.83053303f, 4.73875570f, 4.65021563f, 4.56470156f,
+    4.48201656f, 4.40197945f, 4.32442045f, 4.24918365f,
+    4.17612267f, 4.10510015f, 4.03598928f, 3.96867013f,
+    3.90302992f, 3.83896327f, 3.77637053f, 3.71515799f,
+    3.65523648f, 3.59652233f, 3.53893542f, 3.48240018f,
+    3.42684460f, 3.37220025f, 3.31840134f, 3.26538563f,
+    3.21309328f, 3.16146660f, 3.11045122f, 3.05999422f,
+    3.01004457f, 2.96055365f, 2.91147447f, 2.86276150f,
+    2.81437111f, 2.76626086f, 2.71838999f, 2.67071843f,
+    2.62320805f, 2.57582164f, 2.52852321f, 2.48127770f,
+    2.43405104f, 2.38681030f, 2.33952332f, 2.29215908f,
+    2.24468732f, 2.19707870f, 2.14930439f, 2.10133719f,
+    2.05314970f, 2.00471592f, 1.95601058f, 1.90700901f,
+    1.85768747f, 1.80802286f, 1.75799298f, 1.70757627f,
+    1.65675187f, 1.60549974f, 1.55380094f, 1.50163662f,
+    1.44898951f, 1.39584243f, 1.34217942f, 1.28798509f,
+    1.23324525f, 1.17794609f, 1.12207496f, 1.06561995f,
+    1.00856996f, 0.950914979f, 0.892645717f, 0.833753943f,
+    0.774232209f, 0.714074135f, 0.653274298f, 0.591828227f,
+    0.529732466f, 0.466984540f, 0.403583080f, 0.339527667f,
+    0.274819016f, 0.209458828f, 0.143449962f, 0.0767963454f,
+    0.00950301997f, -0.0584238656f, -0.126977026f, -0.196148053f,
+    -0.265927345f, -0.336304218f, -0.407266766f, -0.478801966f,
+    -0.550895572f, -0.623532236f, -0.696695328f, -0.770367205f,
+    -0.844528913f, -0.919160426f, -0.994240403f, -1.06974661f,
+    -1.14565539f, -1.22194207f, -1.29858088f, -1.37554491f,
+    -1.45280600f, -1.53033519f, -1.60810220f, -1.68607581f,
+    -1.76422358f, -1.84251249f, -1.92090821f, -1.99937534f,
+    -2.07787800f, -2.15637875f, -2.23484015f, -2.31322312f,
+    -2.39148808f, -2.46959496f, -2.54750228f, -2.62516880f,
+    -2.70255208f, -2.77960896f, -2.85629582f, -2.93256879f,
+    -3.00838327f, -3.08369422f, -3.15845680f, -3.23262477f,
+    -3.30615282f, -3.37899446f, -3.45110345f, -3.52243376f,
+    -3.59293842f, -3.66257167f, -3.73128676f, -3.79903746f,
+    -3.86577773f, -3.93146205f, -3.99604464f, -4.05948019f,
+    -4.12172413f, -4.18273258f, -4.24246120f, -4.30086660f,
+    -4.35790730f, -4.41354036f, -4.46772480f, -4.52042103f,
+    -4.57158899f, -4.62119055f, -4.66918802f, -4.71554518f,
+    -4.76022625f, -4.80319691f, -4.84442425f, -4.88387632f,
+    -4.92152262f, -4.95733309f, -4.99128056f, -5.02333832f,
+    -5.05348063f, -5.08168411f, -5.10792685f, -5.13218737f,
+    -5.15444756f, -5.17468882f, -5.19289637f, -5.20905495f,
+    -5.22315216f, -5.23517704f, -5.24512053f, -5.25297499f,
+    -5.25873423f, -5.26239395f, -5.26395273f, -5.26340866f,
+    -5.26076365f, -5.25602007f, -5.24918222f, -5.24025679f,
+    -5.22925138f, -5.21617508f, -5.20104027f, -5.18385887f,
+    -5.16464615f, -5.14341831f, -5.12019253f, -5.09498835f,
+    -5.06782675f, -5.03873014f, -5.00772285f, -4.97482920f,
+    -4.94007683f, -4.90349340f, -4.86510849f, -4.82495260f,
+    -4.78305769f, -4.73945713f, -4.69418430f, -4.64727592f,
+    -4.59876728f, -4.54869652f, -4.49710131f, -4.44402122f,
+    -4.38949633f, -4.33356714f, -4.27627563f, -4.21766329f,
+    -4.15777397f, -4.09665060f, -4.03433704f, -3.97087717f,
+    -3.90631628f, -3.84069920f, -3.77407122f, -3.70647764f,
+    -3.63796449f, -3.56857729f, -3.49836159f, -3.42736363f,
+    -3.35562873f, -3.28320265f, -3.21013069f, -3.13645816f,
+    -3.06222987f, -2.98749042f, -2.91228390f, -2.83665395f,
+    -2.76064420f, -2.68429732f, -2.60765553f, -2.53076029f,
+    -2.45365286f, -2.37637329f, -2.29896140f, -2.22145581f,
+    -2.14389491f, -2.06631565f, -1.98875451f, -1.91124713f,
+    -1.83382797f, -1.75653100f, -1.67938876f, -1.60243309f,
+    -1.52569497f, -1.44920397f, -1.37298906f, -1.29707801f,
+    -1.22149730f, -1.14627290f, -1.07142925f, -0.996989846f,
+    -0.922977149f, -0.849412680f, -0.776316583f, -0.703708112f,
+    -0.631605387f, -0.560025573f, -0.488984555f, -0.418497294f,
+    -0.348577708f, -0.279238582f, -0.210491747f, -0.142347932f,
+    -0.0748169050f, -0.00790743157f, 0.0583727248f, 0.124016754f,
+    0.189018801f, 0.253373951f, 0.317078173f, 0.380128354f,
+    0.442522287f, 0.504258513f, 0.565336525f, 0.625756502f,
+    0.685519576f, 0.744627416f, 0.803082645f, 0.860888422f,
+    0.918048680f, 0.974568009f, 1.03045166f, 1.08570540f,
+    1.14033556f, 1.19434929f, 1.24775410f, 1.30055773f,
+    1.35276902f, 1.40439665f, 1.45545006f, 1.50593913f,
+    1.55587387f, 1.60526478f, 1.65412295f, 1.70245922f,
+    1.75028515f, 1.79761243f, 1.84445286f, 1.89081872f,
+    1.93672228f, 1.98217595f, 2.02719235f, 2.07178450f,
+    2.11596465f, 2.15974641f, 2.20314217f, 2.24616551f,
+    2.28882909f, 2.33114600f, 2.37312961f, 2.41479278f,
+    2.45614839f, 2.49720955f, 2.53798914f, 2.57849979f,
+    2.61875415f, 2.65876508f, 2.69854474f, 2.73810577f,
+    2.77746010f, 2.81661963f, 2.85559630f, 2.89440179f,
+    2.93304777f, 2.97154546f, 3.00990558f, 3.04813933f,
+    3.08625746f, 3.12427020f, 3.16218781f, 3.20002031f,
+    3.23777723f, 3.27546859f, 3.31310296f, 3.35069013f,
+    3.38823819f, 3.42575598f, 3.46325159f, 3.50073338f,
+    3.53820848f, 3.57568502f, 3.61316967f, 3.65066981f,
+    3.68819189f, 3.72574258f, 3.76332760f, 3.80095339f,
+    3.83862543f, 3.87634921f, 3.91412950f, 3.95197177f,
+    3.98988032f, 4.02785969f, 4.06591368f, 4.10404682f,
+    4.14226246f, 4.18056393f, 4.21895504f, 4.25743771f,
+    4.29601574f, 4.33469105f, 4.37346601f, 4.41234303f,
+    4.45132351f, 4.49040890f, 4.52960157f, 4.56890249f,
+    4.60831213f, 4.64783144f, 4.68746185f, 4.72720289f,
+    4.76705551f, 4.80701923f, 4.84709454f, 4.88728094f,
+    4.92757750f, 4.96798468f, 5.00850105f, 5.04912615f,
+    5.08985853f, 5.13069677f, 5.17163992f, 5.21268654f,
+    5.25383472f, 5.29508305f, 5.33642960f, 5.37787151f,
+    5.41940784f, 5.46103525f, 5.50275230f, 5.54455566f,
+    5.58644342f, 5.62841225f, 5.67045975f, 5.71258307f,
+    5.75477886f, 5.79704380f, 5.83937550f, 5.88176966f,
+    5.92422390f, 5.96673393f, 6.00929689f, 6.05190897f,
+    6.09456587f, 6.13726473f, 6.18000126f, 6.22277164f,
+    6.26557207f, 6.30839825f, 6.35124636f, 6.39411211f,
+    6.43699169f, 6.47988081f, 6.52277517f, 6.56567001f,
+    6.60856152f, 6.65144539f, 6.69431734f, 6.73717213f,
+    6.78000641f, 6.82281446f, 6.86559296f, 6.90833616f,
+    6.95104074f, 6.99370146f, 7.03631353f, 7.07887316f,
+    7.12137461f, 7.16381407f, 7.20618677f, 7.24848795f,
+    7.29071331f, 7.33285761f, 7.37491655f, 7.41688538f,
+    7.45875978f, 7.50053453f, 7.54220533f, 7.58376789f,
+    7.62521744f, 7.66654921f, 7.70775843f, 7.74884129f,
+    7.78979254f, 7.83060837f, 7.87128401f, 7.91181469f,
+    7.95219612f, 7.99242449f, 8.03249454f, 8.07240295f,
+    8.11214447f, 8.15171528f, 8.19111156f, 8.23032856f,
+    8.26936245f, 8.30820942f, 8.34686470f, 8.38532448f,
+    8.42358589f, 8.46164322f, 8.49949455f, 8.53713417f,
+    8.57456017f, 8.61176777f, 8.64875412f, 8.68551540f,
+    8.72204685f,
+};
+
+static const FLOAT ath_22050[HBLKSIZE] = {
+    144.904205f, 78.4467468f, 45.0521355f, 32.5689774f,
+    25.8708687f, 21.6389389f, 18.6998596f, 16.5280628f,
+    14.8512287f, 13.5134573f, 12.4187498f, 11.5045996f,
+    10.7284727f, 10.0603685f, 9.47848892f, 8.96659565f,
+    8.51233101f, 8.10611343f, 7.74039459f, 7.40914106f,
+    7.10747051f, 6.83138466f, 6.57757711f, 6.34328938f,
+    6.12619686f, 5.92432880f, 5.73600101f, 5.55976391f,
+    5.39436245f, 5.23870611f, 5.09183884f, 4.95291901f,
+    4.82120371f, 4.69603205f, 4.57681561f, 4.46302700f,
+    4.35419083f, 4.24987888f, 4.14970255f, 4.05330896f,
+    3.96037531f, 3.87060618f, 3.78372955f, 3.69949532f,
+    3.61767173f, 3.53804421f, 3.46041226f, 3.38458943f,
+    3.31040049f, 3.23768234f, 3.16627979f, 3.09604788f,
+    3.02684903f, 2.95855212f, 2.89103413f, 2.82417655f,
+    2.75786734f, 2.69199944f, 2.62646985f, 2.56118107f,
+    2.49603844f, 2.43095160f, 2.36583424f, 2.30060267f,
+    2.23517752f, 2.16948104f, 2.10343981f, 2.03698325f,
+    1.97004247f, 1.90255296f, 1.83445132f, 1.76567829f,
+    1.69617712f, 1.62589276f, 1.55477464f, 1.48277307f,
+    1.40984261f, 1.33594072f, 1.26102626f, 1.18506324f,
+    1.10801637f, 1.02985537f, 0.950552821f, 0.870083213f,
+    0.788426161f, 0.705563068f, 0.621479869f, 0.536166310f,
+    0.449614227f, 0.361821145f, 0.272786349f, 0.182514459f,
+    0.0910140574f, -0.00170336198f, -0.0956222638f, -0.190722018f,
+    -0.286978394f, -0.384362996f, -0.482842088f, -0.582381129f,
+    -0.682937920f, -0.784467340f, -0.886919737f, -0.990240395f,
+    -1.09437370f, -1.19925654f, -1.30482268f, -1.41100204f,
+    -1.51771927f, -1.62489867f, -1.73245716f, -1.84030926f,
+    -1.94836581f, -2.05653310f, -2.16471767f, -2.27281904f,
+    -2.38073540f, -2.48836160f, -2.59558916f, -2.70231056f,
+    -2.80841208f, -2.91377997f, -3.01829791f, -3.12184739f,
+    -3.22431183f, -3.32557011f, -3.42550182f, -3.52398539f,
+    -3.62089849f, -3.71612191f, -3.80953336f, -3.90101218f,
+    -3.99043918f, -4.07769442f, -4.16266298f, -4.24522877f,
+    -4.32527828f, -4.40270090f, -4.47738743f, -4.54923391f,
+    -4.61813736f, -4.68399858f, -4.74672318f, -4.80621862f,
+    -4.86239910f, -4.91518164f, -4.96448851f, -5.01024532f,
+    -5.05238485f, -5.09084415f, -5.12556553f, -5.15649700f,
+    -5.18359232f, -5.20681047f, -5.22611713f, -5.24148464f,
+    -5.25288963f, -5.26031590f, -5.26375341f, -5.26319885f,
+    -5.25865364f, -5.25012732f, -5.23763418f, -5.22119570f,
+    -5.20083809f, -5.17659521f, -5.14850521f, -5.11661386f,
+    -5.08097124f, -5.04163313f, -4.99866104f, -4.95212126f,
+    -4.90208626f, -4.84863234f, -4.79183960f, -4.73179388f,
+    -4.66858482f, -4.60230637f, -4.53305578f, -4.46093273f,
+    -4.38604116f, -4.30848837f, -4.22838259f, -4.14583683f,
+    -4.06096315f, -3.97387671f, -3.88469625f, -3.79353619f,
+    -3.70051932f, -3.60576105f, -3.50938559f, -3.41151023f,
+    -3.31225276f, -3.21173620f, -3.11007476f, -3.00739050f,
+    -2.90379667f, -2.79940605f, -2.69433618f, -2.58869290f,
+    -2.48259044f, -2.37613249f, -2.26942086f, -2.16256142f,
+    -2.05564809f, -1.94878078f, -1.84204948f, -1.73554075f,
+    -1.62934494f, -1.52353919f, -1.41820681f, -1.31342018f,
+    -1.20924807f, -1.10576212f, -1.00302148f, -0.901090026f,
+    -0.800021112f, -0.699864328f, -0.600671947f, -0.502483606f,
+    -0.405343741f, -0.309286535f, -0.214342430f, -0.120544478f,
+    -0.0279137157f, 0.0635241494f, 0.153753102f, 0.242760390f,
+    0.330530763f, 0.417059988f, 0.502339244f, 0.586368501f,
+    0.669150531f, 0.750685394f, 0.830983222f, 0.910049319f,
+    0.987897038f, 1.06454170f, 1.13999569f, 1.21428061f,
+    1.28741276f, 1.35941553f, 1.43031394f, 1.50012958f,
+    1.56889176f, 1.63662517f, 1.70335996f, 1.76912749f,
+    1.83395529f, 1.89787793f, 1.96092474f, 2.02312994f,
+    2.08452797f, 2.14515018f, 2.20503259f, 2.26420712f,
+    2.32270932f, 2.38057423f, 2.43783379f, 2.49452424f,
+    2.55067682f, 2.60632658f, 2.66150737f, 2.71624970f,
+    2.77058792f, 2.82455111f, 2.87817168f, 2.93148112f,
+    2.98450661f, 3.03727937f, 3.08982539f, 3.14217329f,
+    3.19435048f, 3.24638081f, 3.29829097f, 3.35010314f,
+    3.40184093f, 3.45352817f, 3.50518346f, 3.55682945f,
+    3.60848355f, 3.66016483f, 3.71189213f, 3.76367998f,
+    3.81554604f, 3.86750269f, 3.91956496f, 3.97174692f,
+    4.02405787f, 4.07651186f, 4.12911654f, 4.18188190f,
+    4.23481798f, 4.28793049f, 4.34122753f, 4.39471388f,
+    4.44839573f, 4.50227833f, 4.55636311f, 4.61065578f,
+    4.66515589f, 4.71986675f, 4.77478981f, 4.82992315f,
+    4.88526917f, 4.94082403f, 4.99658775f, 5.05255890f,
+    5.10873270f, 5.16510820f, 5.22167921f, 5.27844238f,
+    5.33539486f, 5.39252806f, 5.44983959f, 5.50732040f,
+    5.56496525f, 5.62276840f, 5.68072033f, 5.73881578f,
+    5.79704380f, 5.85539818f, 5.91387081f, 5.97245026f,
+    6.03113031f, 6.08989811f, 6.14874601f, 6.20766497f,
+    6.26664209f, 6.32566929f, 6.38473415f, 6.44382620f,
+    6.50293636f, 6.56205082f, 6.62116051f, 6.68025160f,
+    6.73931408f, 6.79833698f, 6.85730696f, 6.91621351f,
+    6.97504330f, 7.03378439f, 7.09242725f, 7.15095615f,
+    7.20936251f, 7.26763105f, 7.32575083f, 7.38371134f,
+    7.44149780f, 7.49910069f, 7.55650520f, 7.61370039f,
+    7.67067575f, 7.72741699f, 7.78391457f, 7.84015465f,
+    7.89612579f, 7.95181847f, 8.00721836f, 8.06231689f,
+    8.11709976f, 8.17155838f, 8.22568130f, 8.27945614f,
+    8.33287525f, 8.38592434f, 8.43859482f, 8.49087811f,
+    8.54276180f, 8.59423828f, 8.64529610f, 8.69592667f,
+    8.74612141f, 8.79587269f, 8.84516811f, 8.89400101f,
+    8.94236374f, 8.99024868f, 9.03764915f, 9.08455467f,
+    9.13096046f, 9.17685795f, 9.22224236f, 9.26710892f,
+    9.31144714f, 9.35525322f, 9.39852333f, 9.44125080f,
+    9.48343372f, 9.52506351f, 9.56613827f, 9.60665417f,
+    9.64660740f, 9.68599701f, 9.72481632f, 9.76306438f,
+    9.80074024f, 9.83784103f, 9.87436771f, 9.91031551f,
+    9.94568443f, 9.98047638f, 10.0146894f, 10.0483265f,
+    10.0813847f, 10.1138668f, 10.1457729f, 10.1771069f,
+    10.2078714f, 10.2380657f, 10.2676935f, 10.2967596f,
+    10.3252659f, 10.3532181f, 10.3806171f, 10.4074707f,
+    10.4337816f, 10.4595556f, 10.4848003f, 10.5095177f,
+    10.5337162f, 10.5574026f, 10.5805826f, 10.6032658f,
+    10.6254559f, 10.6471624f, 10.6683941f, 10.6891584f,
+    10.7094660f, 10.7293224f, 10.7487392f, 10.7677250f,
+    10.7862902f, 10.8044453f, 10.8221998f, 10.8395643f,
+    10.8565493f, 10.8731661f, 10.8894281f, 10.9053440f,
+    10.9209261f, 10.9361868f, 10.9511395f, 10.9657955f,
+    10.9801664f, 10.9942665f, 11.0081081f, 11.0217047f,
+    11.0350695f, 11.0482159f, 11.0611572f, 11.0739079f,
+    11.0864811f, 11.0988913f, 11.1111526f, 11.1232796f,
+    11.1352863f, 11.1471863f, 11.1589966f, 11.1707287f,
+    11.1823997f, 11.1940231f, 11.2056141f, 11.2171879f,
+    11.2287588f, 11.2403421f, 11.2519531f, 11.2636070f,
+    11.2753181f, 11.2871008f, 11.2989712f, 11.3109436f,
+    11.3230333f, 11.3352566f, 11.3476267f, 11.3601580f,
+    11.3728666f, 11.3857670f, 11.3988733f, 11.4122009f,
+    11.4257641f, 11.4395771f, 11.4536552f, 11.4680119f,
+    11.4826612f, 11.4976177f, 11.5128946f, 11.5285063f,
+    11.5444679f, 11.5607910f, 11.5774899f, 11.5945768f,
+    11.6120672f, 11.6299734f, 11.6483059f, 11.6670809f,
+    11.6863079f, 11.7060013f, 11.7261744f, 11.7468357f,
+    11.7680006f, 11.7896776f, 11.8118811f, 11.8346214f,
+    11.8579092f, 11.8817558f, 11.9061718f, 11.9311686f,
+    11.9567556f, 11.9829435f, 12.0097418f, 12.0371599f,
+    12.0652084f,
+};
+
+static const FLOAT ath_24000[HBLKSIZE] = {
+    144.904205f, 73.3043442f, 42.0985107f, 30.4334564f,
+    24.1742401f, 20.2195415f, 17.4729309f, 15.4432907f,
+    13.8761454f, 12.6258125f, 11.6025839f, 10.7480478f,
+    10.0224533f, 9.39776421f, 8.85360813f, 8.37480831f,
+    7.94981194f, 7.56966257f, 7.22730207f, 6.91708803f,
+    6.63445282f, 6.37565613f, 6.13760328f, 5.91770983f,
+    5.71379805f, 5.52402020f, 5.34679556f, 5.18076277f,
+    5.02474260f, 4.87770748f, 4.73875570f, 4.60709333f,
+    4.48201656f, 4.36290026f, 4.24918365f, 4.14036465f,
+    4.03598928f, 3.93564677f, 3.83896327f, 3.74559736f,
+    3.65523648f, 3.56759262f, 3.48240018f, 3.39941263f,
+    3.31840134f, 3.23915267f, 3.16146660f, 3.08515620f,
+    3.01004457f, 2.93596554f, 2.86276150f, 2.79028368f,
+    2.71838999f, 2.64694548f, 2.57582164f, 2.50489593f,
+    2.43405104f, 2.36317444f, 2.29215908f, 2.22090197f,
+    2.14930439f, 2.07727242f, 2.00471592f, 1.93154824f,
+    1.85768747f, 1.78305495f, 1.70757627f, 1.63118052f,
+    1.55380094f, 1.47537446f, 1.39584243f, 1.31514955f,
+    1.23324525f, 1.15008283f, 1.06561995f, 0.979818702f,
+    0.892645717f, 0.804072201f, 0.714074135f, 0.622632265f,
+    0.529732466f, 0.435365558f, 0.339527667f, 0.242220208f,
+    0.143449962f, 0.0432292894f, -0.0584238656f, -0.161485881f,
+    -0.265927345f, -0.371713072f, -0.478801966f, -0.587146997f,
+    -0.696695328f, -0.807388067f, -0.919160426f, -1.03194165f,
+    -1.14565539f, -1.26021910f, -1.37554491f, -1.49153900f,
+    -1.60810220f, -1.72512996f, -1.84251249f, -1.96013510f,
+    -2.07787800f, -2.19561672f, -2.31322312f, -2.43056369f,
+    -2.54750228f, -2.66389847f, -2.77960896f, -2.89448667f,
+    -3.00838327f, -3.12114692f, -3.23262477f, -3.34266233f,
+    -3.45110345f, -3.55779219f, -3.66257167f, -3.76528549f,
+    -3.86577773f, -3.96389389f, -4.05948019f, -4.15238571f,
+    -4.24246120f, -4.32956028f, -4.41354036f, -4.49426126f,
+    -4.57158899f, -4.64539242f, -4.71554518f, -4.78192759f,
+    -4.84442425f, -4.90292692f, -4.95733309f, -5.00754738f,
+    -5.05348063f, -5.09505177f, -5.13218737f, -5.16482162f,
+    -5.19289637f, -5.21636200f, -5.23517704f, -5.24930906f,
+    -5.25873423f, -5.26343632f, -5.26340866f, -5.25865364f,
+    -5.24918222f, -5.23501348f, -5.21617508f, -5.19270468f,
+    -5.16464615f, -5.13205385f, -5.09498835f, -5.05351877f,
+    -5.00772285f, -4.95768356f, -4.90349340f, -4.84525013f,
+    -4.78305769f, -4.71702766f, -4.64727592f, -4.57392502f,
+    -4.49710131f, -4.41693687f, -4.33356714f, -4.24713182f,
+    -4.15777397f, -4.06563997f, -3.97087717f, -3.87363696f,
+    -3.77407122f, -3.67233324f, -3.56857729f, -3.46295762f,
+    -3.35562873f, -3.24674463f, -3.13645816f, -3.02492118f,
+    -2.91228390f, -2.79869390f, -2.68429732f, -2.56923699f,
+    -2.45365286f, -2.33768153f, -2.22145581f, -2.10510516f,
+    -1.98875451f, -1.87252438f, -1.75653100f, -1.64088571f,
+    -1.52569497f, -1.41106033f, -1.29707801f, -1.18383908f,
+    -1.07142925f, -0.959928811f, -0.849412680f, -0.739950180f,
+    -0.631605387f, -0.524436712f, -0.418497294f, -0.313834846f,
+    -0.210491747f, -0.108505249f, -0.00790743157f, 0.0912746415f,
+    0.189018801f, 0.285307646f, 0.380128354f, 0.473472655f,
+    0.565336525f, 0.655720055f, 0.744627416f, 0.832066476f,
+    0.918048680f, 1.00258887f, 1.08570540f, 1.16741908f,
+    1.24775410f, 1.32673693f, 1.40439665f, 1.48076451f,
+    1.55587387f, 1.62975979f, 1.70245922f, 1.77401042f,
+    1.84445286f, 1.91382754f, 1.98217595f, 2.04954076f,
+    2.11596465f, 2.18149161f, 2.24616551f, 2.31002998f,
+    2.37312961f, 2.43550825f, 2.49720955f, 2.55827713f,
+    2.61875415f, 2.67868304f, 2.73810577f, 2.79706335f,
+    2.85559630f, 2.91374421f, 2.97154546f, 3.02903771f,
+    3.08625746f, 3.14324021f, 3.20002031f, 3.25663042f,
+    3.31310296f, 3.36946845f, 3.42575598f, 3.48199368f,
+    3.53820848f, 3.59442592f, 3.65066981f, 3.70696330f,
+    3.76332760f, 3.81978321f, 3.87634921f, 3.93304253f,
+    3.98988032f, 4.04687691f, 4.10404682f, 4.16140223f,
+    4.21895504f, 4.27671480f, 4.33469105f, 4.39289141f,
+    4.45132351f, 4.50999212f, 4.56890249f, 4.62805796f,
+    4.68746185f, 4.74711514f, 4.80701923f, 4.86717367f,
+    4.92757750f, 4.98822927f, 5.04912615f, 5.11026430f,
+    5.17163992f, 5.23324823f, 5.29508305f, 5.35713863f,
+    5.41940784f, 5.48188305f, 5.54455566f, 5.60741806f,
+    5.67045975f, 5.73367214f, 5.79704380f, 5.86056519f,
+    5.92422390f, 5.98800898f, 6.05190897f, 6.11591053f,
+    6.18000126f, 6.24416828f, 6.30839825f, 6.37267733f,
+    6.43699169f, 6.50132751f, 6.56567001f, 6.63000488f,
+    6.69431734f, 6.75859213f, 6.82281446f, 6.88696909f,
+    6.95104074f, 7.01501369f, 7.07887316f, 7.14260244f,
+    7.20618677f, 7.26961040f, 7.33285761f, 7.39591265f,
+    7.45875978f, 7.52138329f, 7.58376789f, 7.64589834f,
+    7.70775843f, 7.76933384f, 7.83060837f, 7.89156771f,
+    7.95219612f, 8.01247978f, 8.07240295f, 8.13195133f,
+    8.19111156f, 8.24986839f, 8.30820942f, 8.36611938f,
+    8.42358589f, 8.48059464f, 8.53713417f, 8.59319210f,
+    8.64875412f, 8.70380974f, 8.75834656f, 8.81235409f,
+    8.86582088f, 8.91873550f, 8.97108841f, 9.02286911f,
+    9.07406807f, 9.12467575f, 9.17468452f, 9.22408485f,
+    9.27286816f, 9.32102776f, 9.36855698f, 9.41544724f,
+    9.46169376f, 9.50728989f, 9.55222988f, 9.59650993f,
+    9.64012337f, 9.68306828f, 9.72533989f, 9.76693535f,
+    9.80785179f, 9.84808731f, 9.88763905f, 9.92650795f,
+    9.96469116f, 10.0021896f, 10.0390024f, 10.0751324f,
+    10.1105785f, 10.1453438f, 10.1794291f, 10.2128391f,
+    10.2455759f, 10.2776432f, 10.3090448f, 10.3397865f,
+    10.3698721f, 10.3993082f, 10.4280996f, 10.4562550f,
+    10.4837799f, 10.5106821f, 10.5369692f, 10.5626507f,
+    10.5877342f, 10.6122303f, 10.6361475f, 10.6594973f,
+    10.6822891f, 10.7045345f, 10.7262449f, 10.7474318f,
+    10.7681084f, 10.7882862f, 10.8079796f, 10.8271999f,
+    10.8459625f, 10.8642817f, 10.8821707f, 10.8996439f,
+    10.9167185f, 10.9334078f, 10.9497280f, 10.9656963f,
+    10.9813271f, 10.9966383f, 11.0116453f, 11.0263672f,
+    11.0408192f, 11.0550194f, 11.0689850f, 11.0827351f,
+    11.0962868f, 11.1096592f, 11.1228695f, 11.1359358f,
+    11.1488791f, 11.1617155f, 11.1744661f, 11.1871481f,
+    11.1997824f, 11.2123861f, 11.2249804f, 11.2375822f,
+    11.2502136f, 11.2628918f, 11.2756367f, 11.2884684f,
+    11.3014059f, 11.3144674f, 11.3276739f, 11.3410435f,
+    11.3545961f, 11.3683500f, 11.3823252f, 11.3965397f,
+    11.4110136f, 11.4257641f, 11.4408121f, 11.4561739f,
+    11.4718695f, 11.4879160f, 11.5043325f, 11.5211363f,
+    11.5383453f, 11.5559778f, 11.5740509f, 11.5925808f,
+    11.6115856f, 11.6310825f, 11.6510878f, 11.6716166f,
+    11.6926870f, 11.7143135f, 11.7365131f, 11.7593002f,
+    11.7826900f, 11.8066988f, 11.8313398f, 11.8566275f,
+    11.8825769f, 11.9092016f, 11.9365149f, 11.9645309f,
+    11.9932613f, 12.0227194f, 12.0529194f, 12.0838709f,
+    12.1155872f, 12.1480789f, 12.1813593f, 12.2154369f,
+    12.2503242f, 12.2860317f, 12.3225679f, 12.3599443f,
+    12.3981695f, 12.4372530f, 12.4772043f, 12.5180302f,
+    12.5597410f, 12.6023445f, 12.6458473f, 12.6902580f,
+    12.7355824f, 12.7818298f, 12.8290043f, 12.8771133f,
+    12.9261627f, 12.9761591f, 13.0271072f, 13.0790119f,
+    13.1318789f, 13.1857128f, 13.2405176f, 13.2962980f,
+    13.3530579f, 13.4108000f, 13.4695292f, 13.5292482f,
+    13.5899601f, 13.6516666f, 13.7143717f, 13.7780771f,
+    13.8427849f, 13.9084969f, 13.9752150f, 14.0429401f,
+    14.1116753f,
+};
+
+static const FLOAT ath_32000[HBLKSIZE] = {
+    144.904205f, 58.2325706f, 33.4416695f, 24.1742401f,
+    19.2012272f, 16.0588722f, 13.8761454f, 12.2628765f,
+    11.0168953f, 10.0224533f, 9.20826912f, 8.52792072f,
+    7.94981194f, 7.45164776f, 7.01722145f, 6.63445282f,
+    6.29413748f, 5.98913193f, 5.71379805f, 5.46362209f,
+    5.23493958f, 5.02474260f, 4.83053303f, 4.65021563f,
+    4.48201656f, 4.32442045f, 4.17612267f, 4.03598928f,
+    3.90302992f, 3.77637053f, 3.65523648f, 3.53893542f,
+    3.42684460f, 3.31840134f, 3.21309328f, 3.11045122f,
+    3.01004457f, 2.91147447f, 2.81437111f, 2.71838999f,
+    2.62320805f, 2.52852321f, 2.43405104f, 2.33952332f,
+    2.24468732f, 2.14930439f, 2.05314970f, 1.95601058f,
+    1.85768747f, 1.75799298f, 1.65675187f, 1.55380094f,
+    1.44898951f, 1.34217942f, 1.23324525f, 1.12207496f,
+    1.00856996f, 0.892645717f, 0.774232209f, 0.653274298f,
+    0.529732466f, 0.403583080f, 0.274819016f, 0.143449962f,
+    0.00950301997f, -0.126977026f, -0.265927345f, -0.407266766f,
+    -0.550895572f, -0.696695328f, -0.844528913f, -0.994240403f,
+    -1.14565539f, -1.29858088f, -1.45280600f, -1.60810220f,
+    -1.76422358f, -1.92090821f, -2.07787800f, -2.23484015f,
+    -2.39148808f, -2.54750228f, -2.70255208f, -2.85629582f,
+    -3.00838327f, -3.15845680f, -3.30615282f, -3.45110345f,
+    -3.59293842f, -3.73128676f, -3.86577773f, -3.99604464f,
+    -4.12172413f, -4.24246120f, -4.35790730f, -4.46772480f,
+    -4.57158899f, -4.66918802f, -4.76022625f, -4.84442425f,
+    -4.92152262f, -4.99128056f, -5.05348063f, -5.10792685f,
+    -5.15444756f, -5.19289637f, -5.22315216f, -5.24512053f,
+    -5.25873423f, -5.26395273f, -5.26076365f, -5.24918222f,
+    -5.22925138f, -5.20104027f, -5.16464615f, -5.12019253f,
+    -5.06782675f, -5.00772285f, -4.94007683f, -4.86510849f,
+    -4.78305769f, -4.69418430f, -4.59876728f, -4.49710131f,
+    -4.38949633f, -4.27627563f, -4.15777397f, -4.03433704f,
+    -3.90631628f, -3.77407122f, -3.63796449f, -3.49836159f,
+    -3.35562873f, -3.21013069f, -3.06222987f, -2.91228390f,
+    -2.76064420f, -2.60765553f, -2.45365286f, -2.29896140f,
+    -2.14389491f, -1.98875451f, -1.83382797f, -1.67938876f,
+    -1.52569497f, -1.37298906f, -1.22149730f, -1.07142925f,
+    -0.922977149f, -0.776316583f, -0.631605387f, -0.488984555f,
+    -0.348577708f, -0.210491747f, -0.0748169050f, 0.0583727248f,
+    0.189018801f, 0.317078173f, 0.442522287f, 0.565336525f,
+    0.685519576f, 0.803082645f, 0.918048680f, 1.03045166f,
+    1.14033556f, 1.24775410f, 1.35276902f, 1.45545006f,
+    1.55587387f, 1.65412295f, 1.75028515f, 1.84445286f,
+    1.93672228f, 2.02719235f, 2.11596465f, 2.20314217f,
+    2.28882909f, 2.37312961f, 2.45614839f, 2.53798914f,
+    2.61875415f, 2.69854474f, 2.77746010f, 2.85559630f,
+    2.93304777f, 3.00990558f, 3.08625746f, 3.16218781f,
+    3.23777723f, 3.31310296f, 3.38823819f, 3.46325159f,
+    3.53820848f, 3.61316967f, 3.68819189f, 3.76332760f,
+    3.83862543f, 3.91412950f, 3.98988032f, 4.06591368f,
+    4.14226246f, 4.21895504f, 4.29601574f, 4.37346601f,
+    4.45132351f, 4.52960157f, 4.60831213f, 4.68746185f,
+    4.76705551f, 4.84709454f, 4.92757750f, 5.00850105f,
+    5.08985853f, 5.17163992f, 5.25383472f, 5.33642960f,
+    5.41940784f, 5.50275230f, 5.58644342f, 5.67045975f,
+    5.75477886f, 5.83937550f, 5.92422390f, 6.00929689f,
+    6.09456587f, 6.18000126f, 6.26557207f, 6.35124636f,
+    6.43699169f, 6.52277517f, 6.60856152f, 6.69431734f,
+    6.78000641f, 6.86559296f, 6.95104074f, 7.03631353f,
+    7.12137461f, 7.20618677f, 7.29071331f, 7.37491655f,
+    7.45875978f, 7.54220533f, 7.62521744f, 7.70775843f,
+    7.78979254f, 7.87128401f, 7.95219612f, 8.03249454f,
+    8.11214447f, 8.19111156f, 8.26936245f, 8.34686470f,
+    8.42358589f, 8.49949455f, 8.57456017f, 8.64875412f,
+    8.72204685f, 8.79441166f, 8.86582088f, 8.93624973f,
+    9.00567245f, 9.07406807f, 9.14141273f, 9.20768547f,
+    9.27286816f, 9.33694172f, 9.39988899f, 9.46169376f,
+    9.52234268f, 9.58182335f, 9.64012337f, 9.69723415f,
+    9.75314522f, 9.80785179f, 9.86134720f, 9.91362762f,
+    9.96469116f, 10.0145369f, 10.0631647f, 10.1105785f,
+    10.1567812f, 10.2017775f, 10.2455759f, 10.2881842f,
+    10.3296118f, 10.3698721f, 10.4089766f, 10.4469404f,
+    10.4837799f, 10.5195122f, 10.5541563f, 10.5877342f,
+    10.6202660f, 10.6517763f, 10.6822891f, 10.7118301f,
+    10.7404270f, 10.7681084f, 10.7949038f, 10.8208447f,
+    10.8459625f, 10.8702917f, 10.8938646f, 10.9167185f,
+    10.9388876f, 10.9604120f, 10.9813271f, 11.0016737f,
+    11.0214911f, 11.0408192f, 11.0597000f, 11.0781746f,
+    11.0962868f, 11.1140795f, 11.1315956f, 11.1488791f,
+    11.1659746f, 11.1829271f, 11.1997824f, 11.2165842f,
+    11.2333794f, 11.2502136f, 11.2671318f, 11.2841806f,
+    11.3014059f, 11.3188524f, 11.3365679f, 11.3545961f,
+    11.3729830f, 11.3917732f, 11.4110136f, 11.4307461f,
+    11.4510174f, 11.4718695f, 11.4933462f, 11.5154905f,
+    11.5383453f, 11.5619526f, 11.5863523f, 11.6115856f,
+    11.6376934f, 11.6647148f, 11.6926870f, 11.7216492f,
+    11.7516384f, 11.7826900f, 11.8148413f, 11.8481255f,
+    11.8825769f, 11.9182291f, 11.9551134f, 11.9932613f,
+    12.0327034f, 12.0734692f, 12.1155872f, 12.1590843f,
+    12.2039881f, 12.2503242f, 12.2981176f, 12.3473921f,
+    12.3981695f, 12.4504738f, 12.5043240f, 12.5597410f,
+    12.6167450f, 12.6753531f, 12.7355824f, 12.7974510f,
+    12.8609724f, 12.9261627f, 12.9930363f, 13.0616035f,
+    13.1318789f, 13.2038727f, 13.2775955f, 13.3530579f,
+    13.4302664f, 13.5092316f, 13.5899601f, 13.6724577f,
+    13.7567310f, 13.8427849f, 13.9306240f, 14.0202532f,
+    14.1116753f, 14.2048922f, 14.2999058f, 14.3967199f,
+    14.4953337f, 14.5957470f, 14.6979618f, 14.8019772f,
+    14.9077911f, 15.0154028f, 15.1248102f, 15.2360125f,
+    15.3490057f, 15.4637880f, 15.5803556f, 15.6987057f,
+    15.8188334f, 15.9407358f, 16.0644093f, 16.1898460f,
+    16.3170471f, 16.4460030f, 16.5767097f, 16.7091618f,
+    16.8433571f, 16.9792862f, 17.1169472f, 17.2563324f,
+    17.3974380f, 17.5402546f, 17.6847820f, 17.8310108f,
+    17.9789352f, 18.1285534f, 18.2798557f, 18.4328384f,
+    18.5874958f, 18.7438221f, 18.9018135f, 19.0614624f,
+    19.2227669f, 19.3857174f, 19.5503139f, 19.7165470f,
+    19.8844147f, 20.0539131f, 20.2250366f, 20.3977795f,
+    20.5721397f, 20.7481136f, 20.9256973f, 21.1048851f,
+    21.2856750f, 21.4680653f, 21.6520500f, 21.8376274f,
+    22.0247955f, 22.2135506f, 22.4038925f, 22.5958157f,
+    22.7893219f, 22.9844055f, 23.1810684f, 23.3793087f,
+    23.5791245f, 23.7805138f, 23.9834766f, 24.1880131f,
+    24.3941212f, 24.6018028f, 24.8110561f, 25.0218830f,
+    25.2342815f, 25.4482536f, 25.6638012f, 25.8809242f,
+    26.0996208f, 26.3198967f, 26.5417519f, 26.7651863f,
+    26.9902039f, 27.2168045f, 27.4449902f, 27.6747665f,
+    27.9061317f, 28.1390915f, 28.3736477f, 28.6098022f,
+    28.8475571f, 29.0869179f, 29.3278866f, 29.5704670f,
+    29.8146629f, 30.0604763f, 30.3079128f, 30.5569763f,
+    30.8076687f, 31.0599976f, 31.3139629f, 31.5695724f,
+    31.8268280f, 32.0857391f, 32.3463020f, 32.6085281f,
+    32.8724213f, 33.1379852f, 33.4052277f, 33.6741486f,
+    33.9447556f, 34.2170563f, 34.4910545f, 34.7667542f,
+    35.0441589f, 35.3232803f, 35.6041222f, 35.8866882f,
+    36.1709824f, 36.4570160f, 36.7447929f, 37.0343170f,
+    37.3255959f, 37.6186333f, 37.9134407f, 38.2100182f,
+    38.5083771f, 38.8085213f, 39.1104546f, 39.4141884f,
+    39.7197266f,
+};
+
+static const FLOAT ath_44100[HBLKSIZE] = {
+    144.904205f, 45.0521355f, 25.8708687f, 18.6998596f,
+    14.8512287f, 12.4187498f, 10.7284727f, 9.47848892f,
+    8.51233101f, 7.74039459f, 7.10747051f, 6.57757711f,
+    6.12619686f, 5.73600101f, 5.39436245f, 5.09183884f,
+    4.82120371f, 4.57681561f, 4.35419083f, 4.14970255f,
+    3.96037531f, 3.78372955f, 3.61767173f, 3.46041226f,
+    3.31040049f, 3.16627979f, 3.02684903f, 2.89103413f,
+    2.75786734f, 2.62646985f, 2.49603844f, 2.36583424f,
+    2.23517752f, 2.10343981f, 1.97004247f, 1.83445132f,
+    1.69617712f, 1.55477464f, 1.40984261f, 1.26102626f,
+    1.10801637f, 0.950552821f, 0.788426161f, 0.621479869f,
+    0.449614227f, 0.272786349f, 0.0910140574f, -0.0956222638f,
+    -0.286978394f, -0.482842088f, -0.682937920f, -0.886919737f,
+    -1.09437370f, -1.30482268f, -1.51771927f, -1.73245716f,
+    -1.94836581f, -2.16471767f, -2.38073540f, -2.59558916f,
+    -2.80841208f, -3.01829791f, -3.22431183f, -3.42550182f,
+    -3.62089849f, -3.80953336f, -3.99043918f, -4.16266298f,
+    -4.32527828f, -4.47738743f, -4.61813736f, -4.74672318f,
+    -4.86239910f, -4.96448851f, -5.05238485f, -5.12556553f,
+    -5.18359232f, -5.22611713f, -5.25288963f, -5.26375341f,
+    -5.25865364f, -5.23763418f, -5.20083809f, -5.14850521f,
+    -5.08097124f, -4.99866104f, -4.90208626f, -4.79183960f,
+    -4.66858482f, -4.53305578f, -4.38604116f, -4.22838259f,
+    -4.06096315f, -3.88469625f, -3.70051932f, -3.50938559f,
+    -3.31225276f, -3.11007476f, -2.90379667f, -2.69433618f,
+    -2.48259044f, -2.26942086f, -2.05564809f, -1.84204948f,
+    -1.62934494f, -1.41820681f, -1.20924807f, -1.00302148f,
+    -0.800021112f, -0.600671947f, -0.405343741f, -0.214342430f,
+    -0.0279137157f, 0.153753102f, 0.330530763f, 0.502339244f,
+    0.669150531f, 0.830983222f, 0.987897038f, 1.13999569f,
+    1.28741276f, 1.43031394f, 1.56889176f, 1.70335996f,
+    1.83395529f, 1.96092474f, 2.08452797f, 2.20503259f,
+    2.32270932f, 2.43783379f, 2.55067682f, 2.66150737f,
+    2.77058792f, 2.87817168f, 2.98450661f, 3.08982539f,
+    3.19435048f, 3.29829097f, 3.40184093f, 3.50518346f,
+    3.60848355f, 3.71189213f, 3.81554604f, 3.91956496f,
+    4.02405787f, 4.12911654f, 4.23481798f, 4.34122753f,
+    4.44839573f, 4.55636311f, 4.66515589f, 4.77478981f,
+    4.88526917f, 4.99658775f, 5.10873270f, 5.22167921f,
+    5.33539486f, 5.44983959f, 5.56496525f, 5.68072033f,
+    5.79704380f, 5.91387081f, 6.03113031f, 6.14874601f,
+    6.26664209f, 6.38473415f, 6.50293636f, 6.62116051f,
+    6.73931408f, 6.85730696f, 6.97504330f, 7.09242725f,
+    7.20936251f, 7.32575083f, 7.44149780f, 7.55650520f,
+    7.67067575f, 7.78391457f, 7.89612579f, 8.00721836f,
+    8.11709976f, 8.22568130f, 8.33287525f, 8.43859482f,
+    8.54276180f, 8.64529610f, 8.74612141f, 8.84516811f,
+    8.94236374f, 9.03764915f, 9.13096046f, 9.22224236f,
+    9.31144714f, 9.39852333f, 9.48343372f, 9.56613827f,
+    9.64660740f, 9.72481632f, 9.80074024f, 9.87436771f,
+    9.94568443f, 10.0146894f, 10.0813847f, 10.1457729f,
+    10.2078714f, 10.2676935f, 10.3252659f, 10.3806171f,
+    10.4337816f, 10.4848003f, 10.5337162f, 10.5805826f,
+    10.6254559f, 10.6683941f, 10.7094660f, 10.7487392f,
+    10.7862902f, 10.8221998f, 10.8565493f, 10.8894281f,
+    10.9209261f, 10.9511395f, 10.9801664f, 11.0081081f,
+    11.0350695f, 11.0611572f, 11.0864811f, 11.1111526f,
+    11.1352863f, 11.1589966f, 11.1823997f, 11.2056141f,
+    11.2287588f, 11.2519531f, 11.2753181f, 11.2989712f,
+    11.3230333f, 11.3476267f, 11.3728666f, 11.3988733f,
+    11.4257641f, 11.4536552f, 11.4826612f, 11.5128946f,
+    11.5444679f, 11.5774899f, 11.6120672f, 11.6483059f,
+    11.6863079f, 11.7261744f, 11.7680006f, 11.8118811f,
+    11.8579092f, 11.9061718f, 11.9567556f, 12.0097418f,
+    12.0652084f, 12.1232338f, 12.1838865f, 12.2472401f,
+    12.3133554f, 12.3822975f, 12.4541264f, 12.5288935f,
+    12.6066542f, 12.6874552f, 12.7713423f, 12.8583603f,
+    12.9485435f, 13.0419321f, 13.1385555f, 13.2384443f,
+    13.3416271f, 13.4481249f, 13.5579634f, 13.6711550f,
+    13.7877178f, 13.9076700f, 14.0310154f, 14.1577682f,
+    14.2879314f, 14.4215097f, 14.5585108f, 14.6989279f,
+    14.8427677f, 14.9900198f, 15.1406841f, 15.2947588f,
+    15.4522285f, 15.6130943f, 15.7773390f, 15.9449558f,
+    16.1159382f, 16.2902679f, 16.4679375f, 16.6489277f,
+    16.8332310f, 17.0208340f, 17.2117157f, 17.4058704f,
+    17.6032753f, 17.8039207f, 18.0077934f, 18.2148724f,
+    18.4251518f, 18.6386070f, 18.8552303f, 19.0750103f,
+    19.2979259f, 19.5239735f, 19.7531281f, 19.9853859f,
+    20.2207394f, 20.4591656f, 20.7006645f, 20.9452171f,
+    21.1928177f, 21.4434643f, 21.6971359f, 21.9538383f,
+    22.2135506f, 22.4762745f, 22.7420101f, 23.0107403f,
+    23.2824726f, 23.5571918f, 23.8349018f, 24.1156063f,
+    24.3992920f, 24.6859703f, 24.9756298f, 25.2682762f,
+    25.5639172f, 25.8625412f, 26.1641674f, 26.4687805f,
+    26.7763958f, 27.0870247f, 27.4006538f, 27.7173080f,
+    28.0369759f, 28.3596725f, 28.6854134f, 29.0141907f,
+    29.3460274f, 29.6809177f, 30.0188789f, 30.3599281f,
+    30.7040596f, 31.0512981f, 31.4016438f, 31.7551098f,
+    32.1117210f, 32.4714699f, 32.8343887f, 33.2004700f,
+    33.5697365f, 33.9422150f, 34.3178940f, 34.6968079f,
+    35.0789566f, 35.4643593f, 35.8530426f, 36.2450066f,
+    36.6402740f, 37.0388527f, 37.4407654f, 37.8460312f,
+    38.2546577f, 38.6666718f, 39.0820732f, 39.5008888f,
+    39.9231339f, 40.3488464f, 40.7780075f, 41.2106476f,
+    41.6467896f, 42.0864487f, 42.5296631f, 42.9764061f,
+    43.4267235f, 43.8806305f, 44.3381424f, 44.7992973f,
+    45.2640800f, 45.7325211f, 46.2046432f, 46.6804619f,
+    47.1600227f, 47.6432953f, 48.1303253f, 48.6211319f,
+    49.1157265f, 49.6141586f, 50.1163979f, 50.6224899f,
+    51.1324501f, 51.6463013f, 52.1640854f, 52.6857719f,
+    53.2114067f, 53.7410088f, 54.2746010f, 54.8122215f,
+    55.3538437f, 55.8995132f, 56.4492493f, 57.0030746f,
+    57.5610275f, 58.1230850f, 58.6892853f, 59.2596550f,
+    59.8342133f, 60.4130058f, 60.9959984f, 61.5832405f,
+    62.1747513f, 62.7705498f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f,
+};
+
+static const FLOAT ath_48000[HBLKSIZE] = {
+    144.904205f, 42.0985107f, 24.1742401f, 17.4729309f,
+    13.8761454f, 11.6025839f, 10.0224533f, 8.85360813f,
+    7.94981194f, 7.22730207f, 6.63445282f, 6.13760328f,
+    5.71379805f, 5.34679556f, 5.02474260f, 4.73875570f,
+    4.48201656f, 4.24918365f, 4.03598928f, 3.83896327f,
+    3.65523648f, 3.48240018f, 3.31840134f, 3.16146660f,
+    3.01004457f, 2.86276150f, 2.71838999f, 2.57582164f,
+    2.43405104f, 2.29215908f, 2.14930439f, 2.00471592f,
+    1.85768747f, 1.70757627f, 1.55380094f, 1.39584243f,
+    1.23324525f, 1.06561995f, 0.892645717f, 0.714074135f,
+    0.529732466f, 0.339527667f, 0.143449962f, -0.0584238656f,
+    -0.265927345f, -0.478801966f, -0.696695328f, -0.919160426f,
+    -1.14565539f, -1.37554491f, -1.60810220f, -1.84251249f,
+    -2.07787800f, -2.31322312f, -2.54750228f, -2.77960896f,
+    -3.00838327f, -3.23262477f, -3.45110345f, -3.66257167f,
+    -3.86577773f, -4.05948019f, -4.24246120f, -4.41354036f,
+    -4.57158899f, -4.71554518f, -4.84442425f, -4.95733309f,
+    -5.05348063f, -5.13218737f, -5.19289637f, -5.23517704f,
+    -5.25873423f, -5.26340866f, -5.24918222f, -5.21617508f,
+    -5.16464615f, -5.09498835f, -5.00772285f, -4.90349340f,
+    -4.78305769f, -4.64727592f, -4.49710131f, -4.33356714f,
+    -4.15777397f, -3.97087717f, -3.77407122f, -3.56857729f,
+    -3.35562873f, -3.13645816f, -2.91228390f, -2.68429732f,
+    -2.45365286f, -2.22145581f, -1.98875451f, -1.75653100f,
+    -1.52569497f, -1.29707801f, -1.07142925f, -0.849412680f,
+    -0.631605387f, -0.418497294f, -0.210491747f, -0.00790743157f,
+    0.189018801f, 0.380128354f, 0.565336525f, 0.744627416f,
+    0.918048680f, 1.08570540f, 1.24775410f, 1.40439665f,
+    1.55587387f, 1.70245922f, 1.84445286f, 1.98217595f,
+    2.11596465f, 2.24616551f, 2.37312961f, 2.49720955f,
+    2.61875415f, 2.73810577f, 2.85559630f, 2.97154546f,
+    3.08625746f, 3.20002031f, 3.31310296f, 3.42575598f,
+    3.53820848f, 3.65066981f, 3.76332760f, 3.87634921f,
+    3.98988032f, 4.10404682f, 4.21895504f, 4.33469105f,
+    4.45132351f, 4.56890249f, 4.68746185f, 4.80701923f,
+    4.92757750f, 5.04912615f, 5.17163992f, 5.29508305f,
+    5.41940784f, 5.54455566f, 5.67045975f, 5.79704380f,
+    5.92422390f, 6.05190897f, 6.18000126f, 6.30839825f,
+    6.43699169f, 6.56567001f, 6.69431734f, 6.82281446f,
+    6.95104074f, 7.07887316f, 7.20618677f, 7.33285761f,
+    7.45875978f, 7.58376789f, 7.70775843f, 7.83060837f,
+    7.95219612f, 8.07240295f, 8.19111156f, 8.30820942f,
+    8.42358589f, 8.53713417f, 8.64875412f, 8.75834656f,
+    8.86582088f, 8.97108841f, 9.07406807f, 9.17468452f,
+    9.27286816f, 9.36855698f, 9.46169376f, 9.55222988f,
+    9.64012337f, 9.72533989f, 9.80785179f, 9.88763905f,
+    9.96469116f, 10.0390024f, 10.1105785f, 10.1794291f,
+    10.2455759f, 10.3090448f, 10.3698721f, 10.4280996f,
+    10.4837799f, 10.5369692f, 10.5877342f, 10.6361475f,
+    10.6822891f, 10.7262449f, 10.7681084f, 10.8079796f,
+    10.8459625f, 10.8821707f, 10.9167185f, 10.9497280f,
+    10.9813271f, 11.0116453f, 11.0408192f, 11.0689850f,
+    11.0962868f, 11.1228695f, 11.1488791f, 11.1744661f,
+    11.1997824f, 11.2249804f, 11.2502136f, 11.2756367f,
+    11.3014059f, 11.3276739f, 11.3545961f, 11.3823252f,
+    11.4110136f, 11.4408121f, 11.4718695f, 11.5043325f,
+    11.5383453f, 11.5740509f, 11.6115856f, 11.6510878f,
+    11.6926870f, 11.7365131f, 11.7826900f, 11.8313398f,
+    11.8825769f, 11.9365149f, 11.9932613f, 12.0529194f,
+    12.1155872f, 12.1813593f, 12.2503242f, 12.3225679f,
+    12.3981695f, 12.4772043f, 12.5597410f, 12.6458473f,
+    12.7355824f, 12.8290043f, 12.9261627f, 13.0271072f,
+    13.1318789f, 13.2405176f, 13.3530579f, 13.4695292f,
+    13.5899601f, 13.7143717f, 13.8427849f, 13.9752150f,
+    14.1116753f, 14.2521744f, 14.3967199f, 14.5453148f,
+    14.6979618f, 14.8546591f, 15.0154028f, 15.1801872f,
+    15.3490057f, 15.5218487f, 15.6987057f, 15.8795633f,
+    16.0644093f, 16.2532272f, 16.4460030f, 16.6427174f,
+    16.8433571f, 17.0479012f, 17.2563324f, 17.4686317f,
+    17.6847820f, 17.9047623f, 18.1285534f, 18.3561382f,
+    18.5874958f, 18.8226109f, 19.0614624f, 19.3040371f,
+    19.5503139f, 19.8002777f, 20.0539131f, 20.3112049f,
+    20.5721397f, 20.8367043f, 21.1048851f, 21.3766708f,
+    21.6520500f, 21.9310131f, 22.2135506f, 22.4996567f,
+    22.7893219f, 23.0825405f, 23.3793087f, 23.6796207f,
+    23.9834766f, 24.2908707f, 24.6018028f, 24.9162731f,
+    25.2342815f, 25.5558319f, 25.8809242f, 26.2095623f,
+    26.5417519f, 26.8774967f, 27.2168045f, 27.5596809f,
+    27.9061317f, 28.2561703f, 28.6098022f, 28.9670372f,
+    29.3278866f, 29.6923637f, 30.0604763f, 30.4322414f,
+    30.8076687f, 31.1867752f, 31.5695724f, 31.9560757f,
+    32.3463020f, 32.7402687f, 33.1379852f, 33.5394783f,
+    33.9447556f, 34.3538437f, 34.7667542f, 35.1835060f,
+    35.6041222f, 36.0286179f, 36.4570160f, 36.8893356f,
+    37.3255959f, 37.7658157f, 38.2100182f, 38.6582260f,
+    39.1104546f, 39.5667305f, 40.0270767f, 40.4915085f,
+    40.9600563f, 41.4327354f, 41.9095688f, 42.3905869f,
+    42.8758011f, 43.3652458f, 43.8589363f, 44.3568993f,
+    44.8591576f, 45.3657379f, 45.8766556f, 46.3919449f,
+    46.9116211f, 47.4357147f, 47.9642448f, 48.4972420f,
+    49.0347252f, 49.5767212f, 50.1232529f, 50.6743507f,
+    51.2300339f, 51.7903290f, 52.3552589f, 52.9248543f,
+    53.4991341f, 54.0781288f, 54.6618614f, 55.2503586f,
+    55.8436470f, 56.4417496f, 57.0446892f, 57.6525002f,
+    58.2652016f, 58.8828239f, 59.5053902f, 60.1329269f,
+    60.7654610f, 61.4030190f, 62.0456238f, 62.6933098f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f, 63.3460960f, 63.3460960f, 63.3460960f,
+    63.3460960f,
+};
+
+const FLOAT *twolame_ath_table(int samplerate)
+{
+    switch (samplerate) {
+    case 16000:
+        return ath_16000;
+    case 22050:
+        return ath_22050;
+    case 24000:
+        return ath_24000;
+    case 32000:
+        return ath_32000;
+    case 44100:
+        return ath_44100;
+    case 48000:
+        return ath_48000;
+    default:
+        return NULL;
+    }
+}
+
+// vim:ts=4:sw=4:nowrap:
@@ -0,0 +1,44 @@
+/*
+ *  TwoLAME: an optimized MPEG Audio Layer Two encoder
+ *
+ *  Copyright (C) 2004-2018 The TwoLAME Project
+ *  Copyright (C) 2023 IObundle, Lda
+ *
+ *  This library is free software; you can redistribute it and/or
+ *  modify it under the terms of the GNU Lesser General Public
+ *  License as published by the Free Software Foundation; either
+ *  version 2.1 of the License, or (at your option) any later version.
+ *
+ *  This library is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *  Lesser General Public License for more details.
+ *
+ *  You should have received a copy of the GNU Lesser General Public
+ *  License along with this library; if not, write to the Free Software
+ *  Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ */
+
+
+#ifndef TWOLAME_TABLES_H
+#define TWOLAME_TABLES_H
+
+/* Constant tables, generated by gentables.c into tables.c */
+
+extern const FLOAT twolame_dct_matrix[16][32];
+extern const FLOAT twolame_psycho_1_dbtable[DBTAB];
+extern const FLOAT twolame_psycho_1_window[FFT_SIZE];
+extern const FLOAT twolame_psycho_4_window[BLKSIZE];
+#ifdef NEWTAN
+extern const FLOAT twolame_psycho_4_cos_table[TRIGTABLESIZE];
+#endif
+
+/* ATH in dB at each line of a 1024 point FFT (NULL if samplerate isn't one of the
+   MPEG-1 or MPEG-2 samplerates) */
+const FLOAT *twolame_ath_table(int samplerate);
+
+#endif
+
+
+// vim:ts=4:sw=4:nowrap:
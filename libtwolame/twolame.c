@@ -31,6 +31,10 @@
 
 #include "twolame.h"
 #include "common.h"
+
+#ifdef HAVE_PTHREAD_H
+#include <pthread.h>
+#endif
 #include "bitbuffer.h"
 #include "mem.h"
 #include "crc.h"
@@ -43,6 +47,7 @@
 #include "psycho_4.h"
 #include "availbits.h"
 #include "subband.h"
+#include "resample.h"
 #include "encode.h"
 #include "energy.h"
 #include "util.h"
@@ -66,15 +71,42 @@ unsigned int end_elapse_time_encode;
   Otherwise returns pointer to memory block
 */
 twolame_options *twolame_init(void)
+{
+    return twolame_init_with_allocator(NULL, NULL, NULL);
+}
+
+
+twolame_options *twolame_init_with_allocator(twolame_alloc_func alloc_func,
+                                             twolame_free_func free_func, void *user_data)
 {
     twolame_options *newoptions = NULL;
+    unsigned char *block;
 
-    newoptions = (twolame_options *) TWOLAME_MALLOC(sizeof(twolame_options));
-    if (newoptions == NULL) {
+    if ((alloc_func == NULL) != (free_func == NULL)) {
+        printf("twolame_init_with_allocator(): need both an alloc and a free function\n");
         return NULL;
     }
+    if (alloc_func == NULL) {
+        alloc_func = twolame_default_alloc;
+        free_func = twolame_default_free;
+        user_data = NULL;
+    }
+
+    // the allocator doesn't have to line the options up with a cache line
+    block = (unsigned char *) alloc_func(sizeof(twolame_options) + TWOLAME_CACHE_LINE - 1,
+                                         user_data);
+    if (block == NULL) {
+        return NULL;
+    }
+    newoptions = (twolame_options *) (block + (TWOLAME_CACHE_LINE -
+                                               ((size_t) block % TWOLAME_CACHE_LINE)) %
+                                      TWOLAME_CACHE_LINE);
 
     memset(newoptions, 0, sizeof(twolame_options));
+    newoptions->block = block;
+    newoptions->alloc_func = alloc_func;
+    newoptions->free_func = free_func;
+    newoptions->alloc_user_data = user_data;
 
     newoptions->version = -1;
     newoptions->num_channels_in = 0;
@@ -110,6 +142,9 @@ twolame_options *twolame_init(void)
     newoptions->scale_left = 1.0;   // scaling disabled
     newoptions->scale_right = 1.0;  // scaling disabled
 
+    newoptions->resample_quality = 2;
+    newoptions->resample = NULL;
+
     newoptions->do_energy_levels = FALSE;
     newoptions->num_ancillary_bits = -1;
 
@@ -127,6 +162,8 @@ twolame_options *twolame_init(void)
     newoptions->p2mem = NULL;
     newoptions->p3mem = NULL;
     newoptions->p4mem = NULL;
+    newoptions->compact_memory = FALSE;
+    newoptions->psycho_cache_index = -1;
 
     return (newoptions);
 }
@@ -188,6 +225,313 @@ static int init_header_info(twolame_options * glopts)
 
 
 
+/*
+    The tables of a psychoacoustic model only depend on the model, the
+    output samplerate and the ATH level. They are built once for each of
+    those and kept for the life of the process; every encoder then starts
+    from its own copy, because the models keep their state next to their
+    tables. Copying is much quicker than working the tables out again.
+
+    In compact memory mode an encoder only copies the state, and points at
+    the read-only tables of the cache entry. The entry counts its users, and
+    isn't freed until the last of them has been closed. Entries are freed in
+    place, so the index an encoder keeps stays valid; psymodel is -1 in a
+    free entry.
+
+    Looking up, filling, sharing and freeing entries all happen under
+    psycho_cache_lock, so encoders can be set up and closed from several
+    threads at once. Without pthreads there is no lock, and nothing is
+    cached: every encoder builds tables of its own.
+*/
+#define PSYCHO_CACHE_SIZE 16
+
+#ifdef HAVE_PTHREAD_H
+static pthread_mutex_t psycho_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define PSYCHO_CACHE_LOCK()     pthread_mutex_lock(&psycho_cache_lock)
+#define PSYCHO_CACHE_UNLOCK()   pthread_mutex_unlock(&psycho_cache_lock)
+#define PSYCHO_CACHE_ENTRIES    PSYCHO_CACHE_SIZE
+#else
+#define PSYCHO_CACHE_LOCK()
+#define PSYCHO_CACHE_UNLOCK()
+#define PSYCHO_CACHE_ENTRIES    0
+#endif
+
+typedef struct {
+    int psymodel;
+    int samplerate;
+    FLOAT athlevel;
+    psycho_0_mem *p0mem;
+    psycho_1_mem *p1mem;
+    psycho_2_mem *p2mem;
+    psycho_3_mem *p3mem;
+    psycho_4_mem *p4mem;
+    int users;                  // encoders sharing the tables of this entry
+} psycho_cache_entry;
+
+static psycho_cache_entry psycho_cache[PSYCHO_CACHE_SIZE];
+static int psycho_cache_count = 0;
+
+
+// Work out the tables of the psychoacoustic model of glopts into entry
+static int psycho_cache_build(twolame_options * glopts, psycho_cache_entry * entry)
+{
+    memset(entry, 0, sizeof(psycho_cache_entry));
+    entry->psymodel = glopts->psymodel;
+    entry->samplerate = glopts->samplerate_out;
+    entry->athlevel = glopts->athlevel;
+
+    switch (glopts->psymodel) {
+    case 0:
+        entry->p0mem = twolame_psycho_0_init(glopts, glopts->samplerate_out);
+        return (entry->p0mem != NULL) ? 0 : -1;
+    case 1:
+        entry->p1mem = twolame_psycho_1_init(glopts);
+        return (entry->p1mem != NULL) ? 0 : -1;
+    case 2:
+        entry->p2mem = twolame_psycho_2_init(glopts, glopts->samplerate_out);
+        return (entry->p2mem != NULL) ? 0 : -1;
+    case 3:
+        entry->p3mem = twolame_psycho_3_init(glopts);
+        return (entry->p3mem != NULL) ? 0 : -1;
+    case 4:
+        entry->p4mem = twolame_psycho_4_init(glopts, glopts->samplerate_out);
+        return (entry->p4mem != NULL) ? 0 : -1;
+    }
+
+    return 0;
+}
+
+static void psycho_cache_free(psycho_cache_entry * entry)
+{
+    twolame_psycho_0_deinit(&entry->p0mem);
+    twolame_psycho_1_deinit(&entry->p1mem);
+    twolame_psycho_2_deinit(&entry->p2mem);
+    twolame_psycho_3_deinit(&entry->p3mem);
+    twolame_psycho_4_deinit(&entry->p4mem);
+    entry->psymodel = -1;
+    entry->users = 0;
+}
+
+
+// Stop sharing the tables of a cache entry
+static void psycho_cache_release(twolame_options * glopts)
+{
+    if (glopts->psycho_cache_index >= 0) {
+        PSYCHO_CACHE_LOCK();
+        psycho_cache[glopts->psycho_cache_index].users--;
+        PSYCHO_CACHE_UNLOCK();
+        glopts->psycho_cache_index = -1;
+    }
+}
+
+
+/*
+    Find the cache entry with the tables of the psychoacoustic model of glopts,
+    building them if need be. When the cache is full they are built into
+    uncached instead, which the caller frees once it has its copy.
+    The caller holds psycho_cache_lock until it has its copy.
+    Returns NULL on failure
+*/
+static psycho_cache_entry *psycho_cache_get(twolame_options * glopts,
+                                            psycho_cache_entry * uncached)
+{
+    psycho_cache_entry *entry;
+    int i;
+
+    for (i = 0; i < psycho_cache_count; i++) {
+        if (psycho_cache[i].psymodel == glopts->psymodel
+                && psycho_cache[i].samplerate == glopts->samplerate_out
+                && psycho_cache[i].athlevel == glopts->athlevel)
+            return &psycho_cache[i];
+    }
+
+    // use the first free entry
+    for (i = 0; i < psycho_cache_count; i++)
+        if (psycho_cache[i].psymodel < 0)
+            break;
+
+    // if the cache is full, this encoder just gets tables of its own
+    entry = (i == PSYCHO_CACHE_ENTRIES) ? uncached : &psycho_cache[i];
+    if (psycho_cache_build(glopts, entry) < 0) {
+        psycho_cache_free(entry);
+        return NULL;
+    }
+    if (entry != uncached && i == psycho_cache_count)
+        psycho_cache_count++;
+
+    return entry;
+}
+
+
+// The number of bytes psycho_copy() takes from the arena
+static size_t psycho_size(twolame_options * glopts, psycho_cache_entry * entry, int share)
+{
+    switch (glopts->psymodel) {
+    case 0:
+        return TWOLAME_ARENA_SIZE(sizeof(psycho_0_mem));
+    case 1:
+        return twolame_psycho_1_size(entry->p1mem, share);
+    case 2:
+        return twolame_psycho_2_size(entry->p2mem, share);
+    case 3:
+        return twolame_psycho_3_size(entry->p3mem, share);
+    case 4:
+        return twolame_psycho_4_size(entry->p4mem, share);
+    }
+
+    return 0;
+}
+
+
+/*
+    Set up the psychoacoustic model before the first frame,
+    rather than part way through encoding it
+*/
+static int psycho_copy(twolame_options * glopts, psycho_cache_entry * entry, int share)
+{
+    if (share) {
+        entry->users++;
+        glopts->psycho_cache_index = entry - psycho_cache;
+    }
+
+    switch (glopts->psymodel) {
+    case 0:
+        glopts->p0mem = twolame_psycho_0_copy(entry->p0mem, &glopts->arena);
+        return (glopts->p0mem != NULL) ? 0 : -1;
+    case 1:
+        glopts->p1mem = twolame_psycho_1_copy(entry->p1mem, share, &glopts->arena);
+        return (glopts->p1mem != NULL) ? 0 : -1;
+    case 2:
+        glopts->p2mem = twolame_psycho_2_copy(entry->p2mem, share, &glopts->arena);
+        return (glopts->p2mem != NULL) ? 0 : -1;
+    case 3:
+        glopts->p3mem = twolame_psycho_3_copy(entry->p3mem, share, &glopts->arena);
+        return (glopts->p3mem != NULL) ? 0 : -1;
+    case 4:
+        glopts->p4mem = twolame_psycho_4_copy(entry->p4mem, share, &glopts->arena);
+        return (glopts->p4mem != NULL) ? 0 : -1;
+    }
+
+    return 0;
+}
+
+
+/*
+    Let go of everything twolame_init_params() set up: it all lives in the
+    arena, apart from the tables shared with the psycho cache
+*/
+static void release_memory(twolame_options * glopts)
+{
+    glopts->p0mem = NULL;
+    glopts->p1mem = NULL;
+    glopts->p2mem = NULL;
+    glopts->p3mem = NULL;
+    glopts->p4mem = NULL;
+    glopts->resample = NULL;
+    glopts->subband = NULL;
+    glopts->j_sample = NULL;
+    glopts->sb_sample = NULL;
+    psycho_cache_release(glopts);
+    twolame_arena_deinit(glopts);
+}
+
+
+/*
+    Work out how much memory the encoder needs, allocate it in one go,
+    and set up the psychoacoustic model, resampler and subband buffers in it
+*/
+static int init_memory(twolame_options * glopts)
+{
+    psycho_cache_entry *entry = NULL;
+    psycho_cache_entry uncached;
+    int share = FALSE;
+    size_t size;
+    int result = 0;
+
+    // start again if the options are being set up for a second time
+    release_memory(glopts);
+
+    // Psy model -1 doesn't have any tables
+    // (the cache entry mustn't change or go away until it has been copied)
+    PSYCHO_CACHE_LOCK();
+    if (glopts->psymodel >= 0 && glopts->psymodel <= 4) {
+        entry = psycho_cache_get(glopts, &uncached);
+        if (entry == NULL) {
+            PSYCHO_CACHE_UNLOCK();
+            return -1;
+        }
+        share = glopts->compact_memory && glopts->psymodel != 0 && entry != &uncached;
+    }
+
+    size = TWOLAME_ARENA_SIZE(sizeof(subband_t))
+        + TWOLAME_ARENA_SIZE(sizeof(sb_sample_t))
+        + TWOLAME_ARENA_SIZE(sizeof(jsb_sample_t));
+    if (entry != NULL)
+        size += psycho_size(glopts, entry, share);
+    if (glopts->samplerate_out != glopts->samplerate_in) {
+        size_t resample_size = twolame_resample_size(glopts->samplerate_in, glopts->samplerate_out,
+                                                     glopts->resample_quality);
+        if (resample_size == 0)
+            result = -1;
+        size += resample_size;
+    }
+
+    if (result == 0)
+        result = twolame_arena_init(glopts, size);
+
+    // the state of the psycho model goes first, as it is used first
+    if (result == 0 && entry != NULL)
+        result = psycho_copy(glopts, entry, share);
+    PSYCHO_CACHE_UNLOCK();
+    if (entry == &uncached)
+        psycho_cache_free(&uncached);
+    if (result < 0)
+        return -1;
+
+    glopts->subband = (subband_t *) twolame_arena_alloc(&glopts->arena, sizeof(subband_t));
+    glopts->sb_sample = (sb_sample_t *) twolame_arena_alloc(&glopts->arena, sizeof(sb_sample_t));
+    glopts->j_sample = (jsb_sample_t *) twolame_arena_alloc(&glopts->arena, sizeof(jsb_sample_t));
+    if (glopts->subband == NULL || glopts->sb_sample == NULL || glopts->j_sample == NULL)
+        return -1;
+
+    // Resample the input if it isn't at the output samplerate
+    if (glopts->samplerate_out != glopts->samplerate_in) {
+        glopts->resample = twolame_resample_init(glopts->samplerate_in, glopts->samplerate_out,
+                                                 glopts->resample_quality, &glopts->arena);
+        if (glopts->resample == NULL)
+            return -1;
+    }
+
+    return 0;
+}
+
+
+void twolame_free_psycho_cache(void)
+{
+    int i;
+
+    // tables that are still shared are kept
+    PSYCHO_CACHE_LOCK();
+    for (i = 0; i < psycho_cache_count; i++)
+        if (psycho_cache[i].psymodel >= 0 && psycho_cache[i].users == 0)
+            psycho_cache_free(&psycho_cache[i]);
+    while (psycho_cache_count > 0 && psycho_cache[psycho_cache_count - 1].psymodel < 0)
+        psycho_cache_count--;
+    PSYCHO_CACHE_UNLOCK();
+}
+
+
+size_t twolame_get_memory_usage(twolame_options * glopts)
+{
+    if (glopts == NULL)
+        return 0;
+
+    // the shared psycho tables aren't in the arena
+    return sizeof(twolame_options) + glopts->arena.size;
+}
+
+
+
 
 /**
  * This function should actually *check* the parameters to see if they
@@ -390,9 +734,9 @@ int twolame_init_params(twolame_options * glopts)
     if (twolame_encode_init(glopts) < 0) {
         return -1;
     }
-    // Check input samplerate is same as output samplerate
-    if (glopts->samplerate_out != glopts->samplerate_in) {
-        printf("twolame_init_params(): sorry, twolame doesn't support resampling (yet).\n");
+    // Allocate the psychoacoustic model (copying its tables), resampler and buffers
+    glopts->resample_ratio = (FLOAT) glopts->samplerate_out / glopts->samplerate_in;
+    if (init_memory(glopts) < 0) {
         return -1;
     }
 
@@ -400,25 +744,13 @@ int twolame_init_params(twolame_options * glopts)
     glopts->samples_in_buffer = 0;
     glopts->psycount = 0;
 
-
-    // Allocate memory to larger buffers
-    glopts->subband = (subband_t *) TWOLAME_MALLOC(sizeof(subband_t));
-    glopts->j_sample = (jsb_sample_t *) TWOLAME_MALLOC(sizeof(jsb_sample_t));
-    glopts->sb_sample = (sb_sample_t *) TWOLAME_MALLOC(sizeof(sb_sample_t));
-    if (glopts->subband == NULL
-            ||
-            glopts->j_sample == NULL
-            ||
-            glopts->sb_sample == NULL)
-    {
-        TWOLAME_FREE(glopts->subband);
-        TWOLAME_FREE(glopts->j_sample);
-        TWOLAME_FREE(glopts->sb_sample);
-        return -1;
-    }
-
     // clear buffers
     memset((char *) glopts->buffer, 0, sizeof(glopts->buffer));
+    memset((char *) glopts->fbuffer, 0, sizeof(glopts->fbuffer));
+    glopts->input.pcm[0] = glopts->buffer[0];
+    glopts->input.pcm[1] = glopts->buffer[1];
+    glopts->input.fpcm[0] = glopts->input.fpcm[1] = NULL;
+    glopts->input.stride = 1;
     memset((char *) glopts->bit_alloc, 0, sizeof(glopts->bit_alloc));
     memset((char *) glopts->scfsi, 0, sizeof(glopts->scfsi));
     memset((char *) glopts->scalar, 0, sizeof(glopts->scalar));
@@ -438,54 +770,180 @@ int twolame_init_params(twolame_options * glopts)
 }
 
 
-/* Scale the samples in the frame sample buffer
-   using the user specified values
-   and downmix/upmix according to the number of input/output channels
+/*
+    Work out the 2x2 gain matrix that takes the input channels to the
+    output channels, combining the user specified scaling with any
+    downmix/upmix according to the number of input/output channels
+
+    Returns TRUE if the matrix leaves the samples as they are
 */
-static void scale_and_mix_samples(twolame_options * glopts)
+static int mix_matrix(twolame_options * glopts, FLOAT m[2][2])
 {
-    int num_samples = glopts->samples_in_buffer;
+    FLOAT scale[2] = { 1.0, 1.0 };
+
+    // work out the combined scaling of each channel
+    if (glopts->scale != 0)
+        scale[0] = scale[1] = glopts->scale;
+    if (glopts->scale_left != 0)
+        scale[0] *= glopts->scale_left;
+    if (glopts->scale_right != 0)
+        scale[1] *= glopts->scale_right;
+
+    m[0][1] = m[1][0] = m[1][1] = 0.0;
+    if (glopts->num_channels_in == 2) {
+        if (glopts->num_channels_out == 1) {
+            // Downmix to Mono
+            m[0][0] = scale[0] * 0.5;
+            m[0][1] = scale[1] * 0.5;
+            return FALSE;
+        }
+        m[0][0] = scale[0];
+        m[1][1] = scale[1];
+        return (scale[0] == 1.0 && scale[1] == 1.0);
+    }
+
+    m[0][0] = scale[0];
+    if (glopts->num_channels_out == 2) {
+        // Upmix to Stereo
+        m[1][0] = scale[0];
+        return FALSE;
+    }
+    return (scale[0] == 1.0);
+}
+
+
+/*
+    Copy 16-bit samples into the frame buffer, deinterleaving them
+    and applying the gain matrix in the same pass.
+    stride is the distance between two samples of a channel
+*/
+static void copy_samples(twolame_options * glopts, const short int *left, const short int *right,
+                         int stride, int num_samples)
+{
+    short int *out0 = glopts->buffer[0] + glopts->samples_in_buffer;
+    short int *out1 = glopts->buffer[1] + glopts->samples_in_buffer;
+    FLOAT m[2][2];
     int i;
 
-    // apply scaling to both channels
-    if (glopts->scale != 0 && glopts->scale != 1.0) {
+    if (mix_matrix(glopts, m)) {
+        for (i = 0; i < num_samples; i++)
+            out0[i] = left[i * stride];
         if (glopts->num_channels_in == 2)
-            for (i = 0; i < num_samples; ++i) {
-                glopts->buffer[0][i] *= glopts->scale;
-                glopts->buffer[1][i] *= glopts->scale;
-            }
-        else
-            for (i = 0; i < num_samples; ++i)
-                glopts->buffer[0][i] *= glopts->scale;
+            for (i = 0; i < num_samples; i++)
+                out1[i] = right[i * stride];
+        return;
     }
-    // apply scaling to channel 0 (left)
-    if (glopts->scale_left != 0 && glopts->scale_left != 1.0) {
-        for (i = 0; i < num_samples; ++i) {
-            glopts->buffer[0][i] *= glopts->scale_left;
-        }
+
+    if (glopts->num_channels_in != 2)
+        right = left;
+
+    // saturate rather than wrap, then truncate as the scaling always has
+    for (i = 0; i < num_samples; i++) {
+        FLOAT x0 = left[i * stride];
+        FLOAT x1 = right[i * stride];
+        FLOAT y0 = m[0][0] * x0 + m[0][1] * x1;
+        FLOAT y1 = m[1][0] * x0 + m[1][1] * x1;
+
+        y0 = (y0 > 32767.0) ? 32767.0 : ((y0 < -32768.0) ? -32768.0 : y0);
+        y1 = (y1 > 32767.0) ? 32767.0 : ((y1 < -32768.0) ? -32768.0 : y1);
+        out0[i] = (short int) y0;
+        out1[i] = (short int) y1;
     }
-    // apply scaling to channel 1 (right)
-    if (glopts->scale_right != 0 && glopts->scale_right != 1.0) {
-        for (i = 0; i < num_samples; ++i) {
-            glopts->buffer[1][i] *= glopts->scale_right;
-        }
+}
+
+
+/*
+    Copy float samples into the frame buffer, deinterleaving them
+    and applying the gain matrix in the same pass.
+    They are clipped later on, by the filterbank
+*/
+static void copy_float_samples(twolame_options * glopts, const float *left, const float *right,
+                               int stride, int num_samples)
+{
+    float *out0 = glopts->fbuffer[0] + glopts->samples_in_buffer;
+    float *out1 = glopts->fbuffer[1] + glopts->samples_in_buffer;
+    FLOAT m[2][2];
+    int i;
+
+    if (mix_matrix(glopts, m)) {
+        for (i = 0; i < num_samples; i++)
+            out0[i] = left[i * stride];
+        if (glopts->num_channels_in == 2)
+            for (i = 0; i < num_samples; i++)
+                out1[i] = right[i * stride];
+        return;
     }
-    // Downmix to Mono if 2 channels in and 1 channel out
-    if (glopts->num_channels_in == 2 && glopts->num_channels_out == 1) {
-        for (i = 0; i < num_samples; ++i) {
-            glopts->buffer[0][i] = ((long) glopts->buffer[0][i] + glopts->buffer[1][i]) / 2;
-            glopts->buffer[1][i] = 0;
-        }
+
+    if (glopts->num_channels_in != 2)
+        right = left;
+
+    for (i = 0; i < num_samples; i++) {
+        FLOAT x0 = left[i * stride];
+        FLOAT x1 = right[i * stride];
+
+        out0[i] = m[0][0] * x0 + m[0][1] * x1;
+        out1[i] = m[1][0] * x0 + m[1][1] * x1;
     }
-    // Upmix to Stereo if 2 channels out and 1 channel in
-    if (glopts->num_channels_in == 1 && glopts->num_channels_out == 2) {
-        for (i = 0; i < num_samples; ++i) {
-            glopts->buffer[1][i] = glopts->buffer[0][i];
-        }
+}
+
+/*
+    Take as many samples as the resampler has room for, scaling and mixing
+    them on the way, and resample into the (float) frame buffer as much as fits.
+    The samples are 16-bit (left, right) or float (fleft, fright), and stride
+    is the distance between two samples of a channel
+
+    Returns the number of input samples used up
+*/
+static int resample_samples(twolame_options * glopts, const short int *left, const short int *right,
+                            const float *fleft, const float *fright, int stride, int num_samples)
+{
+    resample_mem *rs = glopts->resample;
+    FLOAT *out0, *out1;
+    FLOAT m[2][2];
+    int n = twolame_resample_space(rs);
+    int i;
+
+    if (n > num_samples)
+        n = num_samples;
+    out0 = rs->x[0] + rs->length;
+    out1 = rs->x[1] + rs->length;
+
+    mix_matrix(glopts, m);
+    if (glopts->num_channels_in != 2) {
+        right = left;
+        fright = fleft;
     }
 
+    if (fleft != NULL)
+        for (i = 0; i < n; i++) {
+            FLOAT x0 = fleft[i * stride];
+            FLOAT x1 = fright[i * stride];
+
+            out0[i] = m[0][0] * x0 + m[0][1] * x1;
+            out1[i] = m[1][0] * x0 + m[1][1] * x1;
+        }
+    else
+        for (i = 0; i < n; i++) {
+            FLOAT x0 = (FLOAT) left[i * stride] / SCALE;
+            FLOAT x1 = (FLOAT) right[i * stride] / SCALE;
+
+            out0[i] = m[0][0] * x0 + m[0][1] * x1;
+            out1[i] = m[1][0] * x0 + m[1][1] * x1;
+        }
+    rs->length += n;
+    if (n > 0)
+        rs->flushed = FALSE;
+
+    glopts->samples_in_buffer +=
+        twolame_resample(rs, glopts->num_channels_out,
+                         glopts->fbuffer[0] + glopts->samples_in_buffer,
+                         glopts->fbuffer[1] + glopts->samples_in_buffer,
+                         TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer);
+
+    return n;
 }
 
+
 /*
     Encode a single frame of audio from 1152 samples
     Audio samples are taken from glopts->buffer
@@ -498,9 +956,10 @@ static void scale_and_mix_samples(twolame_options * glopts)
 static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
 {
     int nch = glopts->num_channels_out;
-    int sb, ch, adb, i;
+    int sb, ch, adb, max_frame_bytes;
     unsigned long frameBits, initial_bits;
-    short sam[2][1056];
+    FLOAT sam[2][1056];
+    bit_writer bw;
 
     if (!glopts->twolame_init) {
         printf("Please call twolame_init_params() before starting encoding.\n");
@@ -511,13 +970,6 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
 
     //////1
     start_elapse_time_twolame = timer_time_ms();
-    // Scale and mix the input buffer
-    scale_and_mix_samples(glopts);
-    end_elapse_time_twolame = timer_time_ms();
-    elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-
-    //////2
-    start_elapse_time_twolame = timer_time_ms();
     // Clear the saved audio buffer
     memset((char *) sam, 0, sizeof(sam));
 
@@ -529,7 +981,7 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////3
+    //////2
     start_elapse_time_twolame = timer_time_ms();
     adb = twolame_available_bits(glopts);
     end_elapse_time_twolame = timer_time_ms();
@@ -547,7 +999,7 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
 
     adb -= glopts->num_ancillary_bits;
 
-    //////4
+    //////3
     start_elapse_time_twolame = timer_time_ms();
     /* The DAB scf-crc calc is done below. The frontend will have to keep the previous frame in
        memory. As of 09May 2014 all that needs to be done is for the frontend to buffer one frame in
@@ -556,37 +1008,41 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
     {
         int gr, bl, ch;
         /* New polyphase filter Combines windowing and filtering. Ricardo Feb'03 */
+        /* The filter also finds the max. of each set of 12 subband samples for the
+           scalefactor calculation */
+        memset(glopts->sb_max, 0, sizeof(glopts->sb_max));
         for (gr = 0; gr < 3; gr++)
             for (bl = 0; bl < 12; bl++)
                 for (ch = 0; ch < nch; ch++)
-                    twolame_window_filter_subband(&glopts->smem,
-                                                  &glopts->buffer[ch][gr * 12 * 32 + 32 * bl], ch,
-                                                  &(*glopts->sb_sample)[ch][gr][bl][0]);
+                    twolame_window_filter_subband(&glopts->smem, &glopts->input,
+                                                  gr * 12 * 32 + 32 * bl, ch,
+                                                  &(*glopts->sb_sample)[ch][gr][bl][0],
+                                                  glopts->sb_max[ch][gr]);
     }
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////5
+    //////4
     start_elapse_time_twolame = timer_time_ms();
-    twolame_scalefactor_calc(*glopts->sb_sample, glopts->scalar, nch, glopts->sblimit);
+    twolame_scalefactor_calc_max(glopts->sb_max, glopts->scalar, nch, glopts->sblimit);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////6
+    //////5
     start_elapse_time_twolame = timer_time_ms();
     twolame_find_sf_max(glopts, glopts->scalar, glopts->max_sc);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////7
+    //////6
     start_elapse_time_twolame = timer_time_ms();
     if (glopts->mode == TWOLAME_JOINT_STEREO) {
         // this way we calculate more mono than we need but it is cheap
-        twolame_combine_lr(*glopts->sb_sample, *glopts->j_sample, glopts->sblimit);
-        twolame_scalefactor_calc(glopts->j_sample, &glopts->j_scale, 1, glopts->sblimit);
+        twolame_combine_lr_scalefactor_calc(*glopts->sb_sample, *glopts->j_sample,
+                                            glopts->j_scale, glopts->sblimit);
     }
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////8
+    //////7
     start_elapse_time_twolame = timer_time_ms();
     if ((glopts->quickmode == TRUE) && (++glopts->psycount % glopts->quickcount != 0)) {
         /* We're using quick mode, so we're only calculating the model every 'quickcount' frames.
@@ -606,18 +1062,18 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
             twolame_psycho_0(glopts, glopts->smr, glopts->scalar);
             break;
         case 1:
-            twolame_psycho_1(glopts, glopts->buffer, glopts->max_sc, glopts->smr);
+            twolame_psycho_1(glopts, &glopts->input, glopts->max_sc, glopts->smr);
             break;
         case 2:
-            twolame_psycho_2(glopts, glopts->buffer, sam, glopts->smr);
+            twolame_psycho_2(glopts, &glopts->input, sam, glopts->smr);
             break;
         case 3:
             // Modified psy model 1
-            twolame_psycho_3(glopts, glopts->buffer, glopts->max_sc, glopts->smr, elapsed_time_psycho_3);
+            twolame_psycho_3(glopts, &glopts->input, glopts->max_sc, glopts->smr, elapsed_time_psycho_3);
             break;
         case 4:
             // Modified psy model 2
-            twolame_psycho_4(glopts, glopts->buffer, sam, glopts->smr);
+            twolame_psycho_4(glopts, &glopts->input, sam, glopts->smr);
             break;
         default:
             printf("Invalid psy model specification: %i\n", glopts->psymodel);
@@ -636,91 +1092,86 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////9
+    //////8
     start_elapse_time_twolame = timer_time_ms();
     twolame_sf_transmission_pattern(glopts, glopts->scalar, glopts->scfsi);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////10
+    //////9
     start_elapse_time_twolame = timer_time_ms();
     twolame_main_bit_allocation(glopts, glopts->smr, glopts->scfsi, glopts->bit_alloc, &adb);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////11
+    /* The bitrate of this frame is settled now (VBR may have changed it), so check once that
+       the whole frame fits in the buffer, rather than on every write. One byte extra for padding. */
+    max_frame_bytes = (int) ((1152.0 / ((FLOAT) glopts->samplerate_out / 1000.0))
+                             * ((FLOAT) glopts->bitrate / 8.0)) + 1;
+    if (bs->buf_byte_idx + max_frame_bytes > bs->buf_size) {
+        printf("encode_frame: error. bit_stream buffer needs to be bigger\n");
+        return -1;
+    }
+    buffer_writer_begin(&bw, bs);
+
+    //////10
     start_elapse_time_twolame = timer_time_ms();
-    twolame_write_header(glopts, bs);
+    twolame_write_header(glopts, &bw);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////12
+    //////11
     start_elapse_time_twolame = timer_time_ms();
     // Leave space for 2 bytes of CRC to be filled in later
     if (glopts->error_protection)
-        buffer_putbits(bs, 0, 16);
+        buffer_writer_putbits(&bw, 0, 16);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////13
+    //////12
     start_elapse_time_twolame = timer_time_ms();
-    twolame_write_bit_alloc(glopts, glopts->bit_alloc, bs);
+    twolame_write_bit_alloc(glopts, glopts->bit_alloc, &bw);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////14
+    //////13
     start_elapse_time_twolame = timer_time_ms();
-    twolame_write_scalefactors(glopts, glopts->bit_alloc, glopts->scfsi, glopts->scalar, bs);
+    twolame_write_scalefactors(glopts, glopts->bit_alloc, glopts->scfsi, glopts->scalar, &bw);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////15
+    //////14
     start_elapse_time_twolame = timer_time_ms();
     twolame_subband_quantization(glopts, glopts->scalar, *glopts->sb_sample, glopts->j_scale,
                                  *glopts->j_sample, glopts->bit_alloc, *glopts->subband);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-    //////16
+    //////15
     start_elapse_time_twolame = timer_time_ms();
-    twolame_write_samples(glopts, *glopts->subband, glopts->bit_alloc, bs);
+    twolame_write_samples(glopts, *glopts->subband, glopts->bit_alloc, &bw);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////17
+    //////16
     start_elapse_time_twolame = timer_time_ms();
     // If not all the bits were used, write out a stack of zeros
-    for (i = 0; i < adb; i++)
-        buffer_put1bit(bs, 0);
+    buffer_writer_put_zero_bits(&bw, adb);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////18
+    //////17
     start_elapse_time_twolame = timer_time_ms();
     /* pad the current frame when needed */
     if (glopts->header.padding)
         // input file
-        buffer_putbits(bs, 0, 8);
+        buffer_writer_putbits(&bw, 0, 8);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////19
-    start_elapse_time_twolame = timer_time_ms();
-    if (glopts->do_dab) {
-        // Do the CRC calc for DAB stuff if required.
-        // It will be up to the frontend to insert it into the end of the
-        // previous frame.
-        for (i = glopts->dab_crc_len - 1; i >= 0; i--) {
-            twolame_dab_crc_calc(glopts, glopts->bit_alloc, glopts->scfsi, glopts->scalar,
-                                 &glopts->dab_crc[i], i);
-        }
-    }
-    end_elapse_time_twolame = timer_time_ms();
-    elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
-
-    //////20
+    //////18
     start_elapse_time_twolame = timer_time_ms();
     // Allocate space for the reserved ancillary bits
-    for (i = 0; i < glopts->num_ancillary_bits; i++)
-        buffer_put1bit(bs, 0);
+    buffer_writer_put_zero_bits(&bw, glopts->num_ancillary_bits);
+    buffer_writer_end(&bw, bs);
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////21
+    //////19
     start_elapse_time_twolame = timer_time_ms();
     // Calulate the number of bits in this frame
     frameBits = twolame_buffer_sstell(bs) - initial_bits;
@@ -735,7 +1186,7 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////22
+    //////20
     start_elapse_time_twolame = timer_time_ms();
     // Store the energy levels at the end of the frame
     if (glopts->do_energy_levels)
@@ -743,7 +1194,7 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
     end_elapse_time_twolame = timer_time_ms();
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
 
-    //////23
+    //////21
     start_elapse_time_twolame = timer_time_ms();
     // MEANX: Recompute checksum from bitstream
     if (glopts->error_protection) {
@@ -754,11 +1205,194 @@ static int encode_frame(twolame_options * glopts, bit_stream * bs, unsigned int
     elapsed_time_twolame [index_timer++] += end_elapse_time_twolame - start_elapse_time_twolame;
     // printf("Frame size: %li\n\n",frameBits/8);
 
+    if (glopts->frame_trace != NULL)
+        glopts->frame_trace(glopts, glopts->frame_trace_data);
+
+    if (glopts->frame_callback != NULL) {
+        twolame_frame_info info;
+
+        info.frame = glopts->frames_encoded;
+        info.offset = glopts->bytes_encoded;
+        info.size = frameBits / 8;
+        info.bitrate_index = glopts->header.bitrate_index;
+        info.padding = glopts->header.padding;
+        info.sample = glopts->frames_encoded * TWOLAME_SAMPLES_PER_FRAME;
+        glopts->frame_callback(&info, glopts->frame_callback_data);
+    }
+    glopts->frames_encoded++;
+    glopts->bytes_encoded += frameBits / 8;
+
     return frameBits / 8;
 }
 
 
 
+/*
+    Hand as much as the output callback will take of the last frame over to it
+
+    Returns the number of bytes still waiting
+    or -1 if the callback returned an error
+*/
+int twolame_output_drain(twolame_options * glopts)
+{
+    if (glopts->output_callback == NULL)
+        return 0;
+
+    while (glopts->output_pending > 0) {
+        int taken = glopts->output_callback(glopts->output_frame + glopts->output_offset,
+                                            glopts->output_pending, glopts->output_user_data);
+        if (taken < 0) {
+            printf("twolame_output_drain: error. output callback returned %d\n", taken);
+            return -1;
+        }
+        if (taken == 0)
+            break;
+        if (taken > glopts->output_pending)
+            taken = glopts->output_pending;
+        glopts->output_offset += taken;
+        glopts->output_pending -= taken;
+    }
+
+    return glopts->output_pending;
+}
+
+
+/*
+    Encode a frame, into bs or, when there is an output callback,
+    into glopts->output_frame and then straight on to the callback
+*/
+static int encode_output_frame(twolame_options * glopts, bit_stream * bs, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
+{
+    int bytes;
+
+    if (glopts->output_callback == NULL)
+        return encode_frame(glopts, bs, elapsed_time_twolame, elapsed_time_psycho_3);
+
+    twolame_buffer_init(glopts->output_frame, MAX_FRAME_BYTES, &glopts->output_bs);
+    bytes = encode_frame(glopts, &glopts->output_bs, elapsed_time_twolame, elapsed_time_psycho_3);
+    if (bytes > 0) {
+        glopts->output_offset = 0;
+        glopts->output_pending = bytes;
+        if (twolame_output_drain(glopts) < 0)
+            return -1;
+    }
+
+    return bytes;
+}
+
+
+
+static void float32_to_short(const float in[], short out[], int num_samples, int stride)
+{
+    int n;
+
+    for (n = 0; n < num_samples; n++) {
+        int tmp = lrintf(in[n * stride] * 32768.0f);
+        if (tmp > SHRT_MAX) {
+            out[n] = SHRT_MAX;
+        } else if (tmp < SHRT_MIN) {
+            out[n] = SHRT_MIN;
+        } else {
+            out[n] = (short) tmp;
+        }
+    }
+}
+
+
+/*
+    Switch the frame buffer between 16-bit and float samples,
+    converting any samples that are already waiting in it
+*/
+static void use_float_buffer(twolame_options * glopts, int use_float)
+{
+    int num_samples = glopts->samples_in_buffer;
+    int ch, i;
+
+    if (use_float == (glopts->input.fpcm[0] != NULL))
+        return;
+
+    if (use_float) {
+        for (ch = 0; ch < 2; ch++)
+            for (i = 0; i < num_samples; i++)
+                glopts->fbuffer[ch][i] = (float) glopts->buffer[ch][i] / SCALE;
+        glopts->input.fpcm[0] = glopts->fbuffer[0];
+        glopts->input.fpcm[1] = glopts->fbuffer[1];
+    } else {
+        for (ch = 0; ch < 2; ch++)
+            float32_to_short(glopts->fbuffer[ch], glopts->buffer[ch], num_samples, 1);
+        glopts->input.fpcm[0] = glopts->input.fpcm[1] = NULL;
+    }
+}
+
+
+/*
+    Resample what is left of the input into the frame buffer,
+    after pushing the end of it through the resampler's filter
+*/
+static void flush_resampler(twolame_options * glopts)
+{
+    use_float_buffer(glopts, TRUE);
+    twolame_resample_flush(glopts->resample);
+
+    glopts->samples_in_buffer +=
+        twolame_resample(glopts->resample, glopts->num_channels_out,
+                         glopts->fbuffer[0] + glopts->samples_in_buffer,
+                         glopts->fbuffer[1] + glopts->samples_in_buffer,
+                         TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer);
+}
+
+
+/*
+    Can whole frames be encoded straight from the caller's samples?
+    Only if nothing is waiting in the frame buffer, and the samples don't
+    need to be resampled, scaled or mixed (which is done as they are copied)
+*/
+static int input_direct(twolame_options * glopts)
+{
+    FLOAT m[2][2];
+
+    if (glopts->samples_in_buffer != 0 || glopts->resample != NULL)
+        return FALSE;
+
+    return mix_matrix(glopts, m);
+}
+
+
+/*
+    Encode the next whole frame from the caller's samples, without copying
+    them into the frame buffer. The channels start at left and right (16-bit)
+    or fleft and fright (float), and stride is the distance between two
+    samples of a channel
+*/
+static int encode_frame_direct(twolame_options * glopts, bit_stream * bs,
+                               const short int *left, const short int *right,
+                               const float *fleft, const float *fright, int stride,
+                               unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
+{
+    pcm_view staged = glopts->input;
+    int bytes;
+
+    if (glopts->num_channels_in != 2) {
+        // the second channel is still looked at for the energy levels
+        right = glopts->buffer[1];
+        fright = (fleft != NULL) ? glopts->fbuffer[1] : NULL;
+    }
+    glopts->input.pcm[0] = (left != NULL) ? left : glopts->buffer[0];
+    glopts->input.pcm[1] = (right != NULL) ? right : glopts->buffer[1];
+    glopts->input.fpcm[0] = fleft;
+    glopts->input.fpcm[1] = fright;
+    glopts->input.stride = stride;
+    glopts->samples_in_buffer = TWOLAME_SAMPLES_PER_FRAME;
+
+    bytes = encode_output_frame(glopts, bs, elapsed_time_twolame, elapsed_time_psycho_3);
+
+    glopts->input = staged;
+    glopts->samples_in_buffer = 0;
+
+    return bytes;
+}
+
+
 /*
   glopts
   leftpcm - holds left channel (or mono channel)
@@ -775,51 +1409,93 @@ int twolame_encode_buffer(twolame_options * glopts,
                           int num_samples, unsigned char *mp2buffer, int mp2buffer_size, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
 {
     int mp2_size = 0;
+    int samples_in = num_samples;
+    bit_stream bs;
     bit_stream *mybs;
-    int i;
 
     if (num_samples == 0)
         return 0;
 
+    // samples that have to wait for a whole frame are kept as they come
+    // (resampled samples are always float)
+    use_float_buffer(glopts, glopts->resample != NULL);
+
 
-    // now would be a great time to validate the size of the buffer.
-    // samples/1152 * sizeof(frame) < mp2buffer_size
-    twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    if (glopts->output_callback != NULL) {
+        // Frames go to the output callback, once it has taken the last one
+        int pending = twolame_output_drain(glopts);
+        if (pending != 0)
+            return (pending < 0) ? -1 : 0;
+        mybs = &glopts->output_bs;
+    } else {
+        // now would be a great time to validate the size of the buffer.
+        // samples/1152 * sizeof(frame) < mp2buffer_size
+        // (no bit_stream is passed in here, so one is set up on the stack)
+        mybs = &bs;
+        twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    }
 
     if (mybs != NULL) {
         // Use up all the samples in in_buffer
         while (num_samples) {
 
-            // fill up glopts->buffer with as much as we can
-            int samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
-            if (num_samples < samples_to_copy)
-                samples_to_copy = num_samples;
+            int samples_to_copy;
 
-            /* Copy across samples */
-            if (glopts->num_channels_in == 2)
-                for (i = 0; i < samples_to_copy; i++) {
-                    glopts->buffer[0][glopts->samples_in_buffer + i] = *leftpcm++;
-                    glopts->buffer[1][glopts->samples_in_buffer + i] = *rightpcm++;
+            // encode whole frames in place, without going through glopts->buffer
+            if (num_samples >= TWOLAME_SAMPLES_PER_FRAME && input_direct(glopts)) {
+                int bytes = encode_frame_direct(glopts, mybs, leftpcm, rightpcm, NULL, NULL, 1,
+                                                elapsed_time_twolame, elapsed_time_psycho_3);
+                if (bytes <= 0) {
+                    twolame_buffer_deinit(&mybs);
+                    return bytes;
                 }
-            else
-                for (i = 0; i < samples_to_copy; i++)
-                    glopts->buffer[0][glopts->samples_in_buffer + i] = *leftpcm++;
+                mp2_size += bytes;
+                leftpcm += TWOLAME_SAMPLES_PER_FRAME;
+                if (glopts->num_channels_in == 2)
+                    rightpcm += TWOLAME_SAMPLES_PER_FRAME;
+                num_samples -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
+                continue;
+            }
+
+            if (glopts->resample != NULL) {
+                // resample into glopts->fbuffer as much as we can
+                samples_to_copy = resample_samples(glopts, leftpcm, rightpcm, NULL, NULL, 1, num_samples);
+            } else {
+                // fill up glopts->buffer with as much as we can
+                samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
+                if (num_samples < samples_to_copy)
+                    samples_to_copy = num_samples;
+
+                /* Copy across samples, scaling and mixing them on the way */
+                copy_samples(glopts, leftpcm, rightpcm, 1, samples_to_copy);
+                glopts->samples_in_buffer += samples_to_copy;
+            }
+            leftpcm += samples_to_copy;
+            if (glopts->num_channels_in == 2)
+                rightpcm += samples_to_copy;
 
 
             /* Update sample counts */
-            glopts->samples_in_buffer += samples_to_copy;
             num_samples -= samples_to_copy;
 
 
             // is there enough to encode a whole frame ?
             if (glopts->samples_in_buffer >= TWOLAME_SAMPLES_PER_FRAME) {
-                int bytes = encode_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
+                int bytes = encode_output_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
                 if (bytes <= 0) {
                     twolame_buffer_deinit(&mybs);
                     return bytes;
                 }
                 mp2_size += bytes;
                 glopts->samples_in_buffer -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
             }
         }
 
@@ -827,6 +1503,10 @@ int twolame_encode_buffer(twolame_options * glopts,
         twolame_buffer_deinit(&mybs);
     }
 
+    // With an output callback, tell the caller how many samples were used up instead
+    if (glopts->output_callback != NULL)
+        return (samples_in - num_samples);
+
     return (mp2_size);
 }
 
@@ -836,15 +1516,27 @@ int twolame_encode_buffer_interleaved(twolame_options * glopts,
                                       int num_samples, unsigned char *mp2buffer, int mp2buffer_size, bit_stream *mybs, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
 {
     int mp2_size = 0;
-    int i;
+    int samples_in = num_samples;
 
     if (num_samples == 0)
         return 0;
 
+    // samples that have to wait for a whole frame are kept as they come
+    // (resampled samples are always float)
+    use_float_buffer(glopts, glopts->resample != NULL);
 
-    // now would be a great time to validate the size of the buffer.
-    // samples/1152 * sizeof(frame) < mp2buffer_size
-    twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+
+    if (glopts->output_callback != NULL) {
+        // Frames go to the output callback, once it has taken the last one
+        int pending = twolame_output_drain(glopts);
+        if (pending != 0)
+            return (pending < 0) ? -1 : 0;
+        mybs = &glopts->output_bs;
+    } else {
+        // now would be a great time to validate the size of the buffer.
+        // samples/1152 * sizeof(frame) < mp2buffer_size
+        twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    }
 
     //printf("glopts->psymodel = %d\n", glopts->psymodel);
 
@@ -852,31 +1544,52 @@ int twolame_encode_buffer_interleaved(twolame_options * glopts,
         // Use up all the samples in in_buffer
         while (num_samples) {
 
-            // fill up glopts->buffer with as much as we can
-            int samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
-            if (num_samples < samples_to_copy)
-                samples_to_copy = num_samples;
+            int samples_to_copy;
 
-            /* Copy across samples */
-            if (glopts->num_channels_in == 2)
-                for (i = 0; i < samples_to_copy; i++) {
-                    glopts->buffer[0][glopts->samples_in_buffer + i] = *pcm++;
-                    glopts->buffer[1][glopts->samples_in_buffer + i] = *pcm++;
+            // encode whole frames in place, without going through glopts->buffer
+            if (num_samples >= TWOLAME_SAMPLES_PER_FRAME && input_direct(glopts)) {
+                int bytes = encode_frame_direct(glopts, mybs, pcm, pcm + 1, NULL, NULL,
+                                                glopts->num_channels_in,
+                                                elapsed_time_twolame, elapsed_time_psycho_3);
+                if (bytes <= 0) {
+                    twolame_buffer_deinit(&mybs);
+                    return bytes;
                 }
-            else
-                for (i = 0; i < samples_to_copy; i++)
-                    glopts->buffer[0][glopts->samples_in_buffer + i] = *pcm++;
+                mp2_size += bytes;
+                pcm += TWOLAME_SAMPLES_PER_FRAME * glopts->num_channels_in;
+                num_samples -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
+                continue;
+            }
+
+            if (glopts->resample != NULL) {
+                // resample into glopts->fbuffer as much as we can
+                samples_to_copy = resample_samples(glopts, pcm, pcm + 1, NULL, NULL,
+                                                   glopts->num_channels_in, num_samples);
+            } else {
+                // fill up glopts->buffer with as much as we can
+                samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
+                if (num_samples < samples_to_copy)
+                    samples_to_copy = num_samples;
+
+                /* Deinterleave, scale and mix the samples in one pass */
+                copy_samples(glopts, pcm, pcm + 1, glopts->num_channels_in, samples_to_copy);
+                glopts->samples_in_buffer += samples_to_copy;
+            }
+            pcm += samples_to_copy * glopts->num_channels_in;
 
 
             /* Update sample counts */
-            glopts->samples_in_buffer += samples_to_copy;
             num_samples -= samples_to_copy;
 
 
             // is there enough to encode a whole frame ?
             if (glopts->samples_in_buffer >= TWOLAME_SAMPLES_PER_FRAME) {
                 start_elapse_time_encode = timer_time_us();
-                int bytes = encode_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
+                int bytes = encode_output_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
                 end_elapse_time_encode = timer_time_us();
                 //printf(">>>>> encode_frame() took %d us\n", (unsigned int) (end_elapse_time_encode - start_elapse_time_encode));
                 if (bytes <= 0) {
@@ -885,33 +1598,24 @@ int twolame_encode_buffer_interleaved(twolame_options * glopts,
                 }
                 mp2_size += bytes;
                 glopts->samples_in_buffer -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
             }
         }
 
-        //for (int i = 1; i < 24; i++) printf(">>>>> twolame function number %d took %d ms\n", i, (unsigned int) elapsed_time_twolame[i]);
+        //for (int i = 1; i < 22; i++) printf(">>>>> twolame function number %d took %d ms\n", i, (unsigned int) elapsed_time_twolame[i]);
 
         // free up the bit stream buffer structure
         twolame_buffer_deinit(&mybs);
     }
 
-    return (mp2_size);
-}
-
-
-static void float32_to_short(const float in[], short out[], int num_samples, int stride)
-{
-    int n;
+    // With an output callback, tell the caller how many samples were used up instead
+    if (glopts->output_callback != NULL)
+        return (samples_in - num_samples);
 
-    for (n = 0; n < num_samples; n++) {
-        int tmp = lrintf(in[n * stride] * 32768.0f);
-        if (tmp > SHRT_MAX) {
-            out[n] = SHRT_MAX;
-        } else if (tmp < SHRT_MIN) {
-            out[n] = SHRT_MIN;
-        } else {
-            out[n] = (short) tmp;
-        }
-    }
+    return (mp2_size);
 }
 
 
@@ -931,48 +1635,91 @@ int twolame_encode_buffer_float32(twolame_options * glopts,
                                   int num_samples, unsigned char *mp2buffer, int mp2buffer_size, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
 {
     int mp2_size = 0;
+    int samples_in = num_samples;
+    bit_stream bs;
     bit_stream *mybs;
 
     if (num_samples == 0)
         return 0;
 
+    // samples that have to wait for a whole frame are kept as they come
+    use_float_buffer(glopts, TRUE);
+
 
-    // now would be a great time to validate the size of the buffer.
-    // samples/1152 * sizeof(frame) < mp2buffer_size
-    twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    if (glopts->output_callback != NULL) {
+        // Frames go to the output callback, once it has taken the last one
+        int pending = twolame_output_drain(glopts);
+        if (pending != 0)
+            return (pending < 0) ? -1 : 0;
+        mybs = &glopts->output_bs;
+    } else {
+        // now would be a great time to validate the size of the buffer.
+        // samples/1152 * sizeof(frame) < mp2buffer_size
+        // (no bit_stream is passed in here, so one is set up on the stack)
+        mybs = &bs;
+        twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    }
 
     if (mybs != NULL) {
         // Use up all the samples in in_buffer
         while (num_samples) {
 
-            // fill up glopts->buffer with as much as we can
-            int samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
-            if (num_samples < samples_to_copy)
-                samples_to_copy = num_samples;
+            int samples_to_copy;
 
-            /* Copy across samples */
-            float32_to_short(leftpcm, &glopts->buffer[0][glopts->samples_in_buffer], samples_to_copy,
-                             1);
-            if (glopts->num_channels_in == 2)
-                float32_to_short(rightpcm, &glopts->buffer[1][glopts->samples_in_buffer],
-                                 samples_to_copy, 1);
+            // encode whole frames in place, without going through glopts->fbuffer
+            if (num_samples >= TWOLAME_SAMPLES_PER_FRAME && input_direct(glopts)) {
+                int bytes = encode_frame_direct(glopts, mybs, NULL, NULL, leftpcm, rightpcm, 1,
+                                                elapsed_time_twolame, elapsed_time_psycho_3);
+                if (bytes <= 0) {
+                    twolame_buffer_deinit(&mybs);
+                    return bytes;
+                }
+                mp2_size += bytes;
+                leftpcm += TWOLAME_SAMPLES_PER_FRAME;
+                if (glopts->num_channels_in == 2)
+                    rightpcm += TWOLAME_SAMPLES_PER_FRAME;
+                num_samples -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
+                continue;
+            }
+
+            if (glopts->resample != NULL) {
+                // resample into glopts->fbuffer as much as we can
+                samples_to_copy = resample_samples(glopts, NULL, NULL, leftpcm, rightpcm, 1, num_samples);
+            } else {
+                // fill up glopts->fbuffer with as much as we can
+                samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
+                if (num_samples < samples_to_copy)
+                    samples_to_copy = num_samples;
+
+                /* Copy across samples, they stay as float all the way to the filterbank */
+                copy_float_samples(glopts, leftpcm, rightpcm, 1, samples_to_copy);
+                glopts->samples_in_buffer += samples_to_copy;
+            }
             leftpcm += samples_to_copy;
-            rightpcm += samples_to_copy;
+            if (glopts->num_channels_in == 2)
+                rightpcm += samples_to_copy;
 
             /* Update sample counts */
-            glopts->samples_in_buffer += samples_to_copy;
             num_samples -= samples_to_copy;
 
 
             // is there enough to encode a whole frame ?
             if (glopts->samples_in_buffer >= TWOLAME_SAMPLES_PER_FRAME) {
-                int bytes = encode_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
+                int bytes = encode_output_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
                 if (bytes <= 0) {
                     twolame_buffer_deinit(&mybs);
                     return bytes;
                 }
                 mp2_size += bytes;
                 glopts->samples_in_buffer -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
             }
         }
 
@@ -980,6 +1727,10 @@ int twolame_encode_buffer_float32(twolame_options * glopts,
         twolame_buffer_deinit(&mybs);
     }
 
+    // With an output callback, tell the caller how many samples were used up instead
+    if (glopts->output_callback != NULL)
+        return (samples_in - num_samples);
+
     return (mp2_size);
 }
 
@@ -990,48 +1741,90 @@ int twolame_encode_buffer_float32_interleaved(twolame_options * glopts,
         unsigned char *mp2buffer, int mp2buffer_size, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3)
 {
     int mp2_size = 0;
+    int samples_in = num_samples;
+    bit_stream bs;
     bit_stream *mybs;
 
     if (num_samples == 0)
         return 0;
 
+    // samples that have to wait for a whole frame are kept as they come
+    use_float_buffer(glopts, TRUE);
+
 
-    // now would be a great time to validate the size of the buffer.
-    // samples/1152 * sizeof(frame) < mp2buffer_size
-    twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    if (glopts->output_callback != NULL) {
+        // Frames go to the output callback, once it has taken the last one
+        int pending = twolame_output_drain(glopts);
+        if (pending != 0)
+            return (pending < 0) ? -1 : 0;
+        mybs = &glopts->output_bs;
+    } else {
+        // now would be a great time to validate the size of the buffer.
+        // samples/1152 * sizeof(frame) < mp2buffer_size
+        // (no bit_stream is passed in here, so one is set up on the stack)
+        mybs = &bs;
+        twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    }
 
     if (mybs != NULL) {
         // Use up all the samples in in_buffer
         while (num_samples) {
 
-            // fill up glopts->buffer with as much as we can
-            int samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
-            if (num_samples < samples_to_copy)
-                samples_to_copy = num_samples;
+            int samples_to_copy;
 
-            /* Copy across samples */
-            float32_to_short(pcm, &glopts->buffer[0][glopts->samples_in_buffer], samples_to_copy,
-                             glopts->num_channels_in);
-            if (glopts->num_channels_in == 2)
-                float32_to_short(pcm + 1, &glopts->buffer[1][glopts->samples_in_buffer],
-                                 samples_to_copy, glopts->num_channels_in);
-            pcm += (samples_to_copy * glopts->num_channels_in);
+            // encode whole frames in place, without going through glopts->fbuffer
+            if (num_samples >= TWOLAME_SAMPLES_PER_FRAME && input_direct(glopts)) {
+                int bytes = encode_frame_direct(glopts, mybs, NULL, NULL, pcm, pcm + 1,
+                                                glopts->num_channels_in,
+                                                elapsed_time_twolame, elapsed_time_psycho_3);
+                if (bytes <= 0) {
+                    twolame_buffer_deinit(&mybs);
+                    return bytes;
+                }
+                mp2_size += bytes;
+                pcm += TWOLAME_SAMPLES_PER_FRAME * glopts->num_channels_in;
+                num_samples -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
+                continue;
+            }
+
+            if (glopts->resample != NULL) {
+                // resample into glopts->fbuffer as much as we can
+                samples_to_copy = resample_samples(glopts, NULL, NULL, pcm, pcm + 1,
+                                                   glopts->num_channels_in, num_samples);
+            } else {
+                // fill up glopts->fbuffer with as much as we can
+                samples_to_copy = TWOLAME_SAMPLES_PER_FRAME - glopts->samples_in_buffer;
+                if (num_samples < samples_to_copy)
+                    samples_to_copy = num_samples;
+
+                /* Copy across samples, they stay as float all the way to the filterbank */
+                copy_float_samples(glopts, pcm, pcm + 1, glopts->num_channels_in, samples_to_copy);
+                glopts->samples_in_buffer += samples_to_copy;
+            }
+            pcm += samples_to_copy * glopts->num_channels_in;
 
 
             /* Update sample counts */
-            glopts->samples_in_buffer += samples_to_copy;
             num_samples -= samples_to_copy;
 
 
             // is there enough to encode a whole frame ?
             if (glopts->samples_in_buffer >= TWOLAME_SAMPLES_PER_FRAME) {
-                int bytes = encode_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
+                int bytes = encode_output_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
                 if (bytes <= 0) {
                     twolame_buffer_deinit(&mybs);
                     return bytes;
                 }
                 mp2_size += bytes;
                 glopts->samples_in_buffer -= TWOLAME_SAMPLES_PER_FRAME;
+
+                // the output callback is pushing back, so stop taking samples
+                if (glopts->output_pending)
+                    break;
             }
         }
 
@@ -1039,6 +1832,10 @@ int twolame_encode_buffer_float32_interleaved(twolame_options * glopts,
         twolame_buffer_deinit(&mybs);
     }
 
+    // With an output callback, tell the caller how many samples were used up instead
+    if (glopts->output_callback != NULL)
+        return (samples_in - num_samples);
+
     return (mp2_size);
 }
 
@@ -1049,22 +1846,59 @@ int twolame_encode_flush(twolame_options * glopts, unsigned char *mp2buffer, int
     int mp2_size = 0;
     int i;
 
+    // Bring the last samples out of the resampler
+    if (glopts->resample != NULL)
+        flush_resampler(glopts);
+
     if (glopts->samples_in_buffer == 0) {
         // No samples left over
         return 0;
     }
-    // Create bit stream structure
-    twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    if (glopts->output_callback != NULL) {
+        // The last frame has to be taken by the output callback first
+        int pending = twolame_output_drain(glopts);
+        if (pending != 0)
+            return (pending < 0) ? -1 : 0;
+        mybs = &glopts->output_bs;
+    } else {
+        // Create bit stream structure
+        twolame_buffer_init(mp2buffer, mp2buffer_size, mybs);
+    }
 
     if (mybs != NULL) {
-        // Pad out the PCM buffers with 0 and encode the frame
-        for (i = glopts->samples_in_buffer; i < TWOLAME_SAMPLES_PER_FRAME; i++) {
-            glopts->buffer[0][i] = glopts->buffer[1][i] = 0;
+        // The resampler can still be holding more than a frame
+        while (glopts->samples_in_buffer >= TWOLAME_SAMPLES_PER_FRAME) {
+            int bytes = encode_output_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
+            if (bytes <= 0) {
+                twolame_buffer_deinit(&mybs);
+                return bytes;
+            }
+            mp2_size += bytes;
+            glopts->samples_in_buffer = 0;
+
+            // the output callback is pushing back, so the rest waits for the next call
+            if (glopts->output_pending) {
+                twolame_buffer_deinit(&mybs);
+                return mp2_size;
+            }
+            if (glopts->resample != NULL)
+                flush_resampler(glopts);
         }
 
-        // Encode the frame
-        mp2_size = encode_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
-        glopts->samples_in_buffer = 0;
+        if (glopts->samples_in_buffer > 0) {
+            int bytes;
+
+            // Pad out the PCM buffers with 0 and encode the frame
+            for (i = glopts->samples_in_buffer; i < TWOLAME_SAMPLES_PER_FRAME; i++) {
+                glopts->buffer[0][i] = glopts->buffer[1][i] = 0;
+                glopts->fbuffer[0][i] = glopts->fbuffer[1][i] = 0;
+            }
+
+            // Encode the frame
+            bytes = encode_output_frame(glopts, mybs, elapsed_time_twolame, elapsed_time_psycho_3);
+            mp2_size = (bytes < 0) ? bytes : mp2_size + bytes;
+            glopts->samples_in_buffer = 0;
+        }
 
         // free up the bit stream buffer structure
         twolame_buffer_deinit(&mybs);
@@ -1088,18 +1922,11 @@ void twolame_close(twolame_options ** glopts)
         return;
 
     // free mem
-    twolame_psycho_4_deinit(&opts->p4mem);
-    twolame_psycho_3_deinit(&opts->p3mem);
-    twolame_psycho_2_deinit(&opts->p2mem);
-    twolame_psycho_1_deinit(&opts->p1mem);
-    twolame_psycho_0_deinit(&opts->p0mem);
-
-    TWOLAME_FREE(opts->subband);
-    TWOLAME_FREE(opts->j_sample);
-    TWOLAME_FREE(opts->sb_sample);
+    release_memory(opts);
 
     // Free the memory and zero the pointer
-    TWOLAME_FREE(opts);
+    opts->free_func(opts->block, opts->alloc_user_data);
+    *glopts = NULL;
 }
 
 // vim:ts=4:sw=4:nowrap:
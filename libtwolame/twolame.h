@@ -29,6 +29,9 @@ extern "C" {
 
 /** \file twolame.h */
 
+#include <stddef.h>
+#include <stdint.h>
+
 /*
  * ATTENTION WIN32 USERS!
  *
@@ -185,6 +188,46 @@ TL_API void twolame_print_config(twolame_options * glopts);
 TL_API twolame_options *twolame_init(void);
 
 
+/** Function for allocating memory.
+ *
+ *  The memory doesn't have to be cleared or aligned; the library does both.
+ *
+ *  \param size            number of bytes wanted
+ *  \param user_data       pointer given to twolame_init_with_allocator()
+ *  \return                the memory, or NULL on failure
+ */
+typedef void *(*twolame_alloc_func) (size_t size, void *user_data);
+
+
+/** Function for freeing memory allocated by a twolame_alloc_func.
+ *
+ *  \param ptr             memory returned by the twolame_alloc_func
+ *  \param user_data       pointer given to twolame_init_with_allocator()
+ */
+typedef void (*twolame_free_func) (void *ptr, void *user_data);
+
+
+/** Initialise the twolame encoder, with an allocator of your own.
+ *
+ *  Like twolame_init(), but all the memory of the encoder comes from
+ *  alloc_func. That is two allocations: the options structure here,
+ *  and a single cache line aligned block in twolame_init_params(),
+ *  which holds the psychoacoustic model, resampler and buffers.
+ *  Nothing is allocated while encoding. The tables cached for the
+ *  psychoacoustic models are shared between encoders, so they are
+ *  still allocated with malloc().
+ *
+ *  \param alloc_func      allocation function, or NULL for malloc()
+ *  \param free_func       function freeing what alloc_func returned,
+ *                         or NULL for free()
+ *  \param user_data       passed on to alloc_func and free_func
+ *  \return a pointer to your new options data structure
+ */
+TL_API twolame_options *twolame_init_with_allocator(twolame_alloc_func alloc_func,
+                                                    twolame_free_func free_func,
+                                                    void *user_data);
+
+
 /** Prepare to start encoding.
  *
  *  You must call twolame_init_params() before you start encoding.
@@ -192,6 +235,13 @@ TL_API twolame_options *twolame_init(void);
  *  as well as allocating buffers and initising internally used
  *  variables.
  *
+ *  The tables of the psychoacoustic model are set up here too, so the
+ *  first frame takes no longer to encode than the rest. They are built
+ *  once for each model, output samplerate and ATH level, and kept for
+ *  later encoders (see twolame_free_psycho_cache()). The cache is
+ *  locked, so encoders can be set up from several threads at once
+ *  (a build without pthreads doesn't cache the tables at all).
+ *
  *  \param glopts          Options pointer created by twolame_init()
  *  \return                0 if all patameters are valid,
  *                         non-zero if something is invalid
@@ -244,8 +294,8 @@ TL_API int twolame_encode_buffer_interleaved(twolame_options * glopts,
  *  Takes 32-bit floating point PCM audio samples from seperate
  *  left and right buffers and places encoded audio into mp2buffer.
  *
- *  Note: the 32-bit samples are currently scaled down to
- *  16-bit samples internally.
+ *  Full scale is 1.0. The samples are encoded as they are,
+ *  without being scaled down to 16-bit samples first.
  *
  *  \param glopts          twolame options pointer
  *  \param leftpcm         Left channel audio samples
@@ -276,7 +326,7 @@ TL_API int twolame_encode_buffer_float32(twolame_options * glopts,
  *  \return                The number of bytes put in output buffer
  *                         or a negative value on error
  */
-int twolame_encode_buffer_float32_interleaved(twolame_options * glopts,
+TL_API int twolame_encode_buffer_float32_interleaved(twolame_options * glopts,
         const float pcm[],
         int num_samples,
         unsigned char *mp2buffer, int mp2buffer_size, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3);
@@ -298,6 +348,86 @@ TL_API int twolame_encode_flush(twolame_options * glopts,
                                     unsigned char *mp2buffer, int mp2buffer_size, bit_stream *mybs, unsigned int * elapsed_time_twolame, unsigned int * elapsed_time_psycho_3);
 
 
+/** Callback for receiving the encoded MPEG Audio.
+ *
+ *  Called with each frame as soon as it is complete, including the
+ *  CRC and energy levels. The data points into the library's own
+ *  frame buffer, it isn't copied anywhere first. The callback can
+ *  take less than the whole frame to push back on the encoder; the
+ *  rest stays in the frame buffer and is offered again later.
+ *
+ *  \param data            the encoded data
+ *  \param size            number of bytes in data
+ *  \param user_data       pointer given to twolame_set_output_callback()
+ *  \return                the number of bytes taken (0 to size),
+ *                         or a negative value on error
+ */
+typedef int (*twolame_output_callback) (const unsigned char *data, int size, void *user_data);
+
+
+/** Send encoded frames to a callback instead of an output buffer.
+ *
+ *  Once a callback is set, the mp2buffer given to the encode functions
+ *  isn't used (it can be NULL) and every frame goes to the callback.
+ *  The twolame_encode_buffer*() functions then return the number of
+ *  samples per channel they used up, which is less than num_samples
+ *  when the callback didn't take the whole of a frame. Those functions
+ *  first try to hand over what is left of that frame, then carry on.
+ *  Call twolame_output_drain() until it returns 0 before calling
+ *  twolame_encode_flush(), which returns the size of the last frame.
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \param callback        the callback, or NULL to go back to mp2buffer
+ *  \param user_data       passed on to the callback
+ *  \return                0 if successful, non-zero on failure
+ */
+TL_API int twolame_set_output_callback(twolame_options * glopts,
+                                       twolame_output_callback callback, void *user_data);
+
+
+/** Hand over what the output callback didn't take of the last frame.
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \return                the number of bytes still waiting for the callback,
+ *                         or a negative value on error
+ */
+TL_API int twolame_output_drain(twolame_options * glopts);
+
+
+/** Where an encoded frame is, for twolame_frame_callback. */
+typedef struct {
+    uint64_t frame;             /**< Frame number, counting from 0 */
+    uint64_t offset;            /**< Byte offset of the frame in the encoded stream */
+    int size;                   /**< Size of the frame in bytes, padding included */
+    int bitrate_index;          /**< Bitrate index in the header (0 for free format) */
+    int padding;                /**< TRUE if the frame is padded */
+    uint64_t sample;            /**< First sample of the frame (per channel, output samplerate) */
+} twolame_frame_info;
+
+
+/** Callback told about each frame as soon as it has been encoded.
+ *
+ *  \param info            where the frame is, and its size and bitrate
+ *  \param user_data       pointer given to twolame_set_frame_callback()
+ */
+typedef void (*twolame_frame_callback) (const twolame_frame_info * info, void *user_data);
+
+
+/** Be told the offset, size, bitrate and time of every frame.
+ *
+ *  The offsets count every byte the encoder has produced, so they
+ *  are offsets into the output for a caller that writes out all the
+ *  frames in order, which saves parsing it again to find them.
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \param callback        the callback, or NULL for none
+ *  \param user_data       passed on to the callback
+ *  \return                0 if successful, non-zero on failure
+ */
+TL_API int twolame_set_frame_callback(twolame_options * glopts,
+                                      twolame_frame_callback callback, void *user_data);
+
+
 /** Shut down the twolame encoder.
  *
  *  Shuts down the twolame encoder and frees all memory
@@ -310,6 +440,30 @@ TL_API int twolame_encode_flush(twolame_options * glopts,
 TL_API void twolame_close(twolame_options ** glopts);
 
 
+/** Free the cached psychoacoustic model tables.
+ *
+ *  The tables built by twolame_init_params() are kept for the life
+ *  of the process, so that later encoders don't have to build them
+ *  again. This frees them; it is safe to call at any time, from any
+ *  thread. Tables that encoders in
+ *  compact memory mode are still using are kept, and can be freed
+ *  by calling this again once those encoders have been closed.
+ */
+TL_API void twolame_free_psycho_cache(void);
+
+
+/** Get the amount of memory used by an encoder.
+ *
+ *  Counts the options structure and everything allocated for it by
+ *  twolame_init_params(), leaving out the tables it shares with the
+ *  psychoacoustic model cache in compact memory mode.
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \return                the number of bytes used by the encoder
+ */
+TL_API size_t twolame_get_memory_usage(twolame_options * glopts);
+
+
 
 /** Set the verbosity of the encoder.
  *
@@ -551,6 +705,54 @@ TL_API int twolame_set_out_samplerate(twolame_options * glopts, int samplerate);
 TL_API int twolame_get_out_samplerate(twolame_options * glopts);
 
 
+/** Set the quality of the resampler.
+ *
+ *  The input is resampled when its samplerate isn't the same
+ *  as the output samplerate. Higher qualities use longer filters,
+ *  with a flatter passband and less aliasing, but are slower.
+ *
+ *  Default: 2
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \param quality         0 (fastest) to 3 (best)
+ *  \return                0 if successful, non-zero on failure
+ */
+TL_API int twolame_set_resample_quality(twolame_options * glopts, int quality);
+
+
+/** Get the quality of the resampler.
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \return                the resampler quality (0 to 3)
+ */
+TL_API int twolame_get_resample_quality(twolame_options * glopts);
+
+
+/** Enable/Disable compact memory mode.
+ *
+ *  In compact memory mode the read-only tables of the psychoacoustic
+ *  model are shared with the cache of twolame_init_params(), rather than
+ *  copied into each encoder. That saves the most when a lot of encoders
+ *  use the same model and samplerate. It makes no difference to the
+ *  encoded audio.
+ *
+ *  Default: FALSE
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \param compact         TRUE = share the tables, FALSE = copy them
+ *  \return                0 if successful, non-zero on failure
+ */
+TL_API int twolame_set_compact_memory(twolame_options * glopts, int compact);
+
+
+/** Get the status of compact memory mode.
+ *
+ *  \param glopts          pointer to twolame options pointer
+ *  \return                TRUE if compact memory mode is enabled
+ */
+TL_API int twolame_get_compact_memory(twolame_options * glopts);
+
+
 /** Set the bitrate of the MPEG audio output stream.
  *
  *  Default: 192